@@ -27,6 +27,11 @@ if(CMAKE_BUILD_TYPE STREQUAL "Debug")
     set(SFA_ENABLE_ASSERTIONS ON CACHE BOOL "" FORCE)
 endif()
 
+option(SFA_BUILD_BENCHMARKS "Build the benchmark suite" ON)
+option(SFA_BUILD_TOOLS "Build the offline tools, like the asset packer" ON)
+option(SFA_ENABLE_PROFILING "Enable the frame profiler zones" OFF)
+
 add_compile_definitions(SFA_DEBUG=$<BOOL:${SFA_DEBUG}>)
 add_compile_definitions(SFA_ENABLE_ASSERTIONS=$<BOOL:${SFA_ENABLE_ASSERTIONS}>)
+add_compile_definitions(SFA_ENABLE_PROFILING=$<BOOL:${SFA_ENABLE_PROFILING}>)
 
@@ -1,3 +1,7 @@
+#include "core/GameLoop.hpp"
+#include "core/GpuTimer.hpp"
+#include "core/Profiler.hpp"
+#include "core/Sampler.hpp"
 #include "core/Shader.hpp"
 #include "core/SpriteRenderer.hpp"
 #include "core/TextRenderer.hpp"
@@ -5,13 +9,16 @@
 #include "ecs/ECSUtility.hpp"
 #include "ecs/components/SpriteComponent.hpp"
 #include "ecs/components/TextComponent.hpp"
+#include "ecs/components/TransformComponent.hpp"
 #include "ecs/components/UIButtonComponent.hpp"
 #include "ecs/components/UIHierarchyComponent.hpp"
 #include "ecs/components/UILayoutComponent.hpp"
 #include "ecs/components/UILayoutElementComponent.hpp"
 #include "ecs/components/UITransformComponent.hpp"
 #include "ecs/systems/ButtonSystem.hpp"
+#include "ecs/systems/InterpolationSystem.hpp"
 #include "ecs/systems/LayoutSystem.hpp"
+#include "ecs/systems/SpriteRenderSystem.hpp"
 #include "ecs/systems/UIRenderSystem.hpp"
 #include "ecs/systems/UITransformSystem.hpp"
 #include "utility/GLFWWindow.hpp"
@@ -19,8 +26,8 @@
 #include "utility/userInput/InputEvent.hpp"
 
 #include <glad/gl.h>
+#include <glm/ext/matrix_clip_space.hpp>
 
-#include <GLFW/glfw3.h>
 #include <spdlog/spdlog.h>
 
 #include <filesystem>
@@ -72,12 +79,26 @@ int main()
     auto spriteShader{ std::make_shared<Shader>(spriteVertSrc.c_str(), spriteFragSrc.c_str()) };
     auto textShader{ std::make_shared<Shader>(textVertSrc.c_str(), textFragSrc.c_str()) };
 
-    auto spriteRenderer{ std::make_shared<SpriteRenderer>(spriteShader) };
+    // NOTE: Renderers share their samplers through the cache, so every sampling state exists only once
+    SamplerCache samplers;
+    const auto spriteSampler{ samplers.get(SamplerState{}) };
+
+    auto spriteRenderer{ std::make_shared<SpriteRenderer>(spriteShader, spriteSampler) };
     auto textRenderer{ std::make_shared<TextRenderer>(textShader) };
     textRenderer->load(SFA_ROOT "resources/fonts/prstart.ttf", 18);
     UIRenderSystem uiRenderer{ spriteRenderer, textRenderer };
+    SpriteRenderSystem worldRenderer{ spriteShader, spriteSampler };
+    const auto projection{ glm::ortho(0.f, float{ WINDOW_WIDTH }, float{ WINDOW_HEIGHT }, 0.f, -1.f, 1.f) };
+
+#if SFA_ENABLE_PROFILING
+    auto gpuTimer{ std::make_shared<GpuTimer>() };
+    uiRenderer.setGpuTimer(gpuTimer);
+    worldRenderer.setGpuTimer(gpuTimer);
+#endif
 
     ComponentRegistry registry;
+    // NOTE: Game world entities are rendered between the last two simulation steps, the UI is laid out every frame
+    registry.registerComponent<TransformComponent>();
 
     constexpr EntityID rootEntity{ 1 };
     constexpr EntityID playButtonEntity{ 2 };
@@ -193,33 +214,51 @@ int main()
     };
     registry.addComponent<UIButtonComponent>(quitButtonEntity, quitButton);
 
-    float lastTime{ static_cast<float>(glfwGetTime()) };
+    GameLoop loop{};
 
     while(!window.shouldClose())
     {
-        const float now{ static_cast<float>(glfwGetTime()) };
-        const float dt{ now - lastTime };
-        lastTime = now;
+        SFA_PROFILE_SCOPE("Frame");
+#if SFA_ENABLE_PROFILING
+        gpuTimer->beginFrame();
+#endif
 
         input->processEventQueue();
 
         if(input->isKeyPressed(Key::Esc) == InputAction::Press)
-            glfwSetWindowShouldClose(glfwGetCurrentContext(), GLFW_TRUE);
+            window.setShouldClose();
 
         const bool mousePressed{ input->isMousePressed(MouseButton::Left) == InputAction::Press };
 
+        LayoutSystem::update(registry);
+        UITransformSystem::update(registry);
+        const auto frame{ loop.tick([&](float dt) {
+            InterpolationSystem::snapshot(registry);
+            ButtonSystem::update(registry, dt, input->mousePosition(), mousePressed);
+        }) };
+
         glClearColor(0.08f, 0.08f, 0.12f, 1.f);
         glClear(GL_COLOR_BUFFER_BIT);
 
-        LayoutSystem::update(registry);
-        UITransformSystem::update(registry);
-        ButtonSystem::update(registry, dt, input->mousePosition(), mousePressed);
+        worldRenderer.render(registry, projection, frame.alpha);
         uiRenderer.render(registry);
 
-        glfwSwapBuffers(glfwGetCurrentContext());
-        glfwPollEvents();
+        window.swapBuffers();
+        window.pollEvents();
+
+#if SFA_ENABLE_PROFILING
+        // NOTE: Thread buffers only hold a few seconds of zones, so they are emptied every frame
+        profiling::Profiler::instance().collect();
+#endif
     }
 
+#if SFA_ENABLE_PROFILING
+    if(profiling::Profiler::instance().saveChromeTrace("sfa_trace.json"))
+        spdlog::info("Profiler trace written to sfa_trace.json");
+    if(gpuTimer->saveCsv("sfa_gpu_timings.csv"))
+        spdlog::info("GPU timings written to sfa_gpu_timings.csv");
+#endif
+
     return 0;
 }
 
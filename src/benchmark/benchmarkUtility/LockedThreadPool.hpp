@@ -0,0 +1,147 @@
+#ifndef SFA_SRC_BENCHMARK_BENCHMARK_UTILITY_LOCKED_THREAD_POOL_HPP
+#define SFA_SRC_BENCHMARK_BENCHMARK_UTILITY_LOCKED_THREAD_POOL_HPP
+
+#include "utility/details/Threading.hpp"
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace sfa::benchmarking
+{
+
+/// \brief The single queue thread pool the engine used before the work-stealing \ref ThreadPool.
+///
+/// One std::queue behind one mutex and one condition variable, with the same enqueue and shutdown interface. Only
+/// kept as a baseline for the thread pool benchmarks.
+///
+/// \author Felix Hommel
+/// \date 3/14/2026
+class LockedThreadPool
+{
+public:
+    /// \brief Create a new \ref LockedThreadPool
+    ///
+    /// \param nThreads how many threads the pool has available
+    explicit LockedThreadPool(std::size_t nThreads)
+    {
+        m_workers.reserve(std::max<std::size_t>(nThreads, 1));
+        for(std::size_t i{ 0 }; i < std::max<std::size_t>(nThreads, 1); ++i)
+            m_workers.emplace_back([this](threading::stop_token_t st) { worker(st); });
+    }
+    ~LockedThreadPool() { shutdown(); }
+
+    LockedThreadPool(const LockedThreadPool&) = delete;
+    LockedThreadPool& operator=(const LockedThreadPool&) = delete;
+    LockedThreadPool(LockedThreadPool&&) = delete;
+    LockedThreadPool& operator=(LockedThreadPool&&) = delete;
+
+    /// \brief Enqueue a new task for the pool
+    ///
+    /// \returns result of \p f wrapped in a std::future
+    template<typename F, typename... Args>
+        requires std::is_invocable_v<F, Args...>
+    auto enqueue(F&& f, Args&&... args) -> std::future<std::invoke_result_t<std::decay_t<F>, std::decay_t<Args>...>>
+    {
+        using R = std::invoke_result_t<std::decay_t<F>, std::decay_t<Args>...>;
+
+        auto task{ std::make_shared<std::packaged_task<R()>>(
+            [func = std::decay_t<F>(std::forward<F>(f)),
+             tup = std::tuple<std::decay_t<Args>...>(std::forward<Args>(args)...)]() mutable -> R {
+                return std::apply(func, tup);
+            }
+        ) };
+
+        auto future{ task->get_future() };
+
+        {
+            std::lock_guard lock(m_mutex);
+
+            m_queue.emplace([task]() { (*task)(); });
+        }
+
+        m_signal.notify_one();
+
+        return future;
+    }
+
+    /// \brief Shut down the thread pool
+    ///
+    /// \param drainQueue (optional) whether or not the queue should first drain the pending jobs or cancel them
+    void shutdown(bool drainQueue = true) noexcept
+    {
+        if(drainQueue)
+        {
+            std::unique_lock lock(m_mutex);
+            m_draining = true;
+            m_drainingComplete.wait(lock, [this]() { return m_queue.empty(); });
+        }
+        else
+        {
+            std::lock_guard lock(m_mutex);
+
+            std::queue<std::function<void()>> emptyQueue;
+            std::swap(m_queue, emptyQueue);
+        }
+
+        for(auto& worker : m_workers)
+            worker.request_stop();
+
+        m_signal.notify_all();
+
+        m_workers.clear();
+    }
+
+private:
+    std::vector<threading::thread_t> m_workers;
+    std::mutex m_mutex;
+    std::condition_variable m_signal;
+    std::condition_variable m_drainingComplete;
+    std::queue<std::function<void()>> m_queue;
+    bool m_draining{ false };
+
+    void worker(const threading::stop_token_t& st)
+    {
+        for(;;)
+        {
+            std::function<void()> job;
+
+            {
+                std::unique_lock lock(m_mutex);
+                m_signal.wait(lock, [&]() { return st.stop_requested() || !m_queue.empty(); });
+
+                if(st.stop_requested() && (m_queue.empty() || !m_draining))
+                {
+                    if(m_queue.empty())
+                        m_drainingComplete.notify_all();
+
+                    return;
+                }
+
+                if(m_queue.empty())
+                    continue;
+
+                job = std::move(m_queue.front());
+                m_queue.pop();
+
+                if(m_queue.empty() && m_draining)
+                    m_drainingComplete.notify_all();
+            }
+
+            job();
+        }
+    }
+};
+
+} // namespace sfa::benchmarking
+
+#endif // !SFA_SRC_BENCHMARK_BENCHMARK_UTILITY_LOCKED_THREAD_POOL_HPP
@@ -0,0 +1,87 @@
+#ifndef SFA_SRC_BENCHMARK_BENCHMARK_UTILITY_UI_TREE_FACTORY_HPP
+#define SFA_SRC_BENCHMARK_BENCHMARK_UTILITY_UI_TREE_FACTORY_HPP
+
+#include "ecs/ComponentRegistry.hpp"
+#include "ecs/ECSUtility.hpp"
+#include "ecs/components/UIHierarchyComponent.hpp"
+#include "ecs/components/UILayoutComponent.hpp"
+#include "ecs/components/UILayoutElementComponent.hpp"
+#include "ecs/components/UITransformComponent.hpp"
+
+#include <glm/glm.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace sfa::benchmarking
+{
+
+/// \brief Create a UI tree in which every inner node is a layout with \p fanout children.
+///
+/// Layouts alternate between vertical and horizontal per level. A \p fanout of 1 creates a chain, which is the
+/// deepest tree possible for a given amount of nodes.
+///
+/// \param depth how many levels below the root the tree has
+/// \param fanout how many children every inner node has
+///
+/// \returns \ref ComponentRegistry populated with the tree, the root is entity 1
+///
+/// \author Felix Hommel
+/// \date 3/13/2026
+inline std::unique_ptr<ComponentRegistry> createUITree(std::size_t depth, std::size_t fanout)
+{
+    constexpr glm::vec2 ROOT_SIZE{ 1920.f, 1080.f };
+    constexpr glm::vec2 ELEMENT_SIZE{ 32.f, 16.f };
+    constexpr glm::vec2 PADDING{ 4.f, 4.f };
+    constexpr auto SPACING{ 2.f };
+
+    auto registry{ std::make_unique<ComponentRegistry>() };
+    registry->registerComponent<UITransformComponent>();
+    registry->registerComponent<UIHierarchyComponent>();
+    registry->registerComponent<UILayoutComponent>();
+    registry->registerComponent<UILayoutElementComponent>();
+
+    EntityID next{ 1 };
+    const auto root{ next++ };
+    registry->addComponent<UITransformComponent>(root, { .size = ROOT_SIZE });
+    registry->addComponent<UIHierarchyComponent>(root, { .parent = NULL_ENTITY, .children = {} });
+
+    std::vector<EntityID> level{ root };
+    for(std::size_t d{ 0 }; d < depth; ++d)
+    {
+        std::vector<EntityID> nextLevel;
+        nextLevel.reserve(level.size() * fanout);
+
+        for(const auto parent : level)
+        {
+            const auto type{ d % 2 == 0 ? UILayoutComponent::Type::Vertical : UILayoutComponent::Type::Horizontal };
+            registry->addComponent<UILayoutComponent>(
+                parent, { .type = type, .spacing = SPACING, .padding = PADDING }
+            );
+
+            auto& children{ registry->getComponent<UIHierarchyComponent>(parent).children };
+            for(std::size_t c{ 0 }; c < fanout; ++c)
+            {
+                const auto child{ next++ };
+                registry->addComponent<UITransformComponent>(child, { .size = ELEMENT_SIZE });
+                registry->addComponent<UIHierarchyComponent>(child, { .parent = parent, .children = {} });
+                registry->addComponent<UILayoutElementComponent>(
+                    child, { .preferredSize = ELEMENT_SIZE, .flexGrow = static_cast<float>(c % 2) }
+                );
+
+                children.push_back(child);
+                nextLevel.push_back(child);
+            }
+        }
+
+        level = std::move(nextLevel);
+    }
+
+    return registry;
+}
+
+} // namespace sfa::benchmarking
+
+#endif // !SFA_SRC_BENCHMARK_BENCHMARK_UTILITY_UI_TREE_FACTORY_HPP
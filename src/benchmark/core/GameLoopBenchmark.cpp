@@ -0,0 +1,84 @@
+#include "core/GameLoop.hpp"
+#include "ecs/ComponentRegistry.hpp"
+#include "ecs/ECSUtility.hpp"
+#include "ecs/components/BoxColliderComponent.hpp"
+#include "ecs/components/CircleColliderComponent.hpp"
+#include "ecs/components/TransformComponent.hpp"
+#include "ecs/components/VelocityComponent.hpp"
+#include "ecs/systems/CollisionSystem.hpp"
+#include "ecs/systems/InterpolationSystem.hpp"
+#include "ecs/systems/MovementSystem.hpp"
+
+#include <benchmark/benchmark.h>
+#include <glm/glm.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <random>
+
+namespace
+{
+
+constexpr std::uint32_t RNG_SEED{ 0xC0FFEEu };
+constexpr auto WORLD_SIZE{ 1000.f };
+constexpr auto MAX_SPEED{ 50.f };
+constexpr glm::vec2 COLLIDER_SIZE{ 8.f };
+
+constexpr auto SIMULATION_RATE{ 120.0 };
+
+/// \brief Simulated seconds per benchmark iteration.
+constexpr std::uint64_t SIMULATED_SECONDS{ 1 };
+constexpr auto STEPS_PER_ITERATION{ SIMULATED_SECONDS * static_cast<std::uint64_t>(SIMULATION_RATE) };
+
+/// \brief Create a registry with \p count moving box colliders.
+std::unique_ptr<sfa::ComponentRegistry> createScene(std::size_t count)
+{
+    auto registry{ std::make_unique<sfa::ComponentRegistry>() };
+    registry->registerComponent<sfa::TransformComponent>();
+    registry->registerComponent<sfa::VelocityComponent>();
+    registry->registerComponent<sfa::BoxColliderComponent>();
+    registry->registerComponent<sfa::CircleColliderComponent>();
+
+    std::mt19937 rng{ RNG_SEED };
+    std::uniform_real_distribution<float> position{ 0.f, WORLD_SIZE };
+    std::uniform_real_distribution<float> speed{ -MAX_SPEED, MAX_SPEED };
+
+    for(std::size_t i{ 0 }; i < count; ++i)
+    {
+        const auto entity{ static_cast<sfa::EntityID>(i + 1) };
+
+        registry->addComponent<sfa::TransformComponent>(entity, { .position = { position(rng), position(rng) } });
+        registry->addComponent<sfa::VelocityComponent>(entity, { .linear = { speed(rng), speed(rng) } });
+        registry->addComponent<sfa::BoxColliderComponent>(entity, { .size = COLLIDER_SIZE });
+    }
+
+    return registry;
+}
+
+} // namespace
+
+/// \brief Headless soak of the fixed-step simulation (snapshot, movement, collision) at maximum speed.
+static void BM_GameLoopHeadless(benchmark::State& state)
+{
+    const auto registry{ createScene(static_cast<std::size_t>(state.range(0))) };
+    sfa::CollisionSystem collisions;
+    sfa::GameLoop loop{ { .simulationRate = SIMULATION_RATE } };
+
+    for(auto _ : state)
+    {
+        loop.runHeadless(STEPS_PER_ITERATION, [&](float dt) {
+            sfa::InterpolationSystem::snapshot(*registry);
+            sfa::MovementSystem::update(*registry, dt);
+            collisions.update(*registry);
+        });
+        benchmark::DoNotOptimize(collisions.contacts().data());
+    }
+
+    state.counters["stepsPerSecond"] =
+        benchmark::Counter(static_cast<double>(loop.totalSteps()), benchmark::Counter::kIsRate);
+}
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-non-const-global-variables, readability-magic-numbers): benchmark registration
+BENCHMARK(BM_GameLoopHeadless)->RangeMultiplier(4)->Range(64, 1024)->Unit(benchmark::kMillisecond);
+// NOLINTEND(cppcoreguidelines-avoid-non-const-global-variables, readability-magic-numbers)
@@ -0,0 +1,88 @@
+#include "core/resourceManagement/ResourceCache.hpp"
+#include "core/resourceManagement/ResourceKey.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <memory>
+#include <string>
+
+namespace
+{
+
+/// \brief Stand-in for a cached resource, the lookup is measured, not the resource.
+struct Resource
+{
+    int value{ 0 };
+};
+
+using namespace sfa::literals;
+
+/// \brief Key every benchmark looks up, longer than the small string buffer like most resource paths.
+constexpr auto LOOKED_UP{ "textures/ui/button_pressed_128" };
+constexpr auto LOOKED_UP_KEY{ "textures/ui/button_pressed_128"_key };
+
+/// \brief Create a cache holding N resources named like \ref LOOKED_UP.
+std::unique_ptr<sfa::ResourceCache<Resource>> createCache(std::size_t count)
+{
+    auto cache{ std::make_unique<sfa::ResourceCache<Resource>>() };
+    for(std::size_t i{ 0 }; i < count; ++i)
+        cache->store("textures/ui/button_pressed_" + std::to_string(i), std::make_shared<Resource>());
+
+    return cache;
+}
+
+} // namespace
+
+/// \brief Look a literal up by copying it into a std::string first, like every lookup did before the cache accepted
+/// string views.
+static void BM_ResourceCacheLookupString(benchmark::State& state)
+{
+    const auto cache{ createCache(static_cast<std::size_t>(state.range(0))) };
+
+    for(auto _ : state)
+        benchmark::DoNotOptimize(cache->resolve(cache->handle(std::string{ LOOKED_UP })));
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+/// \brief Look a literal up as a string view, hashing and comparing the name without allocating.
+static void BM_ResourceCacheLookupStringView(benchmark::State& state)
+{
+    const auto cache{ createCache(static_cast<std::size_t>(state.range(0))) };
+
+    for(auto _ : state)
+        benchmark::DoNotOptimize(cache->resolve(cache->handle(LOOKED_UP)));
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+/// \brief Look a literal up through a \ref sfa::ResourceKey hashed at compile time, only comparing hashes.
+static void BM_ResourceCacheLookupKey(benchmark::State& state)
+{
+    const auto cache{ createCache(static_cast<std::size_t>(state.range(0))) };
+
+    for(auto _ : state)
+        benchmark::DoNotOptimize(cache->resolve(cache->handle(LOOKED_UP_KEY)));
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+/// \brief Resolve a handle that was looked up once, the cheapest way to access a resource every frame.
+static void BM_ResourceCacheResolveHandle(benchmark::State& state)
+{
+    const auto cache{ createCache(static_cast<std::size_t>(state.range(0))) };
+    const auto handle{ cache->handle(LOOKED_UP_KEY) };
+
+    for(auto _ : state)
+        benchmark::DoNotOptimize(cache->resolve(handle));
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-non-const-global-variables, readability-magic-numbers): benchmark registration
+BENCHMARK(BM_ResourceCacheLookupString)->Arg(256)->Arg(4096);
+BENCHMARK(BM_ResourceCacheLookupStringView)->Arg(256)->Arg(4096);
+BENCHMARK(BM_ResourceCacheLookupKey)->Arg(256)->Arg(4096);
+BENCHMARK(BM_ResourceCacheResolveHandle)->Arg(256)->Arg(4096);
+// NOLINTEND(cppcoreguidelines-avoid-non-const-global-variables, readability-magic-numbers)
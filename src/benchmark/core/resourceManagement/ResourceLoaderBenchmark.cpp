@@ -0,0 +1,192 @@
+#include "core/resourceManagement/ResourceLoader.hpp"
+#include "core/resourceManagement/AssetPackLoader.hpp"
+#include "core/resourceManagement/AssetPackWriter.hpp"
+#include "core/resourceManagement/IResourceLoader.hpp"
+#include "core/resourceManagement/IntermediateResourceData.hpp"
+#include "utility/JobCounter.hpp"
+#include "utility/ThreadPool.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <thread>
+#include <utility>
+#include <variant>
+#include <vector>
+
+namespace
+{
+
+/// \brief All PNGs that ship with the game, sorted so every run loads them in the same order.
+std::vector<std::filesystem::path> shippedTextures()
+{
+    std::vector<std::filesystem::path> textures;
+    for(const auto& entry : std::filesystem::recursive_directory_iterator{ SFA_ROOT "resources/textures" })
+    {
+        if(entry.is_regular_file() && entry.path().extension() == ".png")
+            textures.push_back(entry.path());
+    }
+
+    std::ranges::sort(textures);
+
+    return textures;
+}
+
+/// \brief Directory the shipped resources are in, packed entries are named relative to it.
+const std::filesystem::path RESOURCE_ROOT{ SFA_ROOT "resources" };
+/// \brief Stride with which the loaded pixels are touched, one byte per page.
+constexpr std::size_t PAGE_SIZE{ 4096 };
+
+/// \brief Bake every shipped PNG into a pack in the temporary directory once and return its path.
+const std::filesystem::path& shippedPack()
+{
+    static const auto pack{ []() {
+        const auto path{ std::filesystem::temp_directory_path() / "sfa_benchmark_resources.sfapack" };
+
+        sfa::ResourceLoader loader;
+        sfa::AssetPackWriter writer;
+        for(const auto& texture : shippedTextures())
+        {
+            if(const auto result{ loader.loadTexture(texture) })
+            {
+                writer.addTexture(
+                    texture.lexically_relative(RESOURCE_ROOT).generic_string(), std::get<sfa::TextureRawData>(*result)
+                );
+            }
+        }
+
+        return writer.write(path) ? path : std::filesystem::path{};
+    }() };
+
+    return pack;
+}
+
+/// \brief Load \p filepath and return the size of the decoded pixels, skipping the benchmark if loading fails.
+///
+/// One byte of every page of the pixels is read, so pixels that are only mapped are paged in like the upload would.
+std::int64_t loadTexture(benchmark::State& state, sfa::IResourceLoader& loader, const std::filesystem::path& filepath)
+{
+    const auto result{ loader.loadTexture(filepath) };
+    if(!result)
+    {
+        const auto message{ "Failed to load " + filepath.string() };
+        state.SkipWithError(message.c_str());
+        return 0;
+    }
+
+    const auto pixels{ std::get<sfa::TextureRawData>(*result).pixels.bytes() };
+    for(std::size_t i{ 0 }; i < pixels.size(); i += PAGE_SIZE)
+        benchmark::DoNotOptimize(pixels[i]);
+
+    return static_cast<std::int64_t>(pixels.size());
+}
+
+} // namespace
+
+/// \brief Decode every shipped PNG once per iteration.
+static void BM_ResourceLoaderLoadShippedTextures(benchmark::State& state)
+{
+    const auto textures{ shippedTextures() };
+    sfa::ResourceLoader loader;
+
+    std::int64_t decodedBytes{ 0 };
+    for(auto _ : state)
+    {
+        for(const auto& texture : textures)
+            decodedBytes += loadTexture(state, loader, texture);
+    }
+
+    state.SetBytesProcessed(decodedBytes);
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(textures.size()));
+}
+
+/// \brief Read every shipped PNG in one batch and decode them in parallel, like the texture pipeline of the
+/// \ref sfa::ResourceContext does.
+///
+/// Compared to \ref BM_ResourceLoaderLoadShippedTextures this shows how decoding scales over the cores.
+static void BM_ResourceLoaderDecodeShippedTexturesParallel(benchmark::State& state)
+{
+    const auto textures{ shippedTextures() };
+    sfa::ResourceLoader loader;
+    sfa::ThreadPool pool{ std::max(std::thread::hardware_concurrency(), 1u) };
+
+    std::atomic<std::int64_t> decodedBytes{ 0 };
+    for(auto _ : state)
+    {
+        auto files{ loader.readTextures(textures) };
+        if(!std::ranges::all_of(files, [](const auto& file) { return file.has_value(); }))
+        {
+            state.SkipWithError("Failed to read the shipped textures");
+            return;
+        }
+
+        sfa::JobCounter counter;
+        for(auto& file : files)
+        {
+            pool.submit(counter, [&loader, &file, &decodedBytes]() {
+                const auto result{ loader.decodeTexture(std::move(*file)) };
+                if(result)
+                {
+                    const auto size{ std::get<sfa::TextureRawData>(*result).pixels.size() };
+                    decodedBytes.fetch_add(static_cast<std::int64_t>(size), std::memory_order_relaxed);
+                }
+            });
+        }
+        pool.wait(counter);
+    }
+
+    state.SetBytesProcessed(decodedBytes.load(std::memory_order_relaxed));
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(textures.size()));
+}
+
+/// \brief Decode the largest shipped PNG, the background.
+static void BM_ResourceLoaderLoadBackground(benchmark::State& state)
+{
+    const std::filesystem::path texture{ SFA_ROOT "resources/textures/background.png" };
+    sfa::ResourceLoader loader;
+
+    std::int64_t decodedBytes{ 0 };
+    for(auto _ : state)
+        decodedBytes += loadTexture(state, loader, texture);
+
+    state.SetBytesProcessed(decodedBytes);
+}
+
+/// \brief Open the pack of every shipped PNG and load each of them once per iteration.
+///
+/// Compared to \ref BM_ResourceLoaderLoadShippedTextures this is the startup cost the pack saves. The pack stays in the
+/// page cache between iterations, so a truly cold start additionally pays for reading it from the disk once.
+static void BM_AssetPackLoadShippedTextures(benchmark::State& state)
+{
+    const auto textures{ shippedTextures() };
+    const auto& pack{ shippedPack() };
+
+    std::int64_t loadedBytes{ 0 };
+    for(auto _ : state)
+    {
+        auto loader{ sfa::AssetPackLoader::open(pack, RESOURCE_ROOT) };
+        if(!loader)
+        {
+            state.SkipWithError("Failed to open the asset pack");
+            return;
+        }
+
+        for(const auto& texture : textures)
+            loadedBytes += loadTexture(state, **loader, texture);
+    }
+
+    state.SetBytesProcessed(loadedBytes);
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(textures.size()));
+}
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-non-const-global-variables): benchmark registration
+BENCHMARK(BM_ResourceLoaderLoadShippedTextures)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_ResourceLoaderDecodeShippedTexturesParallel)->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK(BM_ResourceLoaderLoadBackground)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_AssetPackLoadShippedTextures)->Unit(benchmark::kMillisecond);
+// NOLINTEND(cppcoreguidelines-avoid-non-const-global-variables)
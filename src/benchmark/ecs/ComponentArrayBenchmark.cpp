@@ -0,0 +1,124 @@
+#include "ecs/ComponentArray.hpp"
+#include "ecs/ECSUtility.hpp"
+#include "ecs/components/TransformComponent.hpp"
+
+#include <benchmark/benchmark.h>
+#include <glm/glm.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <vector>
+
+namespace
+{
+
+constexpr std::uint32_t RNG_SEED{ 0xC0FFEEu };
+
+using TransformArray = sfa::ComponentArray<sfa::TransformComponent>;
+
+/// \brief Entities 1..count in random order, so lookups don't walk the dense array linearly.
+std::vector<sfa::EntityID> shuffledEntities(std::size_t count)
+{
+    std::vector<sfa::EntityID> entities(count);
+    std::iota(entities.begin(), entities.end(), sfa::EntityID{ 1 });
+    std::ranges::shuffle(entities, std::mt19937{ RNG_SEED });
+
+    return entities;
+}
+
+/// \brief Create a \ref ComponentArray holding a component for every entity in \p entities.
+///
+/// \note The array has a fixed capacity, it lives on the heap to not blow the stack.
+std::unique_ptr<TransformArray> createArray(const std::vector<sfa::EntityID>& entities)
+{
+    auto array{ std::make_unique<TransformArray>() };
+    for(const auto entity : entities)
+        array->insert(entity, { .position = glm::vec2(static_cast<float>(entity)) });
+
+    return array;
+}
+
+} // namespace
+
+/// \brief Insert a component for N entities into an empty array.
+static void BM_ComponentArrayInsert(benchmark::State& state)
+{
+    const auto entities{ shuffledEntities(static_cast<std::size_t>(state.range(0))) };
+    auto array{ std::make_unique<TransformArray>() };
+
+    for(auto _ : state)
+    {
+        for(const auto entity : entities)
+            array->insert(entity, {});
+
+        state.PauseTiming();
+        for(const auto entity : entities)
+            array->remove(entity);
+        state.ResumeTiming();
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+/// \brief Remove the components of N entities in random order, which swaps with the last element every time.
+static void BM_ComponentArrayRemove(benchmark::State& state)
+{
+    const auto entities{ shuffledEntities(static_cast<std::size_t>(state.range(0))) };
+    auto array{ std::make_unique<TransformArray>() };
+
+    for(auto _ : state)
+    {
+        state.PauseTiming();
+        for(const auto entity : entities)
+            array->insert(entity, {});
+        state.ResumeTiming();
+
+        for(const auto entity : entities)
+            array->remove(entity);
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+/// \brief Look up the components of N entities in random order.
+static void BM_ComponentArrayGet(benchmark::State& state)
+{
+    const auto entities{ shuffledEntities(static_cast<std::size_t>(state.range(0))) };
+    const auto array{ createArray(entities) };
+
+    for(auto _ : state)
+    {
+        for(const auto entity : entities)
+            benchmark::DoNotOptimize(array->get(entity));
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+/// \brief Iterate the dense storage of N components, which is what the systems do.
+static void BM_ComponentArrayIterate(benchmark::State& state)
+{
+    const auto array{ createArray(shuffledEntities(static_cast<std::size_t>(state.range(0)))) };
+
+    for(auto _ : state)
+    {
+        glm::vec2 sum{ 0.f };
+        for(const auto& transform : array->span())
+            sum += transform.position;
+
+        benchmark::DoNotOptimize(sum);
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-non-const-global-variables, readability-magic-numbers): benchmark registration
+BENCHMARK(BM_ComponentArrayInsert)->RangeMultiplier(4)->Range(64, 8192);
+BENCHMARK(BM_ComponentArrayRemove)->RangeMultiplier(4)->Range(64, 8192);
+BENCHMARK(BM_ComponentArrayGet)->RangeMultiplier(4)->Range(64, 8192);
+BENCHMARK(BM_ComponentArrayIterate)->RangeMultiplier(4)->Range(64, 8192);
+// NOLINTEND(cppcoreguidelines-avoid-non-const-global-variables, readability-magic-numbers)
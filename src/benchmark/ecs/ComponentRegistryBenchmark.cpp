@@ -0,0 +1,106 @@
+#include "ecs/ComponentRegistry.hpp"
+#include "ecs/ECSUtility.hpp"
+#include "ecs/components/BoxColliderComponent.hpp"
+#include "ecs/components/CircleColliderComponent.hpp"
+#include "ecs/components/HealthComponent.hpp"
+#include "ecs/components/SpriteComponent.hpp"
+#include "ecs/components/TransformComponent.hpp"
+#include "ecs/components/UIHierarchyComponent.hpp"
+#include "ecs/components/UITransformComponent.hpp"
+#include "ecs/components/VelocityComponent.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <vector>
+
+namespace
+{
+
+constexpr std::uint32_t RNG_SEED{ 0xC0FFEEu };
+
+/// \brief Create a registry with as many component types as a real scene and N entities with a transform.
+///
+/// Every second entity also gets a velocity, so \ref ComponentRegistry::contains has hits and misses.
+std::unique_ptr<sfa::ComponentRegistry> createRegistry(const std::vector<sfa::EntityID>& entities)
+{
+    auto registry{ std::make_unique<sfa::ComponentRegistry>() };
+    registry->registerComponent<sfa::BoxColliderComponent>();
+    registry->registerComponent<sfa::CircleColliderComponent>();
+    registry->registerComponent<sfa::HealthComponent>();
+    registry->registerComponent<sfa::SpriteComponent>();
+    registry->registerComponent<sfa::TransformComponent>();
+    registry->registerComponent<sfa::UIHierarchyComponent>();
+    registry->registerComponent<sfa::UITransformComponent>();
+    registry->registerComponent<sfa::VelocityComponent>();
+
+    for(const auto entity : entities)
+    {
+        registry->addComponent<sfa::TransformComponent>(entity, {});
+        if(entity % 2 == 0)
+            registry->addComponent<sfa::VelocityComponent>(entity, {});
+    }
+
+    return registry;
+}
+
+std::vector<sfa::EntityID> shuffledEntities(std::size_t count)
+{
+    std::vector<sfa::EntityID> entities(count);
+    std::iota(entities.begin(), entities.end(), sfa::EntityID{ 1 });
+    std::ranges::shuffle(entities, std::mt19937{ RNG_SEED });
+
+    return entities;
+}
+
+} // namespace
+
+/// \brief Per-entity component access through the registry, which pays the type lookup on every call.
+static void BM_ComponentRegistryGetComponent(benchmark::State& state)
+{
+    const auto entities{ shuffledEntities(static_cast<std::size_t>(state.range(0))) };
+    const auto registry{ createRegistry(entities) };
+
+    for(auto _ : state)
+    {
+        for(const auto entity : entities)
+            benchmark::DoNotOptimize(registry->getComponent<sfa::TransformComponent>(entity));
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+/// \brief Per-entity membership checks through the registry, half of them miss.
+static void BM_ComponentRegistryContains(benchmark::State& state)
+{
+    const auto entities{ shuffledEntities(static_cast<std::size_t>(state.range(0))) };
+    const auto registry{ createRegistry(entities) };
+
+    for(auto _ : state)
+    {
+        for(const auto entity : entities)
+            benchmark::DoNotOptimize(registry->contains<sfa::VelocityComponent>(entity));
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+/// \brief The type lookup alone, which the systems pay once per update.
+static void BM_ComponentRegistryGetComponentArray(benchmark::State& state)
+{
+    const auto registry{ createRegistry({}) };
+
+    for(auto _ : state)
+        benchmark::DoNotOptimize(&registry->getComponentArray<sfa::TransformComponent>());
+}
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-non-const-global-variables, readability-magic-numbers): benchmark registration
+BENCHMARK(BM_ComponentRegistryGetComponent)->RangeMultiplier(4)->Range(64, 8192);
+BENCHMARK(BM_ComponentRegistryContains)->RangeMultiplier(4)->Range(64, 8192);
+BENCHMARK(BM_ComponentRegistryGetComponentArray);
+// NOLINTEND(cppcoreguidelines-avoid-non-const-global-variables, readability-magic-numbers)
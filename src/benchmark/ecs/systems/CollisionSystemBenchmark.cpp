@@ -0,0 +1,97 @@
+#include "ecs/systems/CollisionSystem.hpp"
+#include "ecs/CollisionLayers.hpp"
+#include "ecs/ComponentRegistry.hpp"
+#include "ecs/ECSUtility.hpp"
+#include "ecs/components/BoxColliderComponent.hpp"
+#include "ecs/components/CircleColliderComponent.hpp"
+#include "ecs/components/TransformComponent.hpp"
+
+#include <benchmark/benchmark.h>
+#include <glm/glm.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <random>
+
+namespace
+{
+
+constexpr std::uint32_t RNG_SEED{ 0xC0FFEEu };
+constexpr auto WORLD_SIZE{ 1000.f };
+constexpr glm::vec2 COLLIDER_SIZE{ 8.f };
+
+/// \brief Number of layers the colliders are spread across in the filtered benchmark.
+///
+/// Every layer only accepts itself, so with equally sized layers ~90% of all candidate pairs are between layers that
+/// reject each other.
+constexpr std::size_t FILTERED_LAYERS{ 10 };
+
+/// \brief Create a registry with \p count box colliders at random positions.
+///
+/// \param count how many colliders to create
+/// \param layers across how many layers the colliders are spread, each layer only accepts itself
+///
+/// \returns \ref ComponentRegistry populated with the colliders
+std::unique_ptr<sfa::ComponentRegistry> createColliders(std::size_t count, std::size_t layers)
+{
+    auto registry{ std::make_unique<sfa::ComponentRegistry>() };
+    registry->registerComponent<sfa::TransformComponent>();
+    registry->registerComponent<sfa::BoxColliderComponent>();
+    registry->registerComponent<sfa::CircleColliderComponent>();
+
+    std::mt19937 rng{ RNG_SEED };
+    std::uniform_real_distribution<float> dist{ 0.f, WORLD_SIZE };
+
+    for(std::size_t i{ 0 }; i < count; ++i)
+    {
+        const auto entity{ static_cast<sfa::EntityID>(i + 1) };
+        const auto layer{ sfa::collisionLayer(i % layers) };
+
+        registry->addComponent<sfa::TransformComponent>(entity, { .position = { dist(rng), dist(rng) } });
+        registry->addComponent<sfa::BoxColliderComponent>(
+            entity, { .size = COLLIDER_SIZE, .category = layer, .mask = layer }
+        );
+    }
+
+    return registry;
+}
+
+/// \brief Run the \ref CollisionSystem on colliders that are spread across \p layers layers.
+void runCollisionBenchmark(benchmark::State& state, std::size_t layers)
+{
+    const auto count{ static_cast<std::size_t>(state.range(0)) };
+    const auto registry{ createColliders(count, layers) };
+    sfa::CollisionSystem system;
+
+    for(auto _ : state)
+    {
+        system.update(*registry);
+        benchmark::DoNotOptimize(system.contacts().data());
+    }
+
+    const auto candidatePairs{ static_cast<double>(count * (count - 1) / 2) };
+    state.counters["narrowPhaseTests"] = static_cast<double>(system.narrowPhaseTests());
+    state.counters["rejectedByLayer"] = 1.0 - (static_cast<double>(system.narrowPhaseTests()) / candidatePairs);
+    state.counters["contacts"] = static_cast<double>(system.contacts().size());
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+} // namespace
+
+/// \brief Baseline where all colliders share the default layer, so every candidate pair reaches the narrow phase.
+static void BM_CollisionSystemSingleLayer(benchmark::State& state)
+{
+    runCollisionBenchmark(state, 1);
+}
+
+/// \brief Colliders spread across layers that only accept themselves, so ~90% of candidate pairs are rejected by layer.
+static void BM_CollisionSystemLayerFiltered(benchmark::State& state)
+{
+    runCollisionBenchmark(state, FILTERED_LAYERS);
+}
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-non-const-global-variables, readability-magic-numbers): benchmark registration
+BENCHMARK(BM_CollisionSystemSingleLayer)->RangeMultiplier(2)->Range(256, 4096);
+BENCHMARK(BM_CollisionSystemLayerFiltered)->RangeMultiplier(2)->Range(256, 4096);
+// NOLINTEND(cppcoreguidelines-avoid-non-const-global-variables, readability-magic-numbers)
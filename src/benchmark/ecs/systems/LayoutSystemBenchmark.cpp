@@ -0,0 +1,32 @@
+#include "ecs/systems/LayoutSystem.hpp"
+#include "benchmarkUtility/UITreeFactory.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+
+/// \brief Lay out a tree of the given depth (arg 0) and fanout (arg 1).
+static void BM_LayoutSystemTree(benchmark::State& state)
+{
+    const auto registry{ sfa::benchmarking::createUITree(
+        static_cast<std::size_t>(state.range(0)), static_cast<std::size_t>(state.range(1))
+    ) };
+
+    for(auto _ : state)
+    {
+        sfa::LayoutSystem::update(*registry);
+        benchmark::ClobberMemory();
+    }
+
+    state.counters["nodes"] = static_cast<double>(registry->getComponentArray<sfa::UITransformComponent>().size());
+}
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-non-const-global-variables, readability-magic-numbers): benchmark registration
+// NOTE: Wide and shallow menus, a balanced binary tree and a chain that is as deep as the component arrays allow
+BENCHMARK(BM_LayoutSystemTree)
+    ->ArgNames({ "depth", "fanout" })
+    ->Args({ 2, 16 })
+    ->Args({ 6, 4 })
+    ->Args({ 12, 2 })
+    ->Args({ 4096, 1 });
+// NOLINTEND(cppcoreguidelines-avoid-non-const-global-variables, readability-magic-numbers)
@@ -0,0 +1,74 @@
+#include "ecs/systems/MovementSystem.hpp"
+#include "ecs/ComponentRegistry.hpp"
+#include "ecs/ECSUtility.hpp"
+#include "ecs/components/TransformComponent.hpp"
+#include "ecs/components/VelocityComponent.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <random>
+
+namespace
+{
+
+constexpr std::uint32_t RNG_SEED{ 0xC0FFEEu };
+constexpr auto MAX_SPEED{ 50.f };
+constexpr auto DELTA_TIME{ 1.f / 120.f };
+
+/// \brief Create a registry with \p count transforms, of which every \p velocityStride-th entity also moves.
+std::unique_ptr<sfa::ComponentRegistry> createMovers(std::size_t count, std::size_t velocityStride)
+{
+    auto registry{ std::make_unique<sfa::ComponentRegistry>() };
+    registry->registerComponent<sfa::TransformComponent>();
+    registry->registerComponent<sfa::VelocityComponent>();
+
+    std::mt19937 rng{ RNG_SEED };
+    std::uniform_real_distribution<float> speed{ -MAX_SPEED, MAX_SPEED };
+
+    for(std::size_t i{ 0 }; i < count; ++i)
+    {
+        const auto entity{ static_cast<sfa::EntityID>(i + 1) };
+
+        registry->addComponent<sfa::TransformComponent>(entity, {});
+        if(i % velocityStride == 0)
+            registry->addComponent<sfa::VelocityComponent>(entity, { .linear = { speed(rng), speed(rng) } });
+    }
+
+    return registry;
+}
+
+void runMovementBenchmark(benchmark::State& state, std::size_t velocityStride)
+{
+    const auto registry{ createMovers(static_cast<std::size_t>(state.range(0)), velocityStride) };
+
+    for(auto _ : state)
+    {
+        sfa::MovementSystem::update(*registry, DELTA_TIME);
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+} // namespace
+
+/// \brief Every entity moves.
+static void BM_MovementSystemAllMoving(benchmark::State& state)
+{
+    runMovementBenchmark(state, 1);
+}
+
+/// \brief Only every fourth entity moves, the rest are static scenery the system still has to skip.
+static void BM_MovementSystemSparse(benchmark::State& state)
+{
+    constexpr std::size_t STRIDE{ 4 };
+    runMovementBenchmark(state, STRIDE);
+}
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-non-const-global-variables, readability-magic-numbers): benchmark registration
+BENCHMARK(BM_MovementSystemAllMoving)->RangeMultiplier(4)->Range(16, 8192);
+BENCHMARK(BM_MovementSystemSparse)->RangeMultiplier(4)->Range(16, 8192);
+// NOLINTEND(cppcoreguidelines-avoid-non-const-global-variables, readability-magic-numbers)
@@ -0,0 +1,62 @@
+#include "ecs/systems/SpriteRenderSystem.hpp"
+#include "core/NullRenderer.hpp"
+#include "ecs/ComponentRegistry.hpp"
+#include "ecs/ECSUtility.hpp"
+#include "ecs/components/SpriteComponent.hpp"
+#include "ecs/components/TransformComponent.hpp"
+
+#include <benchmark/benchmark.h>
+#include <glm/glm.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <random>
+
+namespace
+{
+
+constexpr std::uint32_t RNG_SEED{ 0xC0FFEEu };
+constexpr auto WORLD_SIZE{ 1000.f };
+constexpr unsigned int RENDER_LAYERS{ 8 };
+
+std::unique_ptr<sfa::ComponentRegistry> createSprites(std::size_t count)
+{
+    auto registry{ std::make_unique<sfa::ComponentRegistry>() };
+    registry->registerComponent<sfa::TransformComponent>();
+    registry->registerComponent<sfa::SpriteComponent>();
+
+    std::mt19937 rng{ RNG_SEED };
+    std::uniform_real_distribution<float> position{ 0.f, WORLD_SIZE };
+    std::uniform_int_distribution<unsigned int> layer{ 0, RENDER_LAYERS - 1 };
+
+    for(std::size_t i{ 0 }; i < count; ++i)
+    {
+        const auto entity{ static_cast<sfa::EntityID>(i + 1) };
+
+        registry->addComponent<sfa::TransformComponent>(entity, { .position = { position(rng), position(rng) } });
+        registry->addComponent<sfa::SpriteComponent>(entity, { .texture = nullptr, .renderLayer = layer(rng) });
+    }
+
+    return registry;
+}
+
+} // namespace
+
+/// \brief CPU side of sprite rendering (gather, sort by layer, interpolate, submit) through the null renderer.
+static void BM_SpriteRenderSystemSubmit(benchmark::State& state)
+{
+    constexpr auto ALPHA{ 0.5f };
+
+    const auto registry{ createSprites(static_cast<std::size_t>(state.range(0))) };
+    sfa::SpriteRenderSystem system{ std::make_unique<sfa::NullSpriteRenderer>() };
+
+    for(auto _ : state)
+        system.render(*registry, glm::mat4(1.f), ALPHA);
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-non-const-global-variables, readability-magic-numbers): benchmark registration
+BENCHMARK(BM_SpriteRenderSystemSubmit)->RangeMultiplier(4)->Range(64, 8192);
+// NOLINTEND(cppcoreguidelines-avoid-non-const-global-variables, readability-magic-numbers)
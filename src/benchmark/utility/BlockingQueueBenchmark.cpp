@@ -0,0 +1,103 @@
+#include "utility/BlockingQueue.hpp"
+#include "utility/details/Threading.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <vector>
+
+namespace
+{
+
+constexpr std::size_t ITEMS_PER_PRODUCER{ 10'000 };
+
+} // namespace
+
+/// \brief Every benchmark thread pushes and pops on one shared queue, so all of them fight over the same lock.
+static void BM_BlockingQueuePushPop(benchmark::State& state)
+{
+    static sfa::BlockingQueue<std::uint64_t> queue;
+
+    std::uint64_t value{ 0 };
+    for(auto _ : state)
+    {
+        queue.push(value++);
+        benchmark::DoNotOptimize(queue.tryPop());
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+/// \brief N producers push into one queue that a single consumer drains, like loader tasks feeding the upload queue.
+static void BM_BlockingQueueProducersConsumer(benchmark::State& state)
+{
+    const auto producers{ static_cast<std::size_t>(state.range(0)) };
+    const auto total{ producers * ITEMS_PER_PRODUCER };
+
+    for(auto _ : state)
+    {
+        sfa::BlockingQueue<std::uint64_t> queue;
+
+        std::vector<sfa::threading::thread_t> threads;
+        threads.reserve(producers);
+        for(std::size_t p{ 0 }; p < producers; ++p)
+        {
+            threads.emplace_back([&queue] {
+                for(std::uint64_t i{ 0 }; i < ITEMS_PER_PRODUCER; ++i)
+                    queue.push(i);
+            });
+        }
+
+        std::uint64_t sum{ 0 };
+        for(std::size_t i{ 0 }; i < total; ++i)
+            sum += *queue.waitAndPop();
+
+        benchmark::DoNotOptimize(sum);
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(total));
+}
+
+/// \brief A per-frame consumer emptying a queue of N elements, one pop at a time versus a single batch.
+///
+/// \tparam MODE 0 := tryPop per element, 1 := drainInto a vector, 2 := takeAll swapping the buffer
+template<int MODE>
+static void BM_BlockingQueueDrain(benchmark::State& state)
+{
+    const auto count{ static_cast<std::uint64_t>(state.range(0)) };
+
+    sfa::BlockingQueue<std::uint64_t> queue;
+    std::vector<std::uint64_t> batch;
+    std::deque<std::uint64_t> buffer;
+
+    for(auto _ : state)
+    {
+        state.PauseTiming();
+        for(std::uint64_t i{ 0 }; i < count; ++i)
+            queue.push(i);
+        batch.clear();
+        state.ResumeTiming();
+
+        if constexpr(MODE == 0)
+        {
+            while(const auto value{ queue.tryPop() })
+                benchmark::DoNotOptimize(*value);
+        }
+        else if constexpr(MODE == 1)
+            benchmark::DoNotOptimize(queue.drainInto(batch));
+        else
+            benchmark::DoNotOptimize(queue.takeAll(buffer));
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-non-const-global-variables, readability-magic-numbers): benchmark registration
+BENCHMARK(BM_BlockingQueuePushPop)->ThreadRange(1, 16)->UseRealTime();
+BENCHMARK(BM_BlockingQueueProducersConsumer)->ArgName("producers")->RangeMultiplier(2)->Range(1, 16)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_BlockingQueueDrain, 0)->RangeMultiplier(8)->Range(8, 4096);
+BENCHMARK_TEMPLATE(BM_BlockingQueueDrain, 1)->RangeMultiplier(8)->Range(8, 4096);
+BENCHMARK_TEMPLATE(BM_BlockingQueueDrain, 2)->RangeMultiplier(8)->Range(8, 4096);
+// NOLINTEND(cppcoreguidelines-avoid-non-const-global-variables, readability-magic-numbers)
@@ -0,0 +1,71 @@
+#include "utility/MPMCQueue.hpp"
+#include "utility/details/Threading.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+namespace
+{
+
+constexpr std::size_t ITEMS_PER_PRODUCER{ 10'000 };
+constexpr std::size_t CAPACITY{ 1024 };
+
+} // namespace
+
+/// \brief Every benchmark thread pushes and pops on one shared queue, compare with BM_BlockingQueuePushPop.
+static void BM_MPMCQueuePushPop(benchmark::State& state)
+{
+    static sfa::MPMCQueue<std::uint64_t> queue{ CAPACITY };
+
+    std::uint64_t value{ 0 };
+    for(auto _ : state)
+    {
+        benchmark::DoNotOptimize(queue.push(value++));
+        benchmark::DoNotOptimize(queue.tryPop());
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+/// \brief N producers push into one queue that a single sleeping consumer drains, compare with
+/// BM_BlockingQueueProducersConsumer.
+static void BM_MPMCQueueProducersConsumer(benchmark::State& state)
+{
+    const auto producers{ static_cast<std::size_t>(state.range(0)) };
+    const auto total{ producers * ITEMS_PER_PRODUCER };
+
+    for(auto _ : state)
+    {
+        sfa::MPMCQueue<std::uint64_t> queue{ CAPACITY };
+
+        std::vector<sfa::threading::thread_t> threads;
+        threads.reserve(producers);
+        for(std::size_t p{ 0 }; p < producers; ++p)
+        {
+            threads.emplace_back([&queue] {
+                for(std::uint64_t i{ 0 }; i < ITEMS_PER_PRODUCER; ++i)
+                {
+                    while(!queue.push(i))
+                        std::this_thread::yield();
+                }
+            });
+        }
+
+        std::uint64_t sum{ 0 };
+        for(std::size_t i{ 0 }; i < total; ++i)
+            sum += *queue.waitAndPop();
+
+        benchmark::DoNotOptimize(sum);
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(total));
+}
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-non-const-global-variables, readability-magic-numbers): benchmark registration
+BENCHMARK(BM_MPMCQueuePushPop)->ThreadRange(1, 16)->UseRealTime();
+BENCHMARK(BM_MPMCQueueProducersConsumer)->ArgName("producers")->RangeMultiplier(2)->Range(1, 16)->UseRealTime();
+// NOLINTEND(cppcoreguidelines-avoid-non-const-global-variables, readability-magic-numbers)
@@ -0,0 +1,61 @@
+#include "utility/SPSCQueue.hpp"
+#include "utility/details/Threading.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+
+namespace
+{
+
+constexpr std::size_t ITEMS{ 100'000 };
+constexpr std::size_t CAPACITY{ 1024 };
+
+} // namespace
+
+/// \brief Push and pop on the same thread, the uncontended cost of a single transfer.
+static void BM_SPSCQueuePushPop(benchmark::State& state)
+{
+    sfa::SPSCQueue<std::uint64_t> queue{ CAPACITY };
+
+    std::uint64_t value{ 0 };
+    for(auto _ : state)
+    {
+        benchmark::DoNotOptimize(queue.push(value++));
+        benchmark::DoNotOptimize(queue.tryPop());
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+/// \brief One producer streams into one sleeping consumer, e.g. a dedicated decode thread feeding the main thread.
+static void BM_SPSCQueueProducerConsumer(benchmark::State& state)
+{
+    for(auto _ : state)
+    {
+        sfa::SPSCQueue<std::uint64_t> queue{ CAPACITY };
+
+        sfa::threading::thread_t producer{ [&queue] {
+            for(std::uint64_t i{ 0 }; i < ITEMS; ++i)
+            {
+                while(!queue.push(i))
+                    std::this_thread::yield();
+            }
+        } };
+
+        std::uint64_t sum{ 0 };
+        for(std::size_t i{ 0 }; i < ITEMS; ++i)
+            sum += *queue.waitAndPop();
+
+        benchmark::DoNotOptimize(sum);
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(ITEMS));
+}
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-non-const-global-variables): benchmark registration
+BENCHMARK(BM_SPSCQueuePushPop);
+BENCHMARK(BM_SPSCQueueProducerConsumer)->UseRealTime();
+// NOLINTEND(cppcoreguidelines-avoid-non-const-global-variables)
@@ -0,0 +1,164 @@
+#include "utility/ThreadPool.hpp"
+
+#include "benchmarkUtility/LockedThreadPool.hpp"
+#include "utility/JobCounter.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <future>
+#include <thread>
+#include <vector>
+
+namespace
+{
+
+constexpr std::size_t JOBS_PER_ITERATION{ 1024 };
+
+/// \brief Wait until \p done reached \p expected.
+void waitFor(const std::atomic<std::size_t>& done, std::size_t expected)
+{
+    while(done.load(std::memory_order_acquire) != expected)
+        std::this_thread::yield();
+}
+
+} // namespace
+
+/// \brief Submit a batch of empty jobs and wait for all of them, with N workers.
+///
+/// The jobs don't do any work, so this measures the overhead per job: allocation, queue lock and wake up.
+///
+/// \tparam Pool \ref sfa::ThreadPool or the \ref sfa::benchmarking::LockedThreadPool baseline
+template<typename Pool>
+static void BM_ThreadPoolEnqueue(benchmark::State& state)
+{
+    Pool pool{ static_cast<std::size_t>(state.range(0)) };
+    std::vector<std::future<void>> futures;
+    futures.reserve(JOBS_PER_ITERATION);
+
+    for(auto _ : state)
+    {
+        for(std::size_t i{ 0 }; i < JOBS_PER_ITERATION; ++i)
+            futures.push_back(pool.enqueue([] {}));
+
+        for(auto& future : futures)
+            future.get();
+        futures.clear();
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(JOBS_PER_ITERATION));
+}
+
+/// \brief Submit a batch of empty jobs from the benchmark threads into one shared pool.
+///
+/// Measures contention on the queue when several threads submit at the same time, e.g. loader tasks that schedule
+/// follow-up work.
+template<typename Pool>
+static void BM_ThreadPoolEnqueueContended(benchmark::State& state)
+{
+    constexpr std::size_t WORKERS{ 4 };
+    static Pool pool{ WORKERS };
+
+    std::atomic<std::size_t> done{ 0 };
+    for(auto _ : state)
+    {
+        done.store(0, std::memory_order_relaxed);
+        for(std::size_t i{ 0 }; i < JOBS_PER_ITERATION; ++i)
+            static_cast<void>(pool.enqueue([&done] { done.fetch_add(1, std::memory_order_release); }));
+
+        waitFor(done, JOBS_PER_ITERATION);
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(JOBS_PER_ITERATION));
+}
+
+/// \brief One job forks a batch of child jobs from inside the pool, like a parallel ECS iteration or image decode.
+///
+/// The work-stealing pool keeps the children on the forking worker's deque, the baseline pushes them through the
+/// shared queue.
+template<typename Pool>
+static void BM_ThreadPoolForkJoin(benchmark::State& state)
+{
+    Pool pool{ static_cast<std::size_t>(state.range(0)) };
+
+    std::atomic<std::size_t> done{ 0 };
+    for(auto _ : state)
+    {
+        done.store(0, std::memory_order_relaxed);
+        static_cast<void>(pool.enqueue([&pool, &done] {
+            for(std::size_t i{ 0 }; i < JOBS_PER_ITERATION; ++i)
+                static_cast<void>(pool.enqueue([&done] { done.fetch_add(1, std::memory_order_release); }));
+        }));
+
+        waitFor(done, JOBS_PER_ITERATION);
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(JOBS_PER_ITERATION));
+}
+
+/// \brief Submit a batch of empty fire-and-forget jobs tracked by a \ref sfa::JobCounter, with N workers.
+///
+/// Same workload as \ref BM_ThreadPoolEnqueue, without the packaged task and future allocated per job.
+static void BM_ThreadPoolSubmit(benchmark::State& state)
+{
+    sfa::ThreadPool pool{ static_cast<std::size_t>(state.range(0)) };
+    sfa::JobCounter counter;
+
+    for(auto _ : state)
+    {
+        for(std::size_t i{ 0 }; i < JOBS_PER_ITERATION; ++i)
+            pool.submit(counter, [] {});
+
+        counter.wait();
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(JOBS_PER_ITERATION));
+}
+
+/// \brief Latency of a single job: time from enqueue until the future is ready, one job in flight at a time.
+template<typename Pool>
+static void BM_ThreadPoolRoundTrip(benchmark::State& state)
+{
+    Pool pool{ static_cast<std::size_t>(state.range(0)) };
+
+    for(auto _ : state)
+        pool.enqueue([] {}).get();
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-non-const-global-variables, readability-magic-numbers): benchmark registration
+BENCHMARK_TEMPLATE(BM_ThreadPoolEnqueue, sfa::ThreadPool)
+    ->ArgName("workers")
+    ->RangeMultiplier(2)
+    ->Range(1, 8)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_ThreadPoolEnqueue, sfa::benchmarking::LockedThreadPool)
+    ->ArgName("workers")
+    ->RangeMultiplier(2)
+    ->Range(1, 8)
+    ->UseRealTime();
+BENCHMARK(BM_ThreadPoolSubmit)->ArgName("workers")->RangeMultiplier(2)->Range(1, 8)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_ThreadPoolEnqueueContended, sfa::ThreadPool)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_ThreadPoolEnqueueContended, sfa::benchmarking::LockedThreadPool)
+    ->ThreadRange(1, 8)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_ThreadPoolForkJoin, sfa::ThreadPool)
+    ->ArgName("workers")
+    ->RangeMultiplier(2)
+    ->Range(1, 8)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_ThreadPoolForkJoin, sfa::benchmarking::LockedThreadPool)
+    ->ArgName("workers")
+    ->RangeMultiplier(2)
+    ->Range(1, 8)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_ThreadPoolRoundTrip, sfa::ThreadPool)->ArgName("workers")->Arg(1)->Arg(4)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_ThreadPoolRoundTrip, sfa::benchmarking::LockedThreadPool)
+    ->ArgName("workers")
+    ->Arg(1)
+    ->Arg(4)
+    ->UseRealTime();
+// NOLINTEND(cppcoreguidelines-avoid-non-const-global-variables, readability-magic-numbers)
@@ -0,0 +1,49 @@
+#include "GLTimerQueries.hpp"
+
+#include <glad/gl.h>
+
+#include <cstdint>
+
+namespace sfa
+{
+
+std::uint32_t GLTimerQueries::create()
+{
+    GLuint query{ 0 };
+    glGenQueries(1, &query);
+
+    return query;
+}
+
+void GLTimerQueries::destroy(std::uint32_t query)
+{
+    glDeleteQueries(1, &query);
+}
+
+void GLTimerQueries::begin(std::uint32_t query)
+{
+    glBeginQuery(GL_TIME_ELAPSED, query);
+}
+
+void GLTimerQueries::end(std::uint32_t /*query*/)
+{
+    glEndQuery(GL_TIME_ELAPSED);
+}
+
+bool GLTimerQueries::available(std::uint32_t query)
+{
+    GLint available{ GL_FALSE };
+    glGetQueryObjectiv(query, GL_QUERY_RESULT_AVAILABLE, &available);
+
+    return available != GL_FALSE;
+}
+
+std::uint64_t GLTimerQueries::elapsedNs(std::uint32_t query)
+{
+    GLuint64 elapsed{ 0 };
+    glGetQueryObjectui64v(query, GL_QUERY_RESULT, &elapsed);
+
+    return elapsed;
+}
+
+} // namespace sfa
@@ -0,0 +1,38 @@
+#ifndef SFA_SRC_ENGINE_CORE_GL_TIMER_QUERIES_HPP
+#define SFA_SRC_ENGINE_CORE_GL_TIMER_QUERIES_HPP
+
+#include "core/IGpuTimerQueries.hpp"
+
+#include <cstdint>
+
+namespace sfa
+{
+
+/// \brief \ref IGpuTimerQueries backed by OpenGL GL_TIME_ELAPSED queries (core since OpenGL 3.3).
+///
+/// \author Felix Hommel
+/// \date 3/12/2026
+class GLTimerQueries : public IGpuTimerQueries
+{
+public:
+    GLTimerQueries() = default;
+    ~GLTimerQueries() override = default;
+
+    GLTimerQueries(const GLTimerQueries&) = delete;
+    GLTimerQueries& operator=(const GLTimerQueries&) = delete;
+    GLTimerQueries(GLTimerQueries&&) = delete;
+    GLTimerQueries& operator=(GLTimerQueries&&) = delete;
+
+    [[nodiscard]] std::uint32_t create() override;
+    void destroy(std::uint32_t query) override;
+
+    void begin(std::uint32_t query) override;
+    void end(std::uint32_t query) override;
+
+    [[nodiscard]] bool available(std::uint32_t query) override;
+    [[nodiscard]] std::uint64_t elapsedNs(std::uint32_t query) override;
+};
+
+} // namespace sfa
+
+#endif // !SFA_SRC_ENGINE_CORE_GL_TIMER_QUERIES_HPP
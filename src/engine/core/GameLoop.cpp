@@ -0,0 +1,86 @@
+#include "GameLoop.hpp"
+
+#include "core/Profiler.hpp"
+#include "core/Utility.hpp"
+
+#include <cstdint>
+
+namespace sfa
+{
+
+GameLoop::GameLoop(GameLoopConfig config)
+    : m_config{ config }
+    , m_fixedStep{ 1.0 / config.simulationRate }
+{
+    SFA_ASSERT(config.simulationRate > 0.0, "The simulation rate has to be positive");
+    SFA_ASSERT(config.maxStepsPerFrame > 0, "At least one simulation step per frame is required");
+}
+
+FrameStats GameLoop::tick(const StepFunction& step)
+{
+    const auto now{ Clock::now() };
+
+    if(!m_running)
+    {
+        m_running = true;
+        m_lastTick = now;
+
+        return {};
+    }
+
+    const Duration frameTime{ now - m_lastTick };
+    m_lastTick = now;
+
+    return advance(frameTime, step);
+}
+
+FrameStats GameLoop::advance(Duration frameTime, const StepFunction& step)
+{
+    FrameStats stats{};
+
+    m_accumulator += frameTime;
+
+    // NOTE: Clamp before stepping so a long stall (debugger, window drag) can't queue up more work than a frame allows
+    const Duration maxAccumulated{ m_fixedStep * static_cast<double>(m_config.maxStepsPerFrame) };
+    if(m_accumulator > maxAccumulated)
+    {
+        m_droppedTime += m_accumulator - maxAccumulated;
+        m_accumulator = maxAccumulated;
+        stats.clamped = true;
+    }
+
+    const auto dt{ fixedDeltaTime() };
+    while(m_accumulator >= m_fixedStep)
+    {
+        SFA_PROFILE_SCOPE("GameLoop::step");
+
+        step(dt);
+
+        m_accumulator -= m_fixedStep;
+        ++stats.steps;
+    }
+
+    m_totalSteps += stats.steps;
+    stats.alpha = static_cast<float>(m_accumulator / m_fixedStep);
+
+    return stats;
+}
+
+void GameLoop::runHeadless(std::uint64_t stepCount, const StepFunction& step)
+{
+    const auto dt{ fixedDeltaTime() };
+
+    for(std::uint64_t i{ 0 }; i < stepCount; ++i)
+        step(dt);
+
+    m_totalSteps += stepCount;
+}
+
+void GameLoop::reset() noexcept
+{
+    m_accumulator = Duration::zero();
+    m_droppedTime = Duration::zero();
+    m_running = false;
+}
+
+} // namespace sfa
@@ -0,0 +1,110 @@
+#ifndef SFA_SRC_ENGINE_CORE_GAME_LOOP_HPP
+#define SFA_SRC_ENGINE_CORE_GAME_LOOP_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+namespace sfa
+{
+
+/// \brief Configuration of a \ref GameLoop.
+///
+/// \author Felix Hommel
+/// \date 3/9/2026
+struct GameLoopConfig
+{
+    /// \brief How many simulation steps are run per second of real time.
+    double simulationRate{ 120.0 };
+    /// \brief Upper bound of simulation steps per frame. Real time beyond that is dropped (spiral-of-death clamp).
+    std::size_t maxStepsPerFrame{ 8 };
+};
+
+/// \brief Summary of one frame advanced by a \ref GameLoop.
+///
+/// \author Felix Hommel
+/// \date 3/9/2026
+struct FrameStats
+{
+    /// \brief How many fixed simulation steps were run during this frame.
+    std::size_t steps{ 0 };
+    /// \brief How far the render state lies between the last two simulation states, in the range [0, 1).
+    float alpha{ 0.f };
+    /// \brief Whether real time had to be dropped because \ref GameLoopConfig::maxStepsPerFrame was reached.
+    bool clamped{ false };
+};
+
+/// \brief Fixed-timestep simulation loop.
+///
+/// The simulation is advanced in constant steps of 1 / \ref GameLoopConfig::simulationRate seconds, decoupled from the
+/// rate at which frames are rendered. Real time is accumulated every frame and consumed in whole steps; the remainder
+/// is reported as the interpolation factor which the renderer uses to blend between the previous and current
+/// simulation state. When the simulation can't keep up, the accumulated time is clamped so a slow frame can't snowball
+/// into ever longer frames.
+///
+/// The loop doesn't own a window, so the same simulation can also be run headless at maximum speed via
+/// \ref GameLoop::runHeadless.
+///
+/// \author Felix Hommel
+/// \date 3/9/2026
+class GameLoop
+{
+public:
+    using Clock = std::chrono::steady_clock;
+    using Duration = std::chrono::duration<double>;
+    using StepFunction = std::function<void(float dt)>;
+
+    explicit GameLoop(GameLoopConfig config = {});
+    ~GameLoop() = default;
+
+    GameLoop(const GameLoop&) = delete;
+    GameLoop& operator=(const GameLoop&) = delete;
+    GameLoop(GameLoop&&) = delete;
+    GameLoop& operator=(GameLoop&&) = delete;
+
+    /// \brief Advance the loop by the real time that passed since the previous call.
+    ///
+    /// The first call only starts the clock and doesn't run any simulation step.
+    ///
+    /// \param step the simulation step, invoked with the fixed delta time
+    ///
+    /// \returns \ref FrameStats of this frame
+    FrameStats tick(const StepFunction& step);
+
+    /// \brief Advance the loop by an explicit amount of real time.
+    ///
+    /// \param frameTime how much real time passed since the previous frame
+    /// \param step the simulation step, invoked with the fixed delta time
+    ///
+    /// \returns \ref FrameStats of this frame
+    FrameStats advance(Duration frameTime, const StepFunction& step);
+
+    /// \brief Run a given amount of simulation steps as fast as possible, without any frame pacing.
+    ///
+    /// Intended for soak tests and benchmarks where no window exists.
+    ///
+    /// \param stepCount how many simulation steps should be run
+    /// \param step the simulation step, invoked with the fixed delta time
+    void runHeadless(std::uint64_t stepCount, const StepFunction& step);
+
+    /// \brief Forget the accumulated time and restart the clock used by \ref GameLoop::tick.
+    void reset() noexcept;
+
+    [[nodiscard]] float fixedDeltaTime() const noexcept { return static_cast<float>(m_fixedStep.count()); }
+    [[nodiscard]] std::uint64_t totalSteps() const noexcept { return m_totalSteps; }
+    [[nodiscard]] Duration droppedTime() const noexcept { return m_droppedTime; }
+
+private:
+    GameLoopConfig m_config;
+    Duration m_fixedStep;
+    Duration m_accumulator{ Duration::zero() };
+    Duration m_droppedTime{ Duration::zero() };
+    Clock::time_point m_lastTick;
+    std::uint64_t m_totalSteps{ 0 };
+    bool m_running{ false };
+};
+
+} // namespace sfa
+
+#endif // !SFA_SRC_ENGINE_CORE_GAME_LOOP_HPP
@@ -0,0 +1,176 @@
+#include "GpuTimer.hpp"
+
+#include "core/GLTimerQueries.hpp"
+#include "core/IGpuTimerQueries.hpp"
+#include "core/Profiler.hpp"
+#include "core/Utility.hpp"
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <optional>
+#include <ostream>
+#include <string_view>
+#include <utility>
+
+namespace sfa
+{
+
+GpuTimer::GpuTimer()
+    : GpuTimer(std::make_unique<GLTimerQueries>())
+{}
+
+GpuTimer::GpuTimer(std::unique_ptr<IGpuTimerQueries> queries, std::size_t history)
+    : m_queries{ std::move(queries) }
+    , m_maxHistory{ history }
+#if SFA_ENABLE_PROFILING
+    , m_track{ profiling::Profiler::instance().createTrack("GPU") }
+#endif
+{
+    SFA_ASSERT(m_queries != nullptr, "GpuTimer needs queries to measure with");
+}
+
+GpuTimer::~GpuTimer()
+{
+    for(const auto& pass : m_passes)
+    {
+        for(const auto& slot : pass.slots)
+        {
+            if(slot.query.has_value())
+                m_queries->destroy(*slot.query);
+        }
+    }
+}
+
+void GpuTimer::beginFrame()
+{
+    SFA_ASSERT(m_active == nullptr, "GpuTimer pass wasn't ended before the next frame");
+
+    for(auto& pass : m_passes)
+    {
+        for(auto& slot : pass.slots)
+        {
+            if(slot.inFlight)
+                static_cast<void>(resolve(pass, slot));
+        }
+    }
+
+    ++m_frame;
+}
+
+bool GpuTimer::begin(const char* name)
+{
+    SFA_ASSERT(m_active == nullptr, "GpuTimer passes can't be nested");
+
+    auto& measured{ pass(name) };
+    auto& slot{ measured.slots[m_frame % FRAMES_IN_FLIGHT] };
+
+    // NOTE: Never wait for the GPU here, a slot that is still in flight costs this frame's measurement instead
+    if(slot.inFlight && !resolve(measured, slot))
+    {
+        ++m_skipped;
+        return false;
+    }
+
+    if(!slot.query.has_value())
+        slot.query = m_queries->create();
+
+    slot.frame = m_frame;
+    slot.submittedNs = profiling::Profiler::instance().now();
+    slot.inFlight = true;
+
+    m_queries->begin(*slot.query);
+    m_active = &slot;
+
+    return true;
+}
+
+void GpuTimer::end()
+{
+    SFA_ASSERT(m_active != nullptr, "GpuTimer::end called without an active pass");
+
+    m_queries->end(*m_active->query);
+    m_active = nullptr;
+}
+
+std::optional<GpuTiming> GpuTimer::latest(std::string_view pass) const
+{
+    const auto timing{ std::ranges::find_if(m_history.rbegin(), m_history.rend(), [pass](const GpuTiming& t) {
+        return t.pass == pass;
+    }) };
+
+    if(timing == m_history.rend())
+        return std::nullopt;
+
+    return *timing;
+}
+
+void GpuTimer::writeCsv(std::ostream& stream) const
+{
+    stream << "frame,pass,gpu_ms\n";
+
+    for(const auto& timing : m_history)
+        stream << fmt::format("{},{},{:.6f}\n", timing.frame, timing.pass, timing.milliseconds());
+}
+
+bool GpuTimer::saveCsv(const std::filesystem::path& filepath) const
+{
+    std::ofstream file{ filepath };
+    if(!file.is_open())
+        return false;
+
+    writeCsv(file);
+
+    return file.good();
+}
+
+GpuTimer::Pass& GpuTimer::pass(const char* name)
+{
+    // NOTE: Only a handful of passes exist, a linear search is faster than hashing the name every frame
+    const auto found{ std::ranges::find_if(m_passes, [name](const Pass& p) {
+        return p.name == name || std::string_view{ p.name } == name;
+    }) };
+
+    if(found != m_passes.end())
+        return *found;
+
+    return m_passes.emplace_back(Pass{ .name = name, .slots = {} });
+}
+
+bool GpuTimer::resolve(const Pass& pass, Slot& slot)
+{
+    if(!m_queries->available(*slot.query))
+        return false;
+
+    const GpuTiming timing{
+        .pass = pass.name,
+        .frame = slot.frame,
+        .submittedNs = slot.submittedNs,
+        .elapsedNs = m_queries->elapsedNs(*slot.query),
+    };
+    slot.inFlight = false;
+
+#if SFA_ENABLE_PROFILING
+    m_track.push({
+        .name = timing.pass,
+        .startNs = timing.submittedNs,
+        .endNs = timing.submittedNs + static_cast<std::int64_t>(timing.elapsedNs),
+    });
+#endif
+
+    if(m_maxHistory == 0)
+        return true;
+
+    if(m_history.size() == m_maxHistory)
+        m_history.pop_front();
+    m_history.push_back(timing);
+
+    return true;
+}
+
+} // namespace sfa
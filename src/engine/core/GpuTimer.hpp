@@ -0,0 +1,158 @@
+#ifndef SFA_SRC_ENGINE_CORE_GPU_TIMER_HPP
+#define SFA_SRC_ENGINE_CORE_GPU_TIMER_HPP
+
+#include "core/IGpuTimerQueries.hpp"
+#include "core/Profiler.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <filesystem>
+#include <memory>
+#include <optional>
+#include <ostream>
+#include <string_view>
+#include <vector>
+
+namespace sfa
+{
+
+/// \brief GPU time a render pass took in a single frame.
+///
+/// \author Felix Hommel
+/// \date 3/12/2026
+struct GpuTiming
+{
+    const char* pass;
+    std::uint64_t frame;
+    /// \brief Profiler time at which the pass was submitted, used to place the timing next to the CPU zones.
+    std::int64_t submittedNs;
+    std::uint64_t elapsedNs;
+
+    [[nodiscard]] double milliseconds() const noexcept
+    {
+        constexpr auto NS_PER_MS{ 1'000'000.0 };
+        return static_cast<double>(elapsedNs) / NS_PER_MS;
+    }
+};
+
+/// \brief Measures the GPU time of render passes with elapsed time queries.
+///
+/// Every pass owns a ring of \ref GpuTimer::FRAMES_IN_FLIGHT queries, one per frame. Results are only read once the GPU
+/// reports them as available, which is usually a few frames later, so reading never stalls the pipeline. If a pass
+/// comes around to a slot whose query is still in flight, that frame is skipped instead of waiting for the GPU.
+///
+/// Only one pass can be measured at a time, GL_TIME_ELAPSED queries can't be nested.
+///
+/// \author Felix Hommel
+/// \date 3/12/2026
+class GpuTimer
+{
+public:
+    static constexpr std::size_t FRAMES_IN_FLIGHT{ 4 };
+    static constexpr std::size_t DEFAULT_HISTORY{ 4096 };
+
+    /// \brief Create a \ref GpuTimer that measures with OpenGL queries. Requires a current context.
+    GpuTimer();
+    /// \brief Create a \ref GpuTimer on top of arbitrary queries.
+    ///
+    /// \param queries the queries to measure with
+    /// \param history (optional) amount of timings that are kept for \ref GpuTimer::results
+    explicit GpuTimer(std::unique_ptr<IGpuTimerQueries> queries, std::size_t history = DEFAULT_HISTORY);
+    ~GpuTimer();
+
+    GpuTimer(const GpuTimer&) = delete;
+    GpuTimer& operator=(const GpuTimer&) = delete;
+    GpuTimer(GpuTimer&&) = delete;
+    GpuTimer& operator=(GpuTimer&&) = delete;
+
+    /// \brief Collect all results the GPU has finished and advance to the next frame. Call once per frame.
+    void beginFrame();
+
+    /// \brief Start measuring the pass \p pass, which has to be a string literal.
+    ///
+    /// \returns *true* if the pass is measured this frame, *false* if its query slot was still in flight
+    bool begin(const char* pass);
+    /// \brief Stop measuring the pass started with \ref GpuTimer::begin.
+    void end();
+
+    /// \brief Get the retained timings, oldest first.
+    [[nodiscard]] std::vector<GpuTiming> results() const { return { m_history.begin(), m_history.end() }; }
+    /// \brief Get the most recent timing of \p pass, if any has been collected.
+    [[nodiscard]] std::optional<GpuTiming> latest(std::string_view pass) const;
+
+    [[nodiscard]] std::uint64_t frame() const noexcept { return m_frame; }
+    /// \brief Amount of pass measurements that were skipped because their query was still in flight.
+    [[nodiscard]] std::size_t skipped() const noexcept { return m_skipped; }
+
+    /// \brief Write the retained timings as CSV with the columns frame, pass and gpu_ms.
+    void writeCsv(std::ostream& stream) const;
+    /// \brief Save the retained timings as CSV file.
+    ///
+    /// \returns *true* if the file was written, *false* otherwise
+    bool saveCsv(const std::filesystem::path& filepath) const;
+
+private:
+    /// \brief A query slot of a pass' ring.
+    struct Slot
+    {
+        std::optional<std::uint32_t> query;
+        std::uint64_t frame{ 0 };
+        std::int64_t submittedNs{ 0 };
+        bool inFlight{ false };
+    };
+
+    /// \brief A measured pass with its query ring.
+    struct Pass
+    {
+        const char* name;
+        std::array<Slot, FRAMES_IN_FLIGHT> slots;
+    };
+
+    std::unique_ptr<IGpuTimerQueries> m_queries;
+    std::vector<Pass> m_passes;
+    std::deque<GpuTiming> m_history;
+    std::size_t m_maxHistory;
+
+    std::uint64_t m_frame{ 0 };
+    std::size_t m_skipped{ 0 };
+    Slot* m_active{ nullptr };
+
+#if SFA_ENABLE_PROFILING
+    profiling::ThreadBuffer& m_track;
+#endif
+
+    Pass& pass(const char* name);
+    /// \brief Read the result of \p slot if the GPU has finished it.
+    bool resolve(const Pass& pass, Slot& slot);
+};
+
+/// \brief RAII measurement of a render pass. Does nothing if no \ref GpuTimer is given.
+///
+/// \author Felix Hommel
+/// \date 3/12/2026
+class ScopedGpuZone
+{
+public:
+    ScopedGpuZone(GpuTimer* timer, const char* pass)
+        : m_timer{ timer != nullptr && timer->begin(pass) ? timer : nullptr }
+    {}
+    ~ScopedGpuZone()
+    {
+        if(m_timer != nullptr)
+            m_timer->end();
+    }
+
+    ScopedGpuZone(const ScopedGpuZone&) = delete;
+    ScopedGpuZone& operator=(const ScopedGpuZone&) = delete;
+    ScopedGpuZone(ScopedGpuZone&&) = delete;
+    ScopedGpuZone& operator=(ScopedGpuZone&&) = delete;
+
+private:
+    GpuTimer* m_timer;
+};
+
+} // namespace sfa
+
+#endif // !SFA_SRC_ENGINE_CORE_GPU_TIMER_HPP
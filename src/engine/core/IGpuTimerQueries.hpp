@@ -0,0 +1,44 @@
+#ifndef SFA_SRC_ENGINE_CORE_I_GPU_TIMER_QUERIES_HPP
+#define SFA_SRC_ENGINE_CORE_I_GPU_TIMER_QUERIES_HPP
+
+#include <cstdint>
+
+namespace sfa
+{
+
+/// \brief Interface for the elapsed time queries the \ref GpuTimer is built on.
+///
+/// Decouples the \ref GpuTimer from OpenGL, so that its query ring can be driven without a context.
+///
+/// \author Felix Hommel
+/// \date 3/12/2026
+class IGpuTimerQueries
+{
+public:
+    IGpuTimerQueries() = default;
+    virtual ~IGpuTimerQueries() = default;
+
+    IGpuTimerQueries(const IGpuTimerQueries&) = delete;
+    IGpuTimerQueries& operator=(const IGpuTimerQueries&) = delete;
+    IGpuTimerQueries(IGpuTimerQueries&&) = delete;
+    IGpuTimerQueries& operator=(IGpuTimerQueries&&) = delete;
+
+    /// \brief Create a new query object.
+    [[nodiscard]] virtual std::uint32_t create() = 0;
+    /// \brief Destroy a query object created with \ref IGpuTimerQueries::create.
+    virtual void destroy(std::uint32_t query) = 0;
+
+    /// \brief Start measuring the commands submitted from now on. Only one query can be active at a time.
+    virtual void begin(std::uint32_t query) = 0;
+    /// \brief Stop measuring with the currently active query.
+    virtual void end(std::uint32_t query) = 0;
+
+    /// \brief Check whether the result of \p query can be read without waiting for the GPU.
+    [[nodiscard]] virtual bool available(std::uint32_t query) = 0;
+    /// \brief Read the elapsed GPU time of \p query in nanoseconds. Blocks if the result isn't \ref available.
+    [[nodiscard]] virtual std::uint64_t elapsedNs(std::uint32_t query) = 0;
+};
+
+} // namespace sfa
+
+#endif // !SFA_SRC_ENGINE_CORE_I_GPU_TIMER_QUERIES_HPP
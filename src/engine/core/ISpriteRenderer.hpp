@@ -0,0 +1,63 @@
+#ifndef SFA_SRC_ENGINE_CORE_I_SPRITE_RENDERER_HPP
+#define SFA_SRC_ENGINE_CORE_I_SPRITE_RENDERER_HPP
+
+#include "core/Sampler.hpp"
+#include "core/Texture.hpp"
+
+#include <glm/glm.hpp>
+
+#include <memory>
+
+namespace sfa
+{
+
+/// \brief Interface for components that draw sprites.
+///
+/// Decouples the render systems from OpenGL, so that the same pipeline can run with a \ref NullSpriteRenderer when no
+/// window or context exists.
+///
+/// \author Felix Hommel
+/// \date 3/10/2026
+class ISpriteRenderer
+{
+public:
+    ISpriteRenderer() = default;
+    virtual ~ISpriteRenderer() = default;
+
+    ISpriteRenderer(const ISpriteRenderer&) = delete;
+    ISpriteRenderer& operator=(const ISpriteRenderer&) = delete;
+    ISpriteRenderer(ISpriteRenderer&&) = delete;
+    ISpriteRenderer& operator=(ISpriteRenderer&&) = delete;
+
+    /// \brief Prepare the renderer for drawing the next frame.
+    ///
+    /// \param projection the projection matrix
+    virtual void beginFrame(const glm::mat4& projection) = 0;
+
+    /// \brief Draw a textured quad.
+    ///
+    /// \param texture the texture of the quad
+    /// \param position the position of the quad on screen
+    /// \param scale(optional) the size of the quad on screen
+    /// \param rotate(optional) the rotation of the quad
+    /// \param color(optional) the color of the quad
+    virtual void draw(
+        std::shared_ptr<Texture2D> texture,
+        const glm::vec2& position,
+        const glm::vec2& scale = DEFAULT_DRAW_SCALE,
+        float rotate = DEFAULT_ROTATION,
+        const glm::vec3& color = DEFAULT_COLOR
+    ) = 0;
+
+    /// \brief Sample the textures of every following quad through \p sampler.
+    virtual void setSampler(std::shared_ptr<Sampler> sampler) = 0;
+
+protected:
+    static constexpr auto DEFAULT_DRAW_SCALE{ glm::vec2(10.f) };
+    static constexpr auto DEFAULT_ROTATION{ 0.f };
+    static constexpr auto DEFAULT_COLOR{ glm::vec3(1.f) };
+};
+
+} // namespace sfa
+
+#endif // !SFA_SRC_ENGINE_CORE_I_SPRITE_RENDERER_HPP
@@ -0,0 +1,76 @@
+#ifndef SFA_SRC_ENGINE_CORE_I_TEXT_RENDERER_HPP
+#define SFA_SRC_ENGINE_CORE_I_TEXT_RENDERER_HPP
+
+#include <glm/glm.hpp>
+
+#include <string>
+
+namespace sfa
+{
+
+/// \brief Information about the dimensions and bounds of a string.
+///
+/// \author Felix Hommel
+/// \date 3/2/2026
+struct TextBounds
+{
+    glm::vec2 min{ 0.f };
+    glm::vec2 size{ 0.f };
+};
+
+/// \brief Interface for components that draw text.
+///
+/// Decouples the render systems from OpenGL, so that the same pipeline can run with a \ref NullTextRenderer when no
+/// window or context exists.
+///
+/// \author Felix Hommel
+/// \date 3/10/2026
+class ITextRenderer
+{
+public:
+    ITextRenderer() = default;
+    virtual ~ITextRenderer() = default;
+
+    ITextRenderer(const ITextRenderer&) = delete;
+    ITextRenderer& operator=(const ITextRenderer&) = delete;
+    ITextRenderer(ITextRenderer&&) = delete;
+    ITextRenderer& operator=(ITextRenderer&&) = delete;
+
+    /// \brief Begin the drawing of the next frame.
+    ///
+    /// \param projection projection matrix
+    virtual void beginFrame(const glm::mat4& projection) = 0;
+
+    /// \brief Render text.
+    ///
+    /// \param text the text that will be drawn.
+    /// \param pos the position of the text
+    /// \param scale(optional) apply extra scale to the text
+    /// \param color(optional) the color of the text
+    virtual void render(
+        const std::string& text,
+        const glm::vec2& pos,
+        const glm::vec2& scale = DEFAULT_SCALE,
+        glm::vec3 color = DEFAULT_COLOR
+    ) = 0;
+
+    /// \brief Estimate bounds of rendered text for the current loaded font.
+    ///
+    /// \param text the string that is measured
+    /// \param scale the scale of the text
+    [[nodiscard]] virtual TextBounds measureBounds(const std::string& text, const glm::vec2& scale = DEFAULT_SCALE)
+        const = 0;
+    /// \brief Estimate the rendered dimensions of a text string for the currently loaded font.
+    ///
+    /// \param text the string that is measured
+    /// \param scale the scale of the text
+    [[nodiscard]] virtual glm::vec2 measure(const std::string& text, const glm::vec2& scale = DEFAULT_SCALE) const = 0;
+
+protected:
+    static constexpr auto DEFAULT_SCALE{ glm::vec2(1.f) };
+    static constexpr auto DEFAULT_COLOR{ glm::vec3(1.f) };
+};
+
+} // namespace sfa
+
+#endif // !SFA_SRC_ENGINE_CORE_I_TEXT_RENDERER_HPP
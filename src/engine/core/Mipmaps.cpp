@@ -0,0 +1,94 @@
+#include "Mipmaps.hpp"
+
+#include "core/PixelBuffer.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <span>
+
+namespace sfa
+{
+
+namespace
+{
+
+std::size_t levelSize(int width, int height, int channels)
+{
+    return static_cast<std::size_t>(width) * static_cast<std::size_t>(height) * static_cast<std::size_t>(channels);
+}
+
+} // namespace
+
+int mipLevelCount(int width, int height) noexcept
+{
+    const auto largest{ std::max(width, height) };
+    if(largest <= 0)
+        return 0;
+
+    return static_cast<int>(std::bit_width(static_cast<unsigned int>(largest)));
+}
+
+std::size_t mipChainSize(int width, int height, int channels, int levels) noexcept
+{
+    std::size_t size{ 0 };
+    for(int level{ 0 }; level < levels; ++level)
+    {
+        size += levelSize(width, height, channels);
+        width = std::max(width / 2, 1);
+        height = std::max(height / 2, 1);
+    }
+
+    return size;
+}
+
+void boxFilterMips(std::span<std::byte> chain, int width, int height, int channels, int levels)
+{
+    std::size_t source{ 0 };
+    for(int level{ 1 }; level < levels; ++level)
+    {
+        const auto mipWidth{ std::max(width / 2, 1) };
+        const auto mipHeight{ std::max(height / 2, 1) };
+        const auto target{ source + levelSize(width, height, channels) };
+
+        const auto texel{ [&](int x, int y, int c) {
+            const auto index{ levelSize(width, y, channels) + levelSize(x, 1, channels) + static_cast<std::size_t>(c) };
+            return static_cast<unsigned int>(chain[source + index]);
+        } };
+
+        auto* out{ chain.data() + target };
+        for(int y{ 0 }; y < mipHeight; ++y)
+        {
+            const auto y0{ std::min(2 * y, height - 1) };
+            const auto y1{ std::min(2 * y + 1, height - 1) };
+            for(int x{ 0 }; x < mipWidth; ++x)
+            {
+                const auto x0{ std::min(2 * x, width - 1) };
+                const auto x1{ std::min(2 * x + 1, width - 1) };
+                for(int c{ 0 }; c < channels; ++c)
+                {
+                    const auto sum{ texel(x0, y0, c) + texel(x1, y0, c) + texel(x0, y1, c) + texel(x1, y1, c) };
+                    *out++ = static_cast<std::byte>((sum + 2) / 4);
+                }
+            }
+        }
+
+        source = target;
+        width = mipWidth;
+        height = mipHeight;
+    }
+}
+
+PixelBuffer buildMipChain(std::span<const std::byte> pixels, int width, int height, int channels)
+{
+    const auto levels{ mipLevelCount(width, height) };
+    auto chain{ PixelBuffer::allocate(mipChainSize(width, height, channels, levels)) };
+
+    const auto level{ pixels.first(std::min(pixels.size(), levelSize(width, height, channels))) };
+    std::ranges::copy(level, chain.data());
+    boxFilterMips(chain.bytes(), width, height, channels, levels);
+
+    return chain;
+}
+
+} // namespace sfa
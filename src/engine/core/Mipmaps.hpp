@@ -0,0 +1,49 @@
+#ifndef SFA_SRC_ENGINE_CORE_MIPMAPS_HPP
+#define SFA_SRC_ENGINE_CORE_MIPMAPS_HPP
+
+#include "core/PixelBuffer.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+namespace sfa
+{
+
+/// \brief Where the mip chain of a texture comes from.
+///
+/// \author Felix Hommel
+/// \date 3/23/2026
+enum class MipmapMode : std::uint8_t
+{
+    None, ///< only the full resolution level
+    Gpu,  ///< generated by the driver after the upload
+    Cpu   ///< box filtered on the loading thread and uploaded together with the full resolution level
+};
+
+/// \returns amount of levels of a full mip chain of a \p width x \p height texture, including the full resolution one
+[[nodiscard]] int mipLevelCount(int width, int height) noexcept;
+
+/// \returns size of the first \p levels tightly packed levels of a \p width x \p height texture, in bytes
+[[nodiscard]] std::size_t mipChainSize(int width, int height, int channels, int levels) noexcept;
+
+/// \brief Fill the smaller levels of a mip chain, each a 2x2 box filtered half of the previous one.
+///
+/// An odd last row or column of a level is folded into the texel before it.
+///
+/// \param chain \ref mipChainSize bytes, starting with the full resolution level, each level directly follows the
+/// previous one
+/// \param width width of the full resolution level
+/// \param height height of the full resolution level
+/// \param channels amount of bytes per texel
+/// \param levels amount of levels in \p chain, including the full resolution one
+void boxFilterMips(std::span<std::byte> chain, int width, int height, int channels, int levels);
+
+/// \brief Build the full mip chain of tightly packed \p pixels on the CPU.
+///
+/// \returns every level of the texture, one after the other, see \ref mipLevelCount
+[[nodiscard]] PixelBuffer buildMipChain(std::span<const std::byte> pixels, int width, int height, int channels);
+
+} // namespace sfa
+
+#endif // !SFA_SRC_ENGINE_CORE_MIPMAPS_HPP
@@ -0,0 +1,106 @@
+#ifndef SFA_SRC_ENGINE_CORE_NULL_RENDERER_HPP
+#define SFA_SRC_ENGINE_CORE_NULL_RENDERER_HPP
+
+#include "core/ISpriteRenderer.hpp"
+#include "core/ITextRenderer.hpp"
+#include "core/Sampler.hpp"
+#include "core/Texture.hpp"
+
+#include <glm/glm.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <string>
+
+namespace sfa
+{
+
+/// \brief \ref ISpriteRenderer that doesn't touch OpenGL and only counts the submitted work.
+///
+/// \author Felix Hommel
+/// \date 3/10/2026
+class NullSpriteRenderer : public ISpriteRenderer
+{
+public:
+    NullSpriteRenderer() = default;
+    ~NullSpriteRenderer() override = default;
+
+    NullSpriteRenderer(const NullSpriteRenderer&) = delete;
+    NullSpriteRenderer& operator=(const NullSpriteRenderer&) = delete;
+    NullSpriteRenderer(NullSpriteRenderer&&) = delete;
+    NullSpriteRenderer& operator=(NullSpriteRenderer&&) = delete;
+
+    void beginFrame(const glm::mat4& /*projection*/) override { ++m_frames; }
+
+    void draw(
+        std::shared_ptr<Texture2D> /*texture*/,
+        const glm::vec2& /*position*/,
+        const glm::vec2& /*scale*/ = DEFAULT_DRAW_SCALE,
+        float /*rotate*/ = DEFAULT_ROTATION,
+        const glm::vec3& /*color*/ = DEFAULT_COLOR
+    ) override
+    {
+        ++m_drawCalls;
+    }
+
+    void setSampler(std::shared_ptr<Sampler> /*sampler*/) override {}
+
+    [[nodiscard]] std::size_t frames() const noexcept { return m_frames; }
+    [[nodiscard]] std::size_t drawCalls() const noexcept { return m_drawCalls; }
+
+private:
+    std::size_t m_frames{ 0 };
+    std::size_t m_drawCalls{ 0 };
+};
+
+/// \brief \ref ITextRenderer that doesn't touch OpenGL and only counts the submitted work.
+///
+/// Text is measured as empty, so layout that depends on text bounds stays deterministic without a loaded font.
+///
+/// \author Felix Hommel
+/// \date 3/10/2026
+class NullTextRenderer : public ITextRenderer
+{
+public:
+    NullTextRenderer() = default;
+    ~NullTextRenderer() override = default;
+
+    NullTextRenderer(const NullTextRenderer&) = delete;
+    NullTextRenderer& operator=(const NullTextRenderer&) = delete;
+    NullTextRenderer(NullTextRenderer&&) = delete;
+    NullTextRenderer& operator=(NullTextRenderer&&) = delete;
+
+    void beginFrame(const glm::mat4& /*projection*/) override { ++m_frames; }
+
+    void render(
+        const std::string& /*text*/,
+        const glm::vec2& /*pos*/,
+        const glm::vec2& /*scale*/ = DEFAULT_SCALE,
+        glm::vec3 /*color*/ = DEFAULT_COLOR
+    ) override
+    {
+        ++m_drawCalls;
+    }
+
+    [[nodiscard]] TextBounds measureBounds(const std::string& /*text*/, const glm::vec2& /*scale*/ = DEFAULT_SCALE)
+        const override
+    {
+        return {};
+    }
+    [[nodiscard]] glm::vec2 measure(const std::string& /*text*/, const glm::vec2& /*scale*/ = DEFAULT_SCALE)
+        const override
+    {
+        return glm::vec2(0.f);
+    }
+
+    [[nodiscard]] std::size_t frames() const noexcept { return m_frames; }
+    [[nodiscard]] std::size_t drawCalls() const noexcept { return m_drawCalls; }
+
+private:
+    std::size_t m_frames{ 0 };
+    std::size_t m_drawCalls{ 0 };
+};
+
+} // namespace sfa
+
+#endif // !SFA_SRC_ENGINE_CORE_NULL_RENDERER_HPP
@@ -1,7 +1,9 @@
 #include "ParticleGenerator.hpp"
 
+#include "Sampler.hpp"
 #include "Shader.hpp"
 #include "Texture.hpp"
+#include "Utility.hpp"
 
 #include "glad/gl.h"
 
@@ -14,10 +16,18 @@ namespace sfa
 {
 
 ParticleGenerator::ParticleGenerator(
-    std::shared_ptr<Shader> shader, std::shared_ptr<Texture2D> texture, std::size_t amount
+    std::shared_ptr<Shader> shader,
+    std::shared_ptr<Texture2D> texture,
+    std::size_t amount,
+    std::shared_ptr<Sampler> sampler
 )
-    : m_shader(std::move(shader)), m_texture(std::move(texture)), m_particles(amount)
+    : m_shader(std::move(shader))
+    , m_texture(std::move(texture))
+    , m_sampler(std::move(sampler))
+    , m_particles(amount)
 {
+    SFA_ASSERT(m_sampler != nullptr, "ParticleGenerator needs a sampler to sample its texture with");
+
     glGenVertexArrays(1, &m_vao);
     unsigned int vbo{};
     glGenBuffers(1, &vbo);
@@ -68,6 +78,7 @@ void ParticleGenerator::draw()
 {
     glBlendFunc(GL_SRC_ALPHA, GL_ONE);
     m_shader->use();
+    m_sampler->bind(0);
     for(Particle particle : m_particles)
     {
         if(particle.life > 0.0f)
@@ -81,6 +92,7 @@ void ParticleGenerator::draw()
         }
     }
 
+    Sampler::unbind(0);
     glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
 }
 
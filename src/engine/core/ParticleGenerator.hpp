@@ -1,12 +1,14 @@
 #ifndef SFA_SRC_ENGINE_CORE_PARTICLE_GENERATOR_HPP
 #define SFA_SRC_ENGINE_CORE_PARTICLE_GENERATOR_HPP
 
+#include "Sampler.hpp"
 #include "Shader.hpp"
 #include "Texture.hpp"
 
 #include <array>
 #include <cstddef>
 #include <memory>
+#include <utility>
 #include <vector>
 
 namespace sfa
@@ -31,7 +33,13 @@ struct Particle
 class ParticleGenerator
 {
 public:
-    ParticleGenerator(std::shared_ptr<Shader> shader, std::shared_ptr<Texture2D> texture, std::size_t amount);
+    /// \param sampler how the texture is sampled, share one from a \ref SamplerCache between renderers
+    ParticleGenerator(
+        std::shared_ptr<Shader> shader,
+        std::shared_ptr<Texture2D> texture,
+        std::size_t amount,
+        std::shared_ptr<Sampler> sampler
+    );
     ~ParticleGenerator();
 
     ParticleGenerator(const ParticleGenerator&) = delete;
@@ -46,6 +54,9 @@ public:
     /// it was before.
     void draw();
 
+    /// \brief Sample the texture through \p sampler from now on, \p sampler must not be *nullptr*.
+    void setSampler(std::shared_ptr<Sampler> sampler) { m_sampler = std::move(sampler); }
+
 private:
     static constexpr std::size_t PARTICLE_QUAD_VERTICES{ 6 };
     static constexpr std::size_t PARTICLE_QUAD_VERTICES_ATTRIBUTES{ 4 };
@@ -55,6 +66,7 @@ private:
 
     std::shared_ptr<Shader> m_shader;
     std::shared_ptr<Texture2D> m_texture;
+    std::shared_ptr<Sampler> m_sampler;
 
     std::vector<Particle> m_particles;
     std::size_t m_lastUsedParticle{ 0 };
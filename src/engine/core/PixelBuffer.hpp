@@ -0,0 +1,94 @@
+#ifndef SFA_SRC_ENGINE_CORE_PIXEL_BUFFER_HPP
+#define SFA_SRC_ENGINE_CORE_PIXEL_BUFFER_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <memory>
+#include <new>
+#include <span>
+#include <utility>
+
+namespace sfa
+{
+
+namespace details
+{
+
+/// \brief Releases the memory of a \ref PixelBuffer through the function of whatever allocated it.
+struct PixelBufferDeleter
+{
+    void (*free)(void*){ nullptr };
+
+    void operator()(std::byte* data) const noexcept
+    {
+        if(free != nullptr)
+            free(data);
+    }
+};
+
+} // namespace details
+
+/// \brief Owns decoded pixel data together with the function that frees it.
+///
+/// The buffer adopts memory of whatever allocated it, e.g. the result of stbi_load together with stbi_image_free, so
+/// decoded pixels travel from the decoder to the GPU without being copied. It is move-only, so an accidental full-image
+/// copy doesn't compile.
+///
+/// \author Felix Hommel
+/// \date 3/19/2026
+class PixelBuffer
+{
+public:
+    /// \brief Frees the memory of a \ref PixelBuffer, compatible with std::free and stbi_image_free.
+    using FreeFunction = void (*)(void*);
+
+    PixelBuffer() = default;
+    /// \brief Take ownership of \p size bytes at \p data.
+    ///
+    /// \param data memory that is adopted, released with \p free
+    /// \param size amount of bytes at \p data
+    /// \param free function that releases \p data, *nullptr* to only borrow memory that outlives the buffer
+    PixelBuffer(void* data, std::size_t size, FreeFunction free)
+        : m_data(static_cast<std::byte*>(data), details::PixelBufferDeleter{ free }), m_size(data == nullptr ? 0 : size)
+    {
+    }
+
+    /// \brief Create a buffer of \p size uninitialized bytes.
+    ///
+    /// \throws std::bad_alloc if the memory can't be allocated
+    [[nodiscard]] static PixelBuffer allocate(std::size_t size)
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-no-malloc): paired with the std::free deleter
+        void* data{ std::malloc(size == 0 ? 1 : size) };
+        if(data == nullptr)
+            throw std::bad_alloc{};
+
+        return PixelBuffer{ data, size, &std::free };
+    }
+
+    /// \brief Create a buffer holding a copy of \p pixels.
+    [[nodiscard]] static PixelBuffer copyOf(std::span<const std::byte> pixels)
+    {
+        auto buffer{ allocate(pixels.size()) };
+        std::ranges::copy(pixels, buffer.data());
+
+        return buffer;
+    }
+
+    [[nodiscard]] std::byte* data() noexcept { return m_data.get(); }
+    [[nodiscard]] const std::byte* data() const noexcept { return m_data.get(); }
+    [[nodiscard]] std::size_t size() const noexcept { return m_size; }
+    [[nodiscard]] bool empty() const noexcept { return m_size == 0; }
+
+    [[nodiscard]] std::span<std::byte> bytes() noexcept { return { m_data.get(), m_size }; }
+    [[nodiscard]] std::span<const std::byte> bytes() const noexcept { return { m_data.get(), m_size }; }
+
+private:
+    std::unique_ptr<std::byte, details::PixelBufferDeleter> m_data;
+    std::size_t m_size{ 0 };
+};
+
+} // namespace sfa
+
+#endif // !SFA_SRC_ENGINE_CORE_PIXEL_BUFFER_HPP
@@ -0,0 +1,279 @@
+#include "Profiler.hpp"
+
+#include <fmt/format.h>
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace
+{
+
+constexpr auto NS_PER_US{ 1000.0 };
+
+/// \brief Escape \p text so it can be used as JSON string content.
+std::string escapeJson(std::string_view text)
+{
+    constexpr auto FIRST_PRINTABLE{ 0x20 };
+
+    std::string escaped;
+    escaped.reserve(text.size());
+
+    for(const char c : text)
+    {
+        switch(c)
+        {
+        case '"':
+            escaped += "\\\"";
+            break;
+        case '\\':
+            escaped += "\\\\";
+            break;
+        case '\n':
+            escaped += "\\n";
+            break;
+        default:
+            if(static_cast<unsigned char>(c) < FIRST_PRINTABLE)
+                escaped += fmt::format("\\u{:04x}", static_cast<unsigned int>(c));
+            else
+                escaped += c;
+        }
+    }
+
+    return escaped;
+}
+
+} // namespace
+
+namespace sfa::profiling
+{
+
+ThreadBuffer::ThreadBuffer(std::uint32_t threadId, std::string name)
+    : m_events{ std::make_unique<std::array<ZoneEvent, CAPACITY>>() }
+    , m_threadId{ threadId }
+    , m_name{ std::move(name) }
+{}
+
+void ThreadBuffer::drainInto(std::vector<CollectedEvent>& out)
+{
+    auto tail{ m_tail.load(std::memory_order_relaxed) };
+    const auto head{ m_head.load(std::memory_order_acquire) };
+
+    for(; tail != head; ++tail)
+        out.push_back({ .zone = (*m_events)[tail & MASK], .threadId = m_threadId });
+
+    m_tail.store(tail, std::memory_order_release);
+}
+
+struct Profiler::ThreadBufferLease
+{
+    ThreadBuffer* buffer{ nullptr };
+
+    ThreadBufferLease() = default;
+    ~ThreadBufferLease()
+    {
+        if(buffer != nullptr)
+            Profiler::instance().releaseThreadBuffer(*buffer);
+    }
+
+    ThreadBufferLease(const ThreadBufferLease&) = delete;
+    ThreadBufferLease& operator=(const ThreadBufferLease&) = delete;
+    ThreadBufferLease(ThreadBufferLease&&) = delete;
+    ThreadBufferLease& operator=(ThreadBufferLease&&) = delete;
+};
+
+Profiler::Profiler()
+    : m_epoch{ Clock::now() }
+{}
+
+Profiler& Profiler::instance()
+{
+    static Profiler profiler;
+
+    return profiler;
+}
+
+void Profiler::setThreadName(std::string_view name)
+{
+    auto& buffer{ threadBuffer() };
+
+    std::lock_guard lock(m_mutex);
+    buffer.m_name = name;
+}
+
+ThreadBuffer& Profiler::createTrack(std::string name)
+{
+    std::lock_guard lock(m_mutex);
+
+    return *m_buffers.emplace_back(std::make_unique<ThreadBuffer>(m_nextThreadId++, std::move(name)));
+}
+
+void Profiler::collect()
+{
+    std::lock_guard lock(m_mutex);
+
+    std::size_t dropped{ 0 };
+    for(const auto& buffer : m_buffers)
+    {
+        buffer->drainInto(m_events);
+        dropped += buffer->dropped();
+    }
+
+    if(dropped > m_reportedDrops)
+    {
+        spdlog::warn("Profiler dropped {} events because a thread buffer was full", dropped - m_reportedDrops);
+        m_reportedDrops = dropped;
+    }
+}
+
+void Profiler::clear()
+{
+    std::lock_guard lock(m_mutex);
+
+    std::vector<CollectedEvent> discarded;
+    for(const auto& buffer : m_buffers)
+        buffer->drainInto(discarded);
+
+    m_events.clear();
+    m_exitedThreads.clear();
+}
+
+std::vector<CollectedEvent> Profiler::events() const
+{
+    std::lock_guard lock(m_mutex);
+
+    return m_events;
+}
+
+std::size_t Profiler::droppedEvents() const
+{
+    std::lock_guard lock(m_mutex);
+
+    std::size_t dropped{ 0 };
+    for(const auto& buffer : m_buffers)
+        dropped += buffer->dropped();
+
+    return dropped;
+}
+
+std::size_t Profiler::bufferCount() const
+{
+    std::lock_guard lock(m_mutex);
+
+    return m_buffers.size();
+}
+
+void Profiler::writeChromeTrace(std::ostream& stream)
+{
+    collect();
+
+    std::lock_guard lock(m_mutex);
+
+    // NOTE: Chrome and Perfetto nest "X" events by start time, so children have to follow their parents
+    std::ranges::stable_sort(m_events, [](const CollectedEvent& lhs, const CollectedEvent& rhs) {
+        return lhs.zone.startNs < rhs.zone.startNs;
+    });
+
+    stream << R"({"displayTimeUnit":"ms","traceEvents":[)";
+
+    bool first{ true };
+    const auto separator{ [&first, &stream]() {
+        if(!first)
+            stream << ',';
+        first = false;
+    } };
+
+    const auto writeThreadName{ [&separator, &stream](std::uint32_t threadId, std::string_view name) {
+        separator();
+        stream << fmt::format(
+            R"({{"name":"thread_name","ph":"M","pid":1,"tid":{},"args":{{"name":"{}"}}}})", threadId, ::escapeJson(name)
+        );
+    } };
+
+    for(const auto& buffer : m_buffers)
+        writeThreadName(buffer->m_threadId, buffer->m_name);
+    for(const auto& [threadId, name] : m_exitedThreads)
+        writeThreadName(threadId, name);
+
+    for(const auto& [zone, threadId] : m_events)
+    {
+        separator();
+        stream << fmt::format(
+            R"({{"name":"{}","cat":"sfa","ph":"X","pid":1,"tid":{},"ts":{:.3f},"dur":{:.3f}}})",
+            ::escapeJson(zone.name),
+            threadId,
+            static_cast<double>(zone.startNs) / ::NS_PER_US,
+            static_cast<double>(zone.endNs - zone.startNs) / ::NS_PER_US
+        );
+    }
+
+    stream << "]}\n";
+}
+
+bool Profiler::saveChromeTrace(const std::filesystem::path& filepath)
+{
+    std::ofstream file{ filepath };
+    if(!file.is_open())
+        return false;
+
+    writeChromeTrace(file);
+
+    return file.good();
+}
+
+/// \brief Get the buffer of the calling thread, registering it on first use.
+///
+/// Only the first call per thread takes the lock, every later call is a thread local lookup. A buffer released by an
+/// exited thread is reused before a new one is allocated.
+ThreadBuffer& Profiler::threadBuffer()
+{
+    thread_local ThreadBufferLease lease;
+
+    if(lease.buffer == nullptr)
+    {
+        std::lock_guard lock(m_mutex);
+
+        const auto threadId{ m_nextThreadId++ };
+        if(!m_freeBuffers.empty())
+        {
+            lease.buffer = m_freeBuffers.back();
+            m_freeBuffers.pop_back();
+
+            // NOTE: Events of the previous owner were collected on release and are still exported under its name
+            m_exitedThreads.emplace_back(lease.buffer->m_threadId, std::move(lease.buffer->m_name));
+            lease.buffer->m_threadId = threadId;
+            lease.buffer->m_name = fmt::format("Thread {}", threadId);
+        }
+        else
+        {
+            auto& registered{ m_buffers.emplace_back(
+                std::make_unique<ThreadBuffer>(threadId, fmt::format("Thread {}", threadId))
+            ) };
+            lease.buffer = registered.get();
+        }
+    }
+
+    return *lease.buffer;
+}
+
+/// \brief Collect the events left in \p buffer of an exiting thread and make the buffer available to the next thread.
+void Profiler::releaseThreadBuffer(ThreadBuffer& buffer)
+{
+    std::lock_guard lock(m_mutex);
+
+    buffer.drainInto(m_events);
+    m_freeBuffers.push_back(&buffer);
+}
+
+} // namespace sfa::profiling
@@ -0,0 +1,235 @@
+#ifndef SFA_SRC_ENGINE_CORE_PROFILER_HPP
+#define SFA_SRC_ENGINE_CORE_PROFILER_HPP
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace sfa::profiling
+{
+
+/// \brief A single finished zone, as it is recorded by the thread that executed it.
+///
+/// \note \ref ZoneEvent::name has to point to storage that outlives the profiler, e.g. a string literal.
+///
+/// \author Felix Hommel
+/// \date 3/11/2026
+struct ZoneEvent
+{
+    const char* name;
+    std::int64_t startNs;
+    std::int64_t endNs;
+};
+
+/// \brief A \ref ZoneEvent together with the profiler id of the thread that recorded it.
+///
+/// \author Felix Hommel
+/// \date 3/11/2026
+struct CollectedEvent
+{
+    ZoneEvent zone;
+    std::uint32_t threadId;
+};
+
+/// \brief Fixed size single-producer/single-consumer ring buffer of \ref ZoneEvent.
+///
+/// Every thread records into its own buffer, so recording a zone never takes a lock. The profiler is the only
+/// consumer. When the buffer is full, new events are dropped and counted instead of blocking the recording thread.
+///
+/// \author Felix Hommel
+/// \date 3/11/2026
+class ThreadBuffer
+{
+public:
+    static constexpr std::size_t CAPACITY{ std::size_t{ 1 } << 15 };
+
+    ThreadBuffer(std::uint32_t threadId, std::string name);
+    ~ThreadBuffer() = default;
+
+    ThreadBuffer(const ThreadBuffer&) = delete;
+    ThreadBuffer& operator=(const ThreadBuffer&) = delete;
+    ThreadBuffer(ThreadBuffer&&) = delete;
+    ThreadBuffer& operator=(ThreadBuffer&&) = delete;
+
+    /// \brief Record a finished zone. Must only be called by the owning thread.
+    ///
+    /// \returns *true* if the event was recorded, *false* if it was dropped because the buffer is full
+    bool push(const ZoneEvent& event) noexcept
+    {
+        const auto head{ m_head.load(std::memory_order_relaxed) };
+        if(head - m_tail.load(std::memory_order_acquire) == CAPACITY)
+        {
+            m_dropped.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+
+        (*m_events)[head & MASK] = event;
+        m_head.store(head + 1, std::memory_order_release);
+
+        return true;
+    }
+
+    /// \brief Move all recorded events into \p out. Must only be called by a single consumer at a time.
+    void drainInto(std::vector<CollectedEvent>& out);
+
+    [[nodiscard]] std::uint32_t threadId() const noexcept { return m_threadId; }
+    [[nodiscard]] std::size_t dropped() const noexcept { return m_dropped.load(std::memory_order_relaxed); }
+
+private:
+    static constexpr std::size_t MASK{ CAPACITY - 1 };
+    static constexpr std::size_t CACHE_LINE{ 64 };
+
+    friend class Profiler;
+
+    std::unique_ptr<std::array<ZoneEvent, CAPACITY>> m_events;
+    std::uint32_t m_threadId;
+    std::string m_name;
+    alignas(CACHE_LINE) std::atomic<std::size_t> m_head{ 0 };
+    alignas(CACHE_LINE) std::atomic<std::size_t> m_tail{ 0 };
+    std::atomic<std::size_t> m_dropped{ 0 };
+};
+
+/// \brief Process wide collector of the per-thread \ref ThreadBuffer.
+///
+/// Threads register their buffer on their first recorded zone. When a thread exits, the events left in its buffer are
+/// collected and the buffer is handed to the next thread that registers, so short-lived threads don't each keep a
+/// buffer alive until the profiler is destroyed. Collected events can be exported in the Chrome trace_event JSON
+/// format, which can be opened with chrome://tracing or Perfetto.
+///
+/// \author Felix Hommel
+/// \date 3/11/2026
+class Profiler
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    ~Profiler() = default;
+
+    Profiler(const Profiler&) = delete;
+    Profiler& operator=(const Profiler&) = delete;
+    Profiler(Profiler&&) = delete;
+    Profiler& operator=(Profiler&&) = delete;
+
+    [[nodiscard]] static Profiler& instance();
+
+    /// \brief Nanoseconds since the profiler was created.
+    [[nodiscard]] std::int64_t now() const noexcept
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - m_epoch).count();
+    }
+
+    /// \brief Record a finished zone on the calling thread.
+    void record(const ZoneEvent& event) { threadBuffer().push(event); }
+
+    /// \brief Name the calling thread in exported traces.
+    void setThreadName(std::string_view name);
+    /// \brief Register a track that isn't bound to a thread, e.g. for events measured on the GPU.
+    ///
+    /// The caller is the only producer of the returned buffer, which stays valid for the lifetime of the profiler.
+    [[nodiscard]] ThreadBuffer& createTrack(std::string name);
+
+    /// \brief Move the events of all threads into the profiler's collection.
+    ///
+    /// Meant to be called once per frame, a thread buffer that fills up before it is collected drops new events.
+    /// Dropped events are logged as a warning by the next call.
+    void collect();
+    /// \brief Discard all collected and not yet collected events.
+    void clear();
+
+    /// \brief Get a copy of all collected events.
+    [[nodiscard]] std::vector<CollectedEvent> events() const;
+    /// \brief Amount of events that were dropped because a thread buffer was full.
+    [[nodiscard]] std::size_t droppedEvents() const;
+    /// \brief Amount of allocated buffers, i.e. the most threads that recorded at the same time plus the tracks.
+    [[nodiscard]] std::size_t bufferCount() const;
+
+    /// \brief Collect and write all events in the Chrome trace_event JSON format.
+    void writeChromeTrace(std::ostream& stream);
+    /// \brief Collect and save all events as Chrome trace_event JSON file.
+    ///
+    /// \returns *true* if the file was written, *false* otherwise
+    bool saveChromeTrace(const std::filesystem::path& filepath);
+
+private:
+    /// \brief Returns the buffer of a thread to the profiler when the thread exits.
+    struct ThreadBufferLease;
+
+    Profiler();
+
+    Clock::time_point m_epoch;
+
+    mutable std::mutex m_mutex;
+    std::vector<std::unique_ptr<ThreadBuffer>> m_buffers;
+    std::vector<ThreadBuffer*> m_freeBuffers;
+    /// \brief Ids and names of exited threads whose buffer was handed to another thread.
+    std::vector<std::pair<std::uint32_t, std::string>> m_exitedThreads;
+    std::vector<CollectedEvent> m_events;
+    std::uint32_t m_nextThreadId{ 0 };
+    /// \brief Dropped events that were already logged by \ref Profiler::collect.
+    std::size_t m_reportedDrops{ 0 };
+
+    ThreadBuffer& threadBuffer();
+    void releaseThreadBuffer(ThreadBuffer& buffer);
+};
+
+/// \brief RAII zone that records the time between its construction and destruction.
+///
+/// \author Felix Hommel
+/// \date 3/11/2026
+class ScopedZone
+{
+public:
+    explicit ScopedZone(const char* name) noexcept
+        : m_name{ name }
+        , m_start{ Profiler::instance().now() }
+    {}
+    ~ScopedZone()
+    {
+        auto& profiler{ Profiler::instance() };
+        profiler.record({ .name = m_name, .startNs = m_start, .endNs = profiler.now() });
+    }
+
+    ScopedZone(const ScopedZone&) = delete;
+    ScopedZone& operator=(const ScopedZone&) = delete;
+    ScopedZone(ScopedZone&&) = delete;
+    ScopedZone& operator=(ScopedZone&&) = delete;
+
+private:
+    const char* m_name;
+    std::int64_t m_start;
+};
+
+} // namespace sfa::profiling
+
+// NOTE: Ensure SFA_ENABLE_PROFILING is defined
+#if !defined(SFA_ENABLE_PROFILING)
+#    define SFA_ENABLE_PROFILING 0
+#endif
+
+// NOLINTBEGIN(cppcoreguidelines-macro-usage): zones need the enclosing scope and a unique variable name
+#define SFA_PROFILE_CONCAT_IMPL(a, b) a##b
+#define SFA_PROFILE_CONCAT(a, b) SFA_PROFILE_CONCAT_IMPL(a, b)
+
+#if SFA_ENABLE_PROFILING
+/// \brief Profile the enclosing scope as a zone named \p name, which has to be a string literal.
+#    define SFA_PROFILE_SCOPE(name) \
+        const ::sfa::profiling::ScopedZone SFA_PROFILE_CONCAT(sfaProfileZone, __LINE__) { name }
+/// \brief Name the calling thread in exported traces.
+#    define SFA_PROFILE_THREAD_NAME(name) ::sfa::profiling::Profiler::instance().setThreadName(name)
+#else
+#    define SFA_PROFILE_SCOPE(name) ((void)0)
+#    define SFA_PROFILE_THREAD_NAME(name) ((void)0)
+#endif
+// NOLINTEND(cppcoreguidelines-macro-usage)
+
+#endif // !SFA_SRC_ENGINE_CORE_PROFILER_HPP
@@ -0,0 +1,81 @@
+#include "Sampler.hpp"
+
+#include <glad/gl.h>
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <utility>
+
+namespace sfa
+{
+
+std::size_t SamplerStateHash::operator()(const SamplerState& state) const noexcept
+{
+    // NOTE: Combined like boost::hash_combine
+    std::size_t seed{ 0 };
+    for(const auto value : { state.wrapS, state.wrapT, state.minFilter, state.magFilter })
+        seed ^= std::hash<int>{}(value) + 0x9e3779b9 + (seed << 6u) + (seed >> 2u);
+
+    return seed;
+}
+
+Sampler::Sampler(const SamplerState& state) : m_state{ state }
+{
+    glGenSamplers(1, &m_id);
+
+    glSamplerParameteri(m_id, GL_TEXTURE_WRAP_S, m_state.wrapS);
+    glSamplerParameteri(m_id, GL_TEXTURE_WRAP_T, m_state.wrapT);
+    glSamplerParameteri(m_id, GL_TEXTURE_MIN_FILTER, m_state.minFilter);
+    glSamplerParameteri(m_id, GL_TEXTURE_MAG_FILTER, m_state.magFilter);
+}
+
+Sampler::~Sampler()
+{
+    releaseSampler();
+}
+
+Sampler::Sampler(Sampler&& other) noexcept
+    : m_id(std::exchange(other.m_id, 0)), m_state(std::exchange(other.m_state, SamplerState{}))
+{}
+
+Sampler& Sampler::operator=(Sampler&& other) noexcept
+{
+    if(this == &other)
+        return *this;
+
+    releaseSampler();
+
+    m_id = std::exchange(other.m_id, 0);
+    m_state = std::exchange(other.m_state, SamplerState{});
+
+    return *this;
+}
+
+void Sampler::bind(unsigned int unit) const
+{
+    glBindSampler(unit, m_id);
+}
+
+void Sampler::unbind(unsigned int unit)
+{
+    glBindSampler(unit, 0);
+}
+
+/// \brief If the \ref Sampler is holding a valid sampler ID delete it.
+void Sampler::releaseSampler() const
+{
+    if(m_id != 0)
+        glDeleteSamplers(1, &m_id);
+}
+
+std::shared_ptr<Sampler> SamplerCache::get(const SamplerState& state)
+{
+    auto& sampler{ m_samplers[state] };
+    if(sampler == nullptr)
+        sampler = std::make_shared<Sampler>(state);
+
+    return sampler;
+}
+
+} // namespace sfa
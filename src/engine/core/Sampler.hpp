@@ -0,0 +1,100 @@
+#ifndef SFA_SRC_ENGINE_CORE_SAMPLER_HPP
+#define SFA_SRC_ENGINE_CORE_SAMPLER_HPP
+
+#include <glad/gl.h>
+
+#include <cstddef>
+#include <memory>
+#include <unordered_map>
+
+namespace sfa
+{
+
+/// \brief How a texture is sampled, independent of the texture itself.
+///
+/// \author Felix Hommel
+/// \date 3/23/2026
+struct SamplerState
+{
+    int wrapS{ GL_REPEAT };
+    int wrapT{ GL_REPEAT };
+    int minFilter{ GL_LINEAR }; ///< e.g. GL_LINEAR_MIPMAP_LINEAR to sample from the mip chain of the texture
+    int magFilter{ GL_LINEAR };
+
+    bool operator==(const SamplerState&) const = default;
+};
+
+/// \brief Hash of a \ref SamplerState, so it can key unordered containers.
+struct SamplerStateHash
+{
+    [[nodiscard]] std::size_t operator()(const SamplerState& state) const noexcept;
+};
+
+/// \brief Abstracts OpenGL sampler objects.
+///
+/// A sampler bound to a texture unit overrides the sampling parameters of whatever texture is bound to the unit, so
+/// the same texture can be drawn with different filters without touching the texture.
+///
+/// \author Felix Hommel
+/// \date 3/23/2026
+class Sampler
+{
+public:
+    /// \brief Create a new \ref Sampler and set it up with OpenGL.
+    ///
+    /// \param state parameters of the sampler, they can't be changed afterwards
+    explicit Sampler(const SamplerState& state);
+    ~Sampler();
+
+    Sampler(Sampler&& other) noexcept;
+    Sampler& operator=(Sampler&& other) noexcept;
+
+    Sampler(const Sampler&) = delete;
+    Sampler& operator=(const Sampler&) = delete;
+
+    /// \brief Sample the textures bound to texture unit \p unit through this sampler.
+    void bind(unsigned int unit) const;
+    /// \brief Sample the textures bound to texture unit \p unit with their own parameters again.
+    static void unbind(unsigned int unit);
+
+    [[nodiscard]] unsigned int getID() const noexcept { return m_id; }
+    [[nodiscard]] const SamplerState& state() const noexcept { return m_state; }
+
+private:
+    unsigned int m_id{ 0 };
+    SamplerState m_state;
+
+    void releaseSampler() const;
+};
+
+/// \brief Hands out a single shared \ref Sampler per \ref SamplerState.
+///
+/// Only the thread the OpenGL context is current on may use the cache.
+///
+/// \author Felix Hommel
+/// \date 3/23/2026
+class SamplerCache
+{
+public:
+    SamplerCache() = default;
+    ~SamplerCache() = default;
+
+    SamplerCache(const SamplerCache&) = delete;
+    SamplerCache& operator=(const SamplerCache&) = delete;
+    SamplerCache(SamplerCache&&) noexcept = delete;
+    SamplerCache& operator=(SamplerCache&&) noexcept = delete;
+
+    /// \brief Get the sampler for \p state, creating it on first use.
+    [[nodiscard]] std::shared_ptr<Sampler> get(const SamplerState& state);
+
+    [[nodiscard]] std::size_t size() const noexcept { return m_samplers.size(); }
+    /// \brief Drop every sampler, samplers that are still in use stay alive until their last user releases them.
+    void clear() noexcept { m_samplers.clear(); }
+
+private:
+    std::unordered_map<SamplerState, std::shared_ptr<Sampler>, SamplerStateHash> m_samplers;
+};
+
+} // namespace sfa
+
+#endif // !SFA_SRC_ENGINE_CORE_SAMPLER_HPP
@@ -1,7 +1,9 @@
 #include "SpriteRenderer.hpp"
 
+#include "Sampler.hpp"
 #include "Shader.hpp"
 #include "Texture.hpp"
+#include "Utility.hpp"
 
 #include "glad/gl.h"
 #include "glm/ext/matrix_transform.hpp"
@@ -13,8 +15,13 @@
 namespace sfa
 {
 
-SpriteRenderer::SpriteRenderer(std::shared_ptr<Shader> shader) : m_shader(std::move(shader))
+SpriteRenderer::SpriteRenderer(std::shared_ptr<Shader> shader, std::shared_ptr<Sampler> sampler)
+    : m_shader(std::move(shader))
+    , m_defaultSampler(std::move(sampler))
+    , m_sampler(m_defaultSampler)
 {
+    SFA_ASSERT(m_defaultSampler != nullptr, "SpriteRenderer needs a sampler to sample textures with");
+
     glGenVertexArrays(1, &m_quadVAO);
     unsigned int VBO{};
     glGenBuffers(1, &VBO);
@@ -41,6 +48,7 @@ SpriteRenderer::SpriteRenderer(std::shared_ptr<Shader> shader) : m_shader(std::m
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, 0);
     glBindTexture(GL_TEXTURE_2D, 0);
 }
 
@@ -91,11 +99,19 @@ void SpriteRenderer::draw(
         texture->bind();
     else
         glBindTexture(GL_TEXTURE_2D, m_fallbackTexture);
+    m_sampler->bind(0);
 
     glBindVertexArray(m_quadVAO);
     glDrawArrays(GL_TRIANGLES, 0, SPRITE_VERTICES);
 
     glBindVertexArray(0);
+    // NOTE: Renderers that rely on the parameters of their own textures share the texture unit
+    Sampler::unbind(0);
+}
+
+void SpriteRenderer::setSampler(std::shared_ptr<Sampler> sampler)
+{
+    m_sampler = (sampler != nullptr) ? std::move(sampler) : m_defaultSampler;
 }
 
 } // namespace sfa
@@ -1,8 +1,10 @@
 #ifndef SFA_SRC_ENGINE_CORE_SPRITE_RENDERER_HPP
 #define SFA_SRC_ENGINE_CORE_SPRITE_RENDERER_HPP
 
+#include "Sampler.hpp"
 #include "Shader.hpp"
 #include "Texture.hpp"
+#include "core/ISpriteRenderer.hpp"
 
 #include "glm/glm.hpp"
 
@@ -21,14 +23,15 @@ namespace sfa
 ///
 /// \author Felix Hommel
 /// \date 11/17/2024
-class SpriteRenderer
+class SpriteRenderer : public ISpriteRenderer
 {
 public:
     /// \brief Create a new \ref SpriteRenderer
     ///
     /// \param shader the \ref Shader that will be used to render this quad
-    explicit SpriteRenderer(std::shared_ptr<Shader> shader);
-    ~SpriteRenderer();
+    /// \param sampler how textures are sampled, share one from a \ref SamplerCache between renderers
+    SpriteRenderer(std::shared_ptr<Shader> shader, std::shared_ptr<Sampler> sampler);
+    ~SpriteRenderer() override;
 
     SpriteRenderer(const SpriteRenderer&) = delete;
     SpriteRenderer(SpriteRenderer&&) = delete;
@@ -38,7 +41,7 @@ public:
     /// \brief Prepare the renderer for drawing the next frame.
     ///
     /// \param projection the projection matrix
-    void beginFrame(const glm::mat4& projection);
+    void beginFrame(const glm::mat4& projection) override;
 
     /// \brief Draw a textured quad to the screen
     ///
@@ -61,7 +64,12 @@ public:
         const glm::vec2& scale = DEFAULT_DRAW_SCALE,
         float rotate = DEFAULT_ROTATION,
         const glm::vec3& color = DEFAULT_COLOR
-    );
+    ) override;
+
+    /// \brief Sample the textures of every following quad through \p sampler.
+    ///
+    /// \param sampler the new sampler, *nullptr* restores the one passed on construction
+    void setSampler(std::shared_ptr<Sampler> sampler) override;
 
 private:
     static constexpr std::size_t SPRITE_VERTICES{ 6 };
@@ -70,11 +78,10 @@ private:
         0.0f, 1.0f, 0.0f, 1.0f, 1.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
         0.0f, 1.0f, 0.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 0.0f, 1.0f, 0.0f
     };
-    static constexpr auto DEFAULT_DRAW_SCALE{ glm::vec2(10.f) };
-    static constexpr auto DEFAULT_ROTATION{ 0.f };
-    static constexpr auto DEFAULT_COLOR{ glm::vec3(1.f) };
 
     std::shared_ptr<Shader> m_shader;
+    std::shared_ptr<Sampler> m_defaultSampler;
+    std::shared_ptr<Sampler> m_sampler;
     unsigned int m_quadVAO{ 0 };
     unsigned int m_fallbackTexture{ 0 };
 };
@@ -2,6 +2,7 @@
 #define SFA_SRC_ENGINE_CORE_TEXT_RENDERER_HPP
 
 #include "Shader.hpp"
+#include "core/ITextRenderer.hpp"
 
 #include <glm/glm.hpp>
 
@@ -26,16 +27,6 @@ struct Character
     unsigned int advance;   ///< horizontal offset to advance to next glyph
 };
 
-/// \brief Information about the dimensions and bounds of a string.
-///
-/// \author Felix Hommel
-/// \date 3/2/2026
-struct TextBounds
-{
-    glm::vec2 min{ 0.f };
-    glm::vec2 size{ 0.f };
-};
-
 /// \brief Abstraction for rendering Text on the screen.
 ///
 /// Rendering text is a quite difficult task, therefore this class abstracts it in a way where
@@ -43,11 +34,11 @@ struct TextBounds
 ///
 /// \author Felix Hommel
 /// \date 11/17/2024
-class TextRenderer
+class TextRenderer : public ITextRenderer
 {
 public:
     explicit TextRenderer(std::shared_ptr<Shader> shader);
-    ~TextRenderer();
+    ~TextRenderer() override;
 
     TextRenderer(const TextRenderer&) = delete;
     TextRenderer& operator=(const TextRenderer&) = delete;
@@ -63,7 +54,7 @@ public:
     /// \brief Begin the drawing of the next frame.
     ///
     /// \param projection projection matrix
-    void beginFrame(const glm::mat4& projection);
+    void beginFrame(const glm::mat4& projection) override;
 
     /// \brief Render text to the screen.
     ///
@@ -76,18 +67,19 @@ public:
         const glm::vec2& pos,
         const glm::vec2& scale = DEFAULT_SCALE,
         glm::vec3 color = DEFAULT_COLOR
-    );
+    ) override;
 
     /// \brief Estimate bounds of rendered text for the current loaded font.
     ///
     /// \param text the string that is measured
     /// \param scale the scale of the text
-    [[nodiscard]] TextBounds measureBounds(const std::string& text, const glm::vec2& scale = DEFAULT_SCALE) const;
+    [[nodiscard]] TextBounds measureBounds(const std::string& text, const glm::vec2& scale = DEFAULT_SCALE)
+        const override;
     /// \brief Estimate the rendered dimensions of a text string for the currently loaded font.
     ///
     /// \param text the string that is measured
     /// \param scale the scale of the text
-    [[nodiscard]] glm::vec2 measure(const std::string& text, const glm::vec2& scale = DEFAULT_SCALE) const;
+    [[nodiscard]] glm::vec2 measure(const std::string& text, const glm::vec2& scale = DEFAULT_SCALE) const override;
 
 private:
     static constexpr std::size_t LOADED_ASCII_CHARS{ 128 };
@@ -96,8 +88,6 @@ private:
     static constexpr auto ADVANCE_BITSHIFT{ 6 };
 
     static constexpr auto DEFAULT_FONT_SIZE{ 24 };
-    static constexpr auto DEFAULT_SCALE{ glm::vec2(1.f) };
-    static constexpr auto DEFAULT_COLOR{ glm::vec3(1.f) };
 
     std::shared_ptr<Shader> m_shader;
     unsigned int m_vao{ 0 };
@@ -1,16 +1,56 @@
 #include "Texture.hpp"
 
+#include "core/Mipmaps.hpp"
+#include "core/TextureCompression.hpp"
+
 #include <glad/gl.h>
 
+#include <algorithm>
 #include <cstddef>
 #include <span>
 #include <utility>
+#include <vector>
 
 namespace sfa
 {
 
-Texture2D::Texture2D(int width, int height, int channels, std::span<const std::byte> pixels)
-    : m_width{ width }, m_height{ height }
+namespace
+{
+
+// NOTE: Spelled out, the loaded OpenGL 3.3 core profile doesn't define the S3TC and ETC2 enums
+constexpr GLenum COMPRESSED_RGB_S3TC_DXT1{ 0x83f0 };
+constexpr GLenum COMPRESSED_RGBA_S3TC_DXT1{ 0x83f1 };
+constexpr GLenum COMPRESSED_RGBA_S3TC_DXT5{ 0x83f3 };
+constexpr GLenum COMPRESSED_RGB8_ETC2{ 0x9274 };
+constexpr GLenum COMPRESSED_RGBA8_ETC2_EAC{ 0x9278 };
+
+GLenum compressedFormat(TextureCompression compression)
+{
+    switch(compression)
+    {
+        case TextureCompression::Bc1Rgb:
+            return COMPRESSED_RGB_S3TC_DXT1;
+        case TextureCompression::Bc1Rgba:
+            return COMPRESSED_RGBA_S3TC_DXT1;
+        case TextureCompression::Bc3Rgba:
+            return COMPRESSED_RGBA_S3TC_DXT5;
+        case TextureCompression::Etc2Rgb:
+            return COMPRESSED_RGB8_ETC2;
+        case TextureCompression::Etc2Rgba:
+            return COMPRESSED_RGBA8_ETC2_EAC;
+        case TextureCompression::None:
+            break;
+    }
+
+    return GL_NONE;
+}
+
+} // namespace
+
+Texture2D::Texture2D(int width, int height, int channels, std::span<const std::byte> pixels, int mipLevels)
+    : m_width{ width }
+    , m_height{ height }
+    , m_mipLevels{ std::clamp(mipLevels, 1, std::max(mipLevelCount(width, height), 1)) }
 {
     if(channels == RGBA_CHANNELS)
         setRGBA();
@@ -18,23 +58,59 @@ Texture2D::Texture2D(int width, int height, int channels, std::span<const std::b
     glGenTextures(1, &m_id);
 
     glBindTexture(GL_TEXTURE_2D, m_id);
-    glTexImage2D(
+
+    // NOTE: Decoded rows are tightly packed, an RGB row doesn't have to end on a 4 byte boundary
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    std::size_t offset{ 0 };
+    for(int level{ 0 }; level < m_mipLevels; ++level)
+    {
+        const auto levelWidth{ std::max(m_width >> level, 1) };
+        const auto levelHeight{ std::max(m_height >> level, 1) };
+        const auto* data{ pixels.empty() ? nullptr : pixels.data() + offset };
+        glTexImage2D(
+            GL_TEXTURE_2D,
+            level,
+            m_internalFormat,
+            levelWidth,
+            levelHeight,
+            0,
+            m_imageFormat,
+            GL_UNSIGNED_BYTE,
+            static_cast<const void*>(data)
+        );
+
+        offset += mipChainSize(levelWidth, levelHeight, channels, 1);
+    }
+    glPixelStorei(GL_UNPACK_ALIGNMENT, DEFAULT_UNPACK_ALIGNMENT);
+
+    setLevelRange();
+
+    glBindTexture(GL_TEXTURE_2D, 0);
+}
+
+Texture2D::Texture2D(int width, int height, TextureCompression compression, std::span<const std::byte> blocks)
+    : m_width{ width }
+    , m_height{ height }
+    , m_internalFormat{ static_cast<int>(compressedFormat(compression)) }
+    , m_imageFormat{ GL_RGBA }
+    , m_compression{ compression }
+{
+    glGenTextures(1, &m_id);
+
+    glBindTexture(GL_TEXTURE_2D, m_id);
+
+    glCompressedTexImage2D(
         GL_TEXTURE_2D,
         0,
-        m_internalFormat,
+        static_cast<GLenum>(m_internalFormat),
         m_width,
         m_height,
         0,
-        m_imageFormat,
-        GL_UNSIGNED_BYTE,
-        static_cast<const void*>(pixels.data())
+        static_cast<GLsizei>(blocks.size()),
+        static_cast<const void*>(blocks.data())
     );
 
-    // NOTE: Maybe GL_UNPACK_ALIGNMENT needs to be configured with glPixelStorei(...)
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, m_wrapS);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, m_wrapT);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, m_filterMin);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, m_filterMax);
+    setLevelRange();
 
     glBindTexture(GL_TEXTURE_2D, 0);
 }
@@ -50,10 +126,8 @@ Texture2D::Texture2D(Texture2D&& other) noexcept
     , m_height(std::exchange(other.m_height, 0))
     , m_internalFormat(std::exchange(other.m_internalFormat, GL_RGB))
     , m_imageFormat(std::exchange(other.m_imageFormat, GL_RGB))
-    , m_wrapS(std::exchange(other.m_wrapS, GL_REPEAT))
-    , m_wrapT(std::exchange(other.m_wrapT, GL_REPEAT))
-    , m_filterMin(std::exchange(other.m_filterMin, GL_LINEAR))
-    , m_filterMax(std::exchange(other.m_filterMax, GL_LINEAR))
+    , m_compression(std::exchange(other.m_compression, TextureCompression::None))
+    , m_mipLevels(std::exchange(other.m_mipLevels, 1))
 {}
 
 Texture2D& Texture2D::operator=(Texture2D&& other) noexcept
@@ -68,25 +142,104 @@ Texture2D& Texture2D::operator=(Texture2D&& other) noexcept
     m_height = std::exchange(other.m_height, 0);
     m_internalFormat = std::exchange(other.m_internalFormat, GL_RGB);
     m_imageFormat = std::exchange(other.m_imageFormat, GL_RGB);
-    m_wrapS = std::exchange(other.m_wrapS, GL_REPEAT);
-    m_wrapT = std::exchange(other.m_wrapT, GL_REPEAT);
-    m_filterMin = std::exchange(other.m_filterMin, GL_LINEAR);
-    m_filterMax = std::exchange(other.m_filterMax, GL_LINEAR);
+    m_compression = std::exchange(other.m_compression, TextureCompression::None);
+    m_mipLevels = std::exchange(other.m_mipLevels, 1);
 
     return *this;
 }
 
+bool Texture2D::supports(TextureCompression compression)
+{
+    if(compression == TextureCompression::None)
+        return true;
+
+    GLint count{ 0 };
+    glGetIntegerv(GL_NUM_COMPRESSED_TEXTURE_FORMATS, &count);
+    if(count <= 0)
+        return false;
+
+    std::vector<GLint> formats(static_cast<std::size_t>(count));
+    glGetIntegerv(GL_COMPRESSED_TEXTURE_FORMATS, formats.data());
+
+    return std::ranges::find(formats, static_cast<GLint>(compressedFormat(compression))) != formats.end();
+}
+
 void Texture2D::bind() const
 {
     glBindTexture(GL_TEXTURE_2D, m_id);
 }
 
+void Texture2D::uploadRows(int firstRow, int rowCount, const void* pixels) const
+{
+    glBindTexture(GL_TEXTURE_2D, m_id);
+
+    // NOTE: Rows are tightly packed, an RGB row doesn't have to end on a 4 byte boundary
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    glTexSubImage2D(
+        GL_TEXTURE_2D, 0, 0, firstRow, m_width, rowCount, static_cast<GLenum>(m_imageFormat), GL_UNSIGNED_BYTE, pixels
+    );
+    glPixelStorei(GL_UNPACK_ALIGNMENT, DEFAULT_UNPACK_ALIGNMENT);
+
+    glBindTexture(GL_TEXTURE_2D, 0);
+}
+
+void Texture2D::uploadLevel(int level, const void* pixels) const
+{
+    glBindTexture(GL_TEXTURE_2D, m_id);
+
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    glTexSubImage2D(
+        GL_TEXTURE_2D,
+        level,
+        0,
+        0,
+        std::max(m_width >> level, 1),
+        std::max(m_height >> level, 1),
+        static_cast<GLenum>(m_imageFormat),
+        GL_UNSIGNED_BYTE,
+        pixels
+    );
+    glPixelStorei(GL_UNPACK_ALIGNMENT, DEFAULT_UNPACK_ALIGNMENT);
+
+    glBindTexture(GL_TEXTURE_2D, 0);
+}
+
+void Texture2D::generateMipmaps()
+{
+    if(m_compression != TextureCompression::None)
+        return;
+
+    m_mipLevels = std::max(mipLevelCount(m_width, m_height), 1);
+
+    glBindTexture(GL_TEXTURE_2D, m_id);
+    setLevelRange();
+    glGenerateMipmap(GL_TEXTURE_2D);
+    glBindTexture(GL_TEXTURE_2D, 0);
+}
+
+std::size_t Texture2D::gpuSize() const noexcept
+{
+    if(m_compression != TextureCompression::None)
+        return compressedSize(m_compression, m_width, m_height);
+
+    return mipChainSize(m_width, m_height, RGBA_CHANNELS, m_mipLevels);
+}
+
 void Texture2D::setRGBA()
 {
     m_imageFormat = GL_RGBA;
     m_internalFormat = GL_RGBA;
 }
 
+/// \brief Limit the bound texture to the levels it holds.
+///
+/// Keeps the texture complete for samplers that filter between mip levels, even without a full mip chain.
+void Texture2D::setLevelRange() const
+{
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, 0);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, m_mipLevels - 1);
+}
+
 /// \brief If the \ref Texture is holding a valid texture ID delete it.
 void Texture2D::releaseTexture() const
 {
@@ -1,6 +1,9 @@
 #ifndef SFA_SRC_ENGINE_CORE_TEXTURE_HPP
 #define SFA_SRC_ENGINE_CORE_TEXTURE_HPP
 
+#include "core/PixelBuffer.hpp"
+#include "core/TextureCompression.hpp"
+
 #include <glad/gl.h>
 
 #include <cstddef>
@@ -11,7 +14,8 @@ namespace sfa
 
 /// \brief Abstracts OpenGL Textures.
 ///
-/// Holds all the information of a Texture and registers it within OpenGL.
+/// Holds all the information of a Texture and registers it within OpenGL. A texture only holds its levels, how it is
+/// sampled is up to the \ref Sampler bound to its texture unit while drawing.
 ///
 /// \author Felix Hommel
 /// \date 11/17/2024
@@ -23,8 +27,22 @@ public:
     /// \param width the width of the texture
     /// \param height the height of the texture
     /// \param channels the amount of channels that the texture has
-    /// \param pixels the image data
-    Texture2D(int width, int height, int channels, std::span<const std::byte> pixels);
+    /// \param pixels the image data, empty to only allocate the storage and fill it with \ref Texture2D::uploadRows
+    /// and \ref Texture2D::uploadLevel
+    /// \param mipLevels (optional) amount of levels in \p pixels, each directly following the previous one
+    Texture2D(int width, int height, int channels, std::span<const std::byte> pixels, int mipLevels = 1);
+    /// \brief Create a new \ref Texture2D straight from decoded pixels, without copying them first.
+    Texture2D(int width, int height, int channels, const PixelBuffer& pixels, int mipLevels = 1)
+        : Texture2D(width, height, channels, pixels.bytes(), mipLevels)
+    {
+    }
+    /// \brief Create a new \ref Texture2D from block compressed data, which the GPU samples from without decoding it.
+    ///
+    /// \param width the width of the texture
+    /// \param height the height of the texture
+    /// \param compression format of \p blocks, has to be supported by the driver, see \ref Texture2D::supports
+    /// \param blocks the compressed blocks of the texture
+    Texture2D(int width, int height, TextureCompression compression, std::span<const std::byte> blocks);
     ~Texture2D();
 
     Texture2D(Texture2D&& other) noexcept;
@@ -33,29 +51,64 @@ public:
     Texture2D(const Texture2D&) = delete;
     Texture2D& operator=(const Texture2D&) = delete;
 
+    /// \brief Check if the driver can sample from textures compressed in \p compression.
+    ///
+    /// \note Requires a current OpenGL context.
+    [[nodiscard]] static bool supports(TextureCompression compression);
+
     /// \brief Bind the texture to the OpenGL state.
     void bind() const;
 
+    /// \brief Overwrite \p rowCount rows of the texture, starting at \p firstRow.
+    ///
+    /// \param firstRow index of the first row that is overwritten
+    /// \param rowCount amount of rows that are overwritten
+    /// \param pixels tightly packed rows, an offset into the bound GL_PIXEL_UNPACK_BUFFER if there is one
+    void uploadRows(int firstRow, int rowCount, const void* pixels) const;
+    /// \brief Overwrite the whole mip level \p level, which the texture has to have been created with.
+    ///
+    /// \param level index of the level, 0 is the full resolution one
+    /// \param pixels tightly packed pixels of the level
+    void uploadLevel(int level, const void* pixels) const;
+    /// \brief Let the driver generate the full mip chain from the full resolution level.
+    ///
+    /// Does nothing for compressed textures, which not every driver can generate mip levels of.
+    void generateMipmaps();
+
     [[nodiscard]] unsigned int getID() const noexcept { return m_id; }
     [[nodiscard]] int width() const noexcept { return m_width; }
     [[nodiscard]] int height() const noexcept { return m_height; }
+    [[nodiscard]] TextureCompression compression() const noexcept { return m_compression; }
+    [[nodiscard]] int mipLevels() const noexcept { return m_mipLevels; }
+    /// \brief Estimate of the video memory the texture takes up, in bytes.
+    ///
+    /// Counts every mip level, uncompressed RGB textures as 4 bytes per pixel since drivers pad them to RGBA.
+    [[nodiscard]] std::size_t gpuSize() const noexcept;
+    /// \brief Size of one tightly packed row of pixels, in bytes.
+    [[nodiscard]] std::size_t rowSize() const noexcept
+    {
+        return static_cast<std::size_t>(m_width)
+             * static_cast<std::size_t>(m_imageFormat == GL_RGBA ? RGBA_CHANNELS : RGB_CHANNELS);
+    }
 
     /// \brief Configure the texture as an RGBA texture.
     void setRGBA();
 
 private:
+    static constexpr auto RGB_CHANNELS{ 3 };
     static constexpr auto RGBA_CHANNELS{ 4 };
+    /// \brief OpenGL's initial GL_UNPACK_ALIGNMENT.
+    static constexpr auto DEFAULT_UNPACK_ALIGNMENT{ 4 };
 
     unsigned int m_id{ 0 };
     int m_width{ 0 };
     int m_height{ 0 };
     int m_internalFormat{ GL_RGB };
     int m_imageFormat{ GL_RGB };
-    int m_wrapS{ GL_REPEAT };
-    int m_wrapT{ GL_REPEAT };
-    int m_filterMin{ GL_LINEAR };
-    int m_filterMax{ GL_LINEAR };
+    TextureCompression m_compression{ TextureCompression::None };
+    int m_mipLevels{ 1 };
 
+    void setLevelRange() const;
     void releaseTexture() const;
 };
 
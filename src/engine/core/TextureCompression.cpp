@@ -0,0 +1,199 @@
+#include "TextureCompression.hpp"
+
+#include "core/PixelBuffer.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+namespace sfa
+{
+
+namespace
+{
+
+constexpr std::size_t RGBA_CHANNELS{ 4 };
+constexpr auto BLOCK_SIDE{ static_cast<std::size_t>(COMPRESSED_BLOCK_SIZE) };
+constexpr std::size_t BLOCK_TEXELS{ BLOCK_SIDE * BLOCK_SIDE };
+constexpr std::size_t SMALL_BLOCK_SIZE{ 8 };
+constexpr std::size_t LARGE_BLOCK_SIZE{ 16 };
+
+using Color = std::array<std::uint8_t, RGBA_CHANNELS>;
+
+std::uint32_t readLittleEndian(std::span<const std::byte> bytes)
+{
+    std::uint32_t value{ 0 };
+    for(std::size_t i{ bytes.size() }; i > 0; --i)
+        value = (value << 8u) | static_cast<std::uint32_t>(bytes[i - 1]);
+
+    return value;
+}
+
+/// \brief Expand a 5 or 6 bit channel to 8 bits, so the highest value maps to 255.
+std::uint8_t expand(std::uint32_t value, unsigned int bits)
+{
+    return static_cast<std::uint8_t>((value << (8u - bits)) | (value >> (2u * bits - 8u)));
+}
+
+Color unpackRgb565(std::uint32_t color)
+{
+    constexpr std::uint32_t FIVE_BITS{ 0x1f };
+    constexpr std::uint32_t SIX_BITS{ 0x3f };
+
+    return { expand((color >> 11u) & FIVE_BITS, 5),
+             expand((color >> 5u) & SIX_BITS, 6),
+             expand(color & FIVE_BITS, 5),
+             UINT8_MAX };
+}
+
+/// \brief Mix \p a and \p b with the weights \p weightA and \p weightB, rounding down like the reference decoder.
+Color mix(const Color& a, const Color& b, std::uint32_t weightA, std::uint32_t weightB)
+{
+    Color color{};
+    for(std::size_t c{ 0 }; c < RGBA_CHANNELS; ++c)
+        color[c] = static_cast<std::uint8_t>((weightA * a[c] + weightB * b[c]) / (weightA + weightB));
+
+    return color;
+}
+
+/// \brief Decode the 8 byte color part of a BC1 or BC3 block into its 16 texels.
+///
+/// \param alpha *true* if a BC1 block may use its fourth color as transparent black
+/// \param forceFourColors *true* for the color part of BC3 blocks, which always interpolates two colors
+std::array<Color, BLOCK_TEXELS> decodeColorBlock(std::span<const std::byte> block, bool alpha, bool forceFourColors)
+{
+    const auto packed0{ readLittleEndian(block.subspan(0, 2)) };
+    const auto packed1{ readLittleEndian(block.subspan(2, 2)) };
+    const auto indices{ readLittleEndian(block.subspan(4, 4)) };
+
+    std::array<Color, 4> palette{ unpackRgb565(packed0), unpackRgb565(packed1) };
+    if(forceFourColors || packed0 > packed1)
+    {
+        palette[2] = mix(palette[0], palette[1], 2, 1);
+        palette[3] = mix(palette[0], palette[1], 1, 2);
+    }
+    else
+    {
+        palette[2] = mix(palette[0], palette[1], 1, 1);
+        palette[3] = { 0, 0, 0, static_cast<std::uint8_t>(alpha ? 0 : UINT8_MAX) };
+    }
+
+    std::array<Color, BLOCK_TEXELS> texels{};
+    for(std::size_t i{ 0 }; i < BLOCK_TEXELS; ++i)
+        texels[i] = palette[(indices >> (2 * i)) & 0x3u];
+
+    return texels;
+}
+
+/// \brief Decode the 8 byte alpha part of a BC3 block into the alpha of its 16 texels.
+void decodeAlphaBlock(std::span<const std::byte> block, std::array<Color, BLOCK_TEXELS>& texels)
+{
+    const auto alpha0{ static_cast<std::uint32_t>(block[0]) };
+    const auto alpha1{ static_cast<std::uint32_t>(block[1]) };
+
+    std::array<std::uint32_t, 8> palette{ alpha0, alpha1 };
+    if(alpha0 > alpha1)
+    {
+        for(std::uint32_t i{ 1 }; i < 7; ++i)
+            palette[i + 1] = ((7 - i) * alpha0 + i * alpha1) / 7;
+    }
+    else
+    {
+        for(std::uint32_t i{ 1 }; i < 5; ++i)
+            palette[i + 1] = ((5 - i) * alpha0 + i * alpha1) / 5;
+        palette[6] = 0;
+        palette[7] = UINT8_MAX;
+    }
+
+    // NOTE: 16 indices of 3 bits each, packed little endian into the remaining 6 bytes
+    std::uint64_t indices{ 0 };
+    for(std::size_t i{ 7 }; i >= 2; --i)
+        indices = (indices << 8u) | static_cast<std::uint64_t>(block[i]);
+
+    for(std::size_t i{ 0 }; i < BLOCK_TEXELS; ++i)
+        texels[i][3] = static_cast<std::uint8_t>(palette[(indices >> (3 * i)) & 0x7u]);
+}
+
+} // namespace
+
+std::size_t blockSize(TextureCompression compression) noexcept
+{
+    switch(compression)
+    {
+        case TextureCompression::Bc1Rgb:
+        case TextureCompression::Bc1Rgba:
+        case TextureCompression::Etc2Rgb:
+            return SMALL_BLOCK_SIZE;
+        case TextureCompression::Bc3Rgba:
+        case TextureCompression::Etc2Rgba:
+            return LARGE_BLOCK_SIZE;
+        case TextureCompression::None:
+            break;
+    }
+
+    return 0;
+}
+
+std::size_t compressedSize(TextureCompression compression, int width, int height) noexcept
+{
+    if(width <= 0 || height <= 0)
+        return 0;
+
+    const auto blocksX{ static_cast<std::size_t>((width + COMPRESSED_BLOCK_SIZE - 1) / COMPRESSED_BLOCK_SIZE) };
+    const auto blocksY{ static_cast<std::size_t>((height + COMPRESSED_BLOCK_SIZE - 1) / COMPRESSED_BLOCK_SIZE) };
+
+    return blocksX * blocksY * blockSize(compression);
+}
+
+bool canDecompress(TextureCompression compression) noexcept
+{
+    return compression == TextureCompression::Bc1Rgb || compression == TextureCompression::Bc1Rgba
+        || compression == TextureCompression::Bc3Rgba;
+}
+
+PixelBuffer decompress(TextureCompression compression, int width, int height, std::span<const std::byte> blocks)
+{
+    const auto size{ compressedSize(compression, width, height) };
+    if(!canDecompress(compression) || size == 0 || blocks.size() < size)
+        return {};
+
+    const auto w{ static_cast<std::size_t>(width) };
+    const auto h{ static_cast<std::size_t>(height) };
+    const auto block{ blockSize(compression) };
+    const auto blocksX{ (w + BLOCK_SIDE - 1) / BLOCK_SIDE };
+
+    auto pixels{ PixelBuffer::allocate(w * h * RGBA_CHANNELS) };
+    for(std::size_t index{ 0 }; index * block < size; ++index)
+    {
+        const auto data{ blocks.subspan(index * block, block) };
+
+        std::array<Color, BLOCK_TEXELS> texels;
+        if(compression == TextureCompression::Bc3Rgba)
+        {
+            texels = decodeColorBlock(data.subspan(SMALL_BLOCK_SIZE), false, true);
+            decodeAlphaBlock(data.first(SMALL_BLOCK_SIZE), texels);
+        }
+        else
+            texels = decodeColorBlock(data, compression == TextureCompression::Bc1Rgba, false);
+
+        // NOTE: Texels of edge blocks that lie outside of the texture are padding and dropped
+        const auto blockX{ (index % blocksX) * BLOCK_SIDE };
+        const auto blockY{ (index / blocksX) * BLOCK_SIDE };
+        for(std::size_t i{ 0 }; i < BLOCK_TEXELS; ++i)
+        {
+            const auto x{ blockX + (i % BLOCK_SIDE) };
+            const auto y{ blockY + (i / BLOCK_SIDE) };
+            if(x >= w || y >= h)
+                continue;
+
+            auto* out{ pixels.data() + (y * w + x) * RGBA_CHANNELS };
+            for(std::size_t c{ 0 }; c < RGBA_CHANNELS; ++c)
+                out[c] = static_cast<std::byte>(texels[i][c]);
+        }
+    }
+
+    return pixels;
+}
+
+} // namespace sfa
@@ -0,0 +1,60 @@
+#ifndef SFA_SRC_ENGINE_CORE_TEXTURE_COMPRESSION_HPP
+#define SFA_SRC_ENGINE_CORE_TEXTURE_COMPRESSION_HPP
+
+#include "core/PixelBuffer.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+namespace sfa
+{
+
+/// \brief Block compressed formats a texture can be stored and uploaded in.
+///
+/// Every format encodes blocks of 4x4 texels, textures whose size isn't a multiple of 4 are padded to whole blocks.
+///
+/// \author Felix Hommel
+/// \date 3/22/2026
+enum class TextureCompression : std::uint8_t
+{
+    None,    ///< uncompressed, as many bytes per texel as the texture has channels
+    Bc1Rgb,  ///< BC1 (DXT1) without alpha, 8 bytes per block
+    Bc1Rgba, ///< BC1 (DXT1) with 1 bit alpha, 8 bytes per block
+    Bc3Rgba, ///< BC3 (DXT5), 16 bytes per block
+    Etc2Rgb, ///< ETC2 RGB8, 8 bytes per block
+    Etc2Rgba ///< ETC2 RGBA8 with EAC alpha, 16 bytes per block
+};
+
+/// \brief Amount of values of \ref TextureCompression, including \ref TextureCompression::None.
+inline constexpr std::size_t TEXTURE_COMPRESSION_COUNT{ 6 };
+
+/// \brief Side length of a compressed block in texels.
+inline constexpr int COMPRESSED_BLOCK_SIZE{ 4 };
+
+/// \returns size of a single block of \p compression in bytes, 0 for \ref TextureCompression::None
+[[nodiscard]] std::size_t blockSize(TextureCompression compression) noexcept;
+
+/// \returns size of a \p width x \p height texture in \p compression in bytes, 0 for \ref TextureCompression::None
+[[nodiscard]] std::size_t compressedSize(TextureCompression compression, int width, int height) noexcept;
+
+/// \returns *true* if \ref decompress can decode \p compression on the CPU
+[[nodiscard]] bool canDecompress(TextureCompression compression) noexcept;
+
+/// \brief Decode a block compressed texture on the CPU, for drivers that can't sample from \p compression.
+///
+/// Supports the BC1 and BC3 formats, see \ref canDecompress.
+///
+/// \param compression format of \p blocks
+/// \param width width of the texture in texels
+/// \param height height of the texture in texels
+/// \param blocks the compressed blocks, row by row
+///
+/// \returns tightly packed RGBA pixels, empty if \p compression can't be decoded or \p blocks is too small
+[[nodiscard]] PixelBuffer decompress(
+    TextureCompression compression, int width, int height, std::span<const std::byte> blocks
+);
+
+} // namespace sfa
+
+#endif // !SFA_SRC_ENGINE_CORE_TEXTURE_COMPRESSION_HPP
@@ -0,0 +1,67 @@
+#include "TextureUploader.hpp"
+
+#include "core/Texture.hpp"
+
+#include <glad/gl.h>
+
+#include <cstddef>
+#include <cstring>
+#include <span>
+
+namespace sfa
+{
+
+TextureUploader::~TextureUploader()
+{
+    if(m_buffers[0] != 0)
+        glDeleteBuffers(static_cast<GLsizei>(BUFFER_COUNT), m_buffers.data());
+}
+
+void TextureUploader::upload(const Texture2D& texture, int firstRow, int rowCount, std::span<const std::byte> pixels)
+{
+    if(!stage(pixels))
+    {
+        texture.uploadRows(firstRow, rowCount, pixels.data());
+        return;
+    }
+
+    // NOTE: With a GL_PIXEL_UNPACK_BUFFER bound the pointer is an offset into it
+    texture.uploadRows(firstRow, rowCount, nullptr);
+
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+}
+
+/// \brief Copy \p pixels into the next pixel buffer and leave it bound.
+///
+/// \returns *false* if the pixels have to be uploaded from client memory instead, nothing is bound then
+bool TextureUploader::stage(std::span<const std::byte> pixels)
+{
+    if(pixels.empty() || pixels.size() > m_bufferSize)
+        return false;
+
+    if(m_buffers[0] == 0)
+        glGenBuffers(static_cast<GLsizei>(BUFFER_COUNT), m_buffers.data());
+
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, m_buffers[m_next]);
+    m_next = (m_next + 1) % BUFFER_COUNT;
+
+    // NOTE: Orphan the old storage, the driver keeps it alive until the transfer reading from it is done
+    const auto size{ static_cast<GLsizeiptr>(pixels.size()) };
+    glBufferData(GL_PIXEL_UNPACK_BUFFER, static_cast<GLsizeiptr>(m_bufferSize), nullptr, GL_STREAM_DRAW);
+
+    constexpr GLbitfield ACCESS{ GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT };
+    if(auto* mapped{ glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, size, ACCESS) })
+    {
+        std::memcpy(mapped, pixels.data(), pixels.size());
+
+        // NOTE: Unmapping fails if the storage got lost in the meantime, its content is undefined then
+        if(glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER) == GL_TRUE)
+            return true;
+    }
+
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+
+    return false;
+}
+
+} // namespace sfa
@@ -0,0 +1,63 @@
+#ifndef SFA_SRC_ENGINE_CORE_TEXTURE_UPLOADER_HPP
+#define SFA_SRC_ENGINE_CORE_TEXTURE_UPLOADER_HPP
+
+#include "core/Texture.hpp"
+
+#include <array>
+#include <cstddef>
+#include <span>
+
+namespace sfa
+{
+
+/// \brief Streams rows of pixels into textures through a ring of pixel buffer objects.
+///
+/// The rows are copied into a mapped GL_PIXEL_UNPACK_BUFFER and glTexSubImage2D reads from there, so the call returns
+/// right away and the driver moves the data to the GPU in the background. Every upload uses the next buffer of the
+/// ring and orphans its previous storage, so writing never waits for a transfer that is still in flight. Chunks larger
+/// than a buffer are uploaded straight from client memory.
+///
+/// The buffers are created on the first upload, so the uploader can be constructed before there is an OpenGL context.
+///
+/// \author Felix Hommel
+/// \date 3/18/2026
+class TextureUploader
+{
+public:
+    /// \brief Size of a single pixel buffer if not specified otherwise, in bytes.
+    static constexpr std::size_t DEFAULT_BUFFER_SIZE{ 4 * 1024 * 1024 };
+    /// \brief Amount of pixel buffers that are cycled through.
+    static constexpr std::size_t BUFFER_COUNT{ 3 };
+
+    /// \brief Create a new \ref TextureUploader
+    ///
+    /// \param bufferSize (optional) size of a single pixel buffer, 0 disables the pixel buffers
+    explicit TextureUploader(std::size_t bufferSize = DEFAULT_BUFFER_SIZE) : m_bufferSize(bufferSize) {}
+    ~TextureUploader();
+
+    TextureUploader(const TextureUploader&) = delete;
+    TextureUploader& operator=(const TextureUploader&) = delete;
+    TextureUploader(TextureUploader&&) = delete;
+    TextureUploader& operator=(TextureUploader&&) = delete;
+
+    /// \brief Overwrite \p rowCount rows of \p texture, starting at \p firstRow.
+    ///
+    /// \param texture texture that is written to
+    /// \param firstRow index of the first row that is overwritten
+    /// \param rowCount amount of rows that are overwritten
+    /// \param pixels tightly packed rows, \ref Texture2D::rowSize times \p rowCount bytes
+    void upload(const Texture2D& texture, int firstRow, int rowCount, std::span<const std::byte> pixels);
+
+    [[nodiscard]] std::size_t bufferSize() const noexcept { return m_bufferSize; }
+
+private:
+    std::size_t m_bufferSize;
+    std::array<unsigned int, BUFFER_COUNT> m_buffers{};
+    std::size_t m_next{ 0 };
+
+    [[nodiscard]] bool stage(std::span<const std::byte> pixels);
+};
+
+} // namespace sfa
+
+#endif // !SFA_SRC_ENGINE_CORE_TEXTURE_UPLOADER_HPP
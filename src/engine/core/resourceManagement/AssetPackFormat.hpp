@@ -0,0 +1,73 @@
+#ifndef SFA_SRC_ENGINE_CORE_RESOURCE_MANAGEMENT_ASSET_PACK_FORMAT_HPP
+#define SFA_SRC_ENGINE_CORE_RESOURCE_MANAGEMENT_ASSET_PACK_FORMAT_HPP
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+/// \brief Binary layout of an asset pack, shared by \ref sfa::AssetPackWriter and \ref sfa::AssetPackLoader.
+///
+/// A pack is laid out as
+///
+///     Header | entry data ... | Entry[entryCount] | names
+///
+/// The data of every entry starts on a \ref sfa::assetPack::DATA_ALIGNMENT boundary. Entries are sorted by their name,
+/// which is the path of the packed file relative to the packed directory with '/' as separator. Textures are stored
+/// decoded and tightly packed, followed by their smaller mip levels if the pack was baked with them. All values are
+/// stored in the byte order of the machine, which has to be little endian.
+namespace sfa::assetPack
+{
+
+static_assert(std::endian::native == std::endian::little, "Asset packs are stored little endian");
+
+inline constexpr std::array<char, 4> MAGIC{ 'S', 'F', 'A', 'P' };
+inline constexpr std::uint32_t VERSION{ 1 };
+inline constexpr std::size_t DATA_ALIGNMENT{ 16 };
+
+/// \brief What the data of an \ref Entry holds.
+enum class EntryType : std::uint32_t
+{
+    Texture, ///< decoded pixels or compressed blocks, see \ref Entry::width and \ref Entry::compression
+    Data     ///< the packed file as is, e.g. shader sources or JSON configs
+};
+
+/// \brief Start of every pack.
+///
+/// \author Felix Hommel
+/// \date 3/20/2026
+struct Header
+{
+    std::array<char, 4> magic{ MAGIC };
+    std::uint32_t version{ VERSION };
+    std::uint32_t entryCount{ 0 };
+    std::uint32_t namesSize{ 0 };
+    std::uint64_t entriesOffset{ 0 };
+    std::uint64_t namesOffset{ 0 };
+};
+
+/// \brief Index entry of a single packed file.
+///
+/// \author Felix Hommel
+/// \date 3/20/2026
+struct Entry
+{
+    std::uint64_t dataOffset{ 0 };
+    std::uint64_t dataSize{ 0 };
+    std::uint32_t nameOffset{ 0 }; ///< offset into the names of the pack
+    std::uint32_t nameSize{ 0 };
+    EntryType type{ EntryType::Data };
+    std::int32_t width{ 0 };
+    std::int32_t height{ 0 };
+    std::int32_t channels{ 0 };
+    std::uint32_t mipLevels{ 0 };   ///< amount of stored levels including the full resolution one, 0 for data
+    std::uint32_t compression{ 0 }; ///< \ref TextureCompression of the texture data, 0 (None) for decoded pixels
+};
+
+static_assert(std::is_trivially_copyable_v<Header> && sizeof(Header) == 32);
+static_assert(std::is_trivially_copyable_v<Entry> && sizeof(Entry) == 48);
+
+} // namespace sfa::assetPack
+
+#endif // !SFA_SRC_ENGINE_CORE_RESOURCE_MANAGEMENT_ASSET_PACK_FORMAT_HPP
@@ -0,0 +1,238 @@
+#include "AssetPackLoader.hpp"
+
+#include "core/Mipmaps.hpp"
+#include "core/PixelBuffer.hpp"
+#include "core/TextureCompression.hpp"
+#include "core/resourceManagement/AssetPackFormat.hpp"
+#include "core/resourceManagement/IntermediateResourceData.hpp"
+#include "core/resourceManagement/MappedFile.hpp"
+#include "core/resourceManagement/ResourceError.hpp"
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <expected>
+#include <filesystem>
+#include <memory>
+#include <span>
+#include <string>
+#include <string_view>
+#include <utility>
+
+namespace sfa
+{
+
+namespace
+{
+
+/// \brief Check if \p size bytes starting at \p offset lie within \p total bytes, without overflowing.
+bool fits(std::uint64_t offset, std::uint64_t size, std::uint64_t total)
+{
+    return offset <= total && size <= total - offset;
+}
+
+TextureCompression compressionOf(const assetPack::Entry& entry)
+{
+    return static_cast<TextureCompression>(entry.compression);
+}
+
+std::uint64_t levelSize(const assetPack::Entry& entry)
+{
+    if(compressionOf(entry) != TextureCompression::None)
+        return compressedSize(compressionOf(entry), entry.width, entry.height);
+
+    return static_cast<std::uint64_t>(entry.width) * static_cast<std::uint64_t>(entry.height)
+         * static_cast<std::uint64_t>(entry.channels);
+}
+
+/// \brief Amount of levels stored for a texture, compressed textures only store their full resolution level.
+int storedLevels(const assetPack::Entry& entry)
+{
+    if(compressionOf(entry) != TextureCompression::None)
+        return 1;
+
+    return std::clamp(static_cast<int>(entry.mipLevels), 1, mipLevelCount(entry.width, entry.height));
+}
+
+/// \brief Size of every level stored for a texture.
+std::uint64_t storedSize(const assetPack::Entry& entry)
+{
+    if(compressionOf(entry) != TextureCompression::None)
+        return levelSize(entry);
+
+    return mipChainSize(entry.width, entry.height, entry.channels, storedLevels(entry));
+}
+
+} // namespace
+
+AssetPackLoader::AssetPackLoader(MappedFile file, std::filesystem::path root)
+    : m_file(std::move(file)), m_root(std::move(root).lexically_normal())
+{
+}
+
+std::expected<std::unique_ptr<AssetPackLoader>, ResourceError> AssetPackLoader::open(
+    const std::filesystem::path& filepath, std::filesystem::path root
+)
+{
+    auto file{ MappedFile::open(filepath) };
+    if(!file)
+        return std::unexpected(file.error());
+
+    // NOTE: The constructor is private, so std::make_unique can't be used
+    std::unique_ptr<AssetPackLoader> loader{ new AssetPackLoader(std::move(*file), std::move(root)) };
+    if(auto index{ loader->readIndex(filepath) }; !index)
+        return std::unexpected(index.error());
+
+    return loader;
+}
+
+LoadResult AssetPackLoader::loadShader(
+    const std::filesystem::path& vert, const std::filesystem::path& frag, const std::filesystem::path& geom
+)
+{
+    ShaderSourceData data;
+
+    auto result{ loadText(vert) };
+    if(!result)
+        return std::unexpected(result.error());
+    data.vertexSource = std::move(*result);
+
+    result = loadText(frag);
+    if(!result)
+        return std::unexpected(result.error());
+    data.fragmentSource = std::move(*result);
+
+    if(!geom.empty())
+    {
+        result = loadText(geom);
+        if(!result)
+            return std::unexpected(result.error());
+        data.geometrySource = std::move(*result);
+    }
+
+    return ResourceData{ std::move(data) };
+}
+
+LoadResult AssetPackLoader::loadTexture(const std::filesystem::path& filepath)
+{
+    const auto* entry{ find(filepath) };
+    if(entry == nullptr)
+        return std::unexpected(ResourceError::fileNotFound(filepath));
+
+    if(entry->type != assetPack::EntryType::Texture)
+        return std::unexpected(ResourceError::invalidFormat(filepath, "Packed entry isn't a texture"));
+
+    // NOTE: Borrow the mapped pixels, the mapping outlives the upload
+    PixelBuffer pixels{ m_file.data() + entry->dataOffset, storedSize(*entry), nullptr };
+
+    TextureRawData textureData{ .width = entry->width,
+                                .height = entry->height,
+                                .channels = entry->channels,
+                                .pixels = std::move(pixels),
+                                .compression = compressionOf(*entry),
+                                .mipLevels = storedLevels(*entry) };
+
+    return ResourceData{ std::move(textureData) };
+}
+
+std::expected<std::span<const std::byte>, ResourceError> AssetPackLoader::loadData(
+    const std::filesystem::path& filepath
+) const
+{
+    const auto* entry{ find(filepath) };
+    if(entry == nullptr)
+        return std::unexpected(ResourceError::fileNotFound(filepath));
+
+    return m_file.bytes().subspan(entry->dataOffset, entry->dataSize);
+}
+
+/// \brief Read the index of the mapped pack and check that every entry lies within the pack.
+std::expected<void, ResourceError> AssetPackLoader::readIndex(const std::filesystem::path& filepath)
+{
+    const std::uint64_t packSize{ m_file.size() };
+    const auto invalid{ [&filepath](std::string message) {
+        return std::unexpected(ResourceError::invalidFormat(filepath, std::move(message)));
+    } };
+
+    assetPack::Header header;
+    if(packSize < sizeof(header))
+        return invalid("File is too small to be an asset pack");
+
+    std::memcpy(&header, m_file.data(), sizeof(header));
+    if(header.magic != assetPack::MAGIC)
+        return invalid("File isn't an asset pack");
+    if(header.version != assetPack::VERSION)
+        return invalid(fmt::format("Unsupported asset pack version {}", header.version));
+
+    const auto indexSize{ static_cast<std::uint64_t>(header.entryCount) * sizeof(assetPack::Entry) };
+    if(!fits(header.entriesOffset, indexSize, packSize) || !fits(header.namesOffset, header.namesSize, packSize))
+        return invalid("Index lies outside of the asset pack");
+
+    // NOTE: Copy the small index out of the mapping, so it is properly aligned and never faults in again
+    m_entries.resize(header.entryCount);
+    std::memcpy(m_entries.data(), m_file.data() + header.entriesOffset, indexSize);
+    m_names = { reinterpret_cast<const char*>(m_file.data() + header.namesOffset), header.namesSize };
+
+    for(std::size_t i{ 0 }; i < m_entries.size(); ++i)
+    {
+        const auto& entry{ m_entries[i] };
+        if(!fits(entry.nameOffset, entry.nameSize, header.namesSize)
+           || !fits(entry.dataOffset, entry.dataSize, packSize))
+            return invalid(fmt::format("Entry {} lies outside of the asset pack", i));
+
+        if(entry.type == assetPack::EntryType::Texture && entry.compression >= TEXTURE_COMPRESSION_COUNT)
+            return invalid(fmt::format("Texture '{}' has an unknown compression", nameOf(entry)));
+
+        if(entry.type == assetPack::EntryType::Texture
+           && (entry.width <= 0 || entry.height <= 0 || entry.channels <= 0 || storedSize(entry) > entry.dataSize))
+            return invalid(fmt::format("Texture '{}' doesn't match its dimensions", nameOf(entry)));
+
+        if(i > 0 && nameOf(m_entries[i - 1]) >= nameOf(entry))
+            return invalid("Entries aren't sorted by their name");
+    }
+
+    return {};
+}
+
+std::string_view AssetPackLoader::nameOf(const assetPack::Entry& entry) const
+{
+    return m_names.substr(entry.nameOffset, entry.nameSize);
+}
+
+/// \brief Turn a requested path into the name of its entry, the path relative to the root of the pack.
+std::string AssetPackLoader::entryName(const std::filesystem::path& filepath) const
+{
+    const auto normal{ filepath.lexically_normal() };
+    const auto relative{ normal.lexically_relative(m_root) };
+    if(relative.empty() || *relative.begin() == "..")
+        return normal.generic_string();
+
+    return relative.generic_string();
+}
+
+const assetPack::Entry* AssetPackLoader::find(const std::filesystem::path& filepath) const
+{
+    const auto name{ entryName(filepath) };
+    const auto it{ std::ranges::lower_bound(m_entries, std::string_view{ name }, {}, [this](const auto& entry) {
+        return nameOf(entry);
+    }) };
+
+    if(it == m_entries.end() || nameOf(*it) != name)
+        return nullptr;
+
+    return &*it;
+}
+
+std::expected<std::string, ResourceError> AssetPackLoader::loadText(const std::filesystem::path& filepath) const
+{
+    const auto data{ loadData(filepath) };
+    if(!data)
+        return std::unexpected(data.error());
+
+    return std::string{ reinterpret_cast<const char*>(data->data()), data->size() };
+}
+
+} // namespace sfa
@@ -0,0 +1,80 @@
+#ifndef SFA_SRC_ENGINE_CORE_RESOURCE_MANAGEMENT_ASSET_PACK_LOADER_HPP
+#define SFA_SRC_ENGINE_CORE_RESOURCE_MANAGEMENT_ASSET_PACK_LOADER_HPP
+
+#include "core/resourceManagement/AssetPackFormat.hpp"
+#include "core/resourceManagement/IResourceLoader.hpp"
+#include "core/resourceManagement/IntermediateResourceData.hpp"
+#include "core/resourceManagement/MappedFile.hpp"
+#include "core/resourceManagement/ResourceError.hpp"
+
+#include <cstddef>
+#include <expected>
+#include <filesystem>
+#include <memory>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace sfa
+{
+
+/// \brief Load resources from a memory mapped asset pack baked by the asset packer, see \ref assetPack.
+///
+/// The pack is opened and its index validated once, afterwards every load is a binary search over the index. Textures
+/// are handed out as \ref PixelBuffer borrowing the mapped pixels, nothing is decoded or copied, baked mip levels are
+/// handed out along with them. Requested paths are looked up relative to the directory the pack was baked from, so the
+/// paths of the files on the disk keep working.
+///
+/// \note The loader has to outlive every texture it handed out, which holds as long as it is owned by the
+/// \ref ResourceContext the textures are uploaded by.
+///
+/// \author Felix Hommel
+/// \date 3/20/2026
+class AssetPackLoader : public IResourceLoader
+{
+public:
+    /// \brief Map and validate the pack at \p filepath.
+    ///
+    /// \param filepath path to the pack
+    /// \param root (optional) directory the pack was baked from, requested paths are looked up relative to it
+    ///
+    /// \returns the loader, or a \ref ResourceError if the pack can't be mapped or is malformed
+    static std::expected<std::unique_ptr<AssetPackLoader>, ResourceError> open(
+        const std::filesystem::path& filepath, std::filesystem::path root = SFA_ROOT "resources"
+    );
+
+    LoadResult loadShader(
+        const std::filesystem::path& vert,
+        const std::filesystem::path& frag,
+        const std::filesystem::path& geom = std::filesystem::path("")
+    ) override;
+    LoadResult loadTexture(const std::filesystem::path& filepath) override;
+
+    /// \brief Return the content of a packed file, e.g. a JSON config, without copying it.
+    ///
+    /// \returns the bytes within the mapped pack, valid as long as the loader lives
+    [[nodiscard]] std::expected<std::span<const std::byte>, ResourceError> loadData(
+        const std::filesystem::path& filepath
+    ) const;
+
+    [[nodiscard]] std::size_t size() const noexcept { return m_entries.size(); }
+
+private:
+    MappedFile m_file;
+    std::filesystem::path m_root;
+    std::vector<assetPack::Entry> m_entries;
+    std::string_view m_names;
+
+    AssetPackLoader(MappedFile file, std::filesystem::path root);
+
+    [[nodiscard]] std::expected<void, ResourceError> readIndex(const std::filesystem::path& filepath);
+    [[nodiscard]] std::string_view nameOf(const assetPack::Entry& entry) const;
+    [[nodiscard]] std::string entryName(const std::filesystem::path& filepath) const;
+    [[nodiscard]] const assetPack::Entry* find(const std::filesystem::path& filepath) const;
+    [[nodiscard]] std::expected<std::string, ResourceError> loadText(const std::filesystem::path& filepath) const;
+};
+
+} // namespace sfa
+
+#endif // !SFA_SRC_ENGINE_CORE_RESOURCE_MANAGEMENT_ASSET_PACK_LOADER_HPP
@@ -0,0 +1,158 @@
+#include "AssetPackWriter.hpp"
+
+#include "core/Mipmaps.hpp"
+#include "core/TextureCompression.hpp"
+#include "core/resourceManagement/AssetPackFormat.hpp"
+#include "core/resourceManagement/IntermediateResourceData.hpp"
+#include "core/resourceManagement/ResourceError.hpp"
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+#include <filesystem>
+#include <fstream>
+#include <span>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace sfa
+{
+
+namespace
+{
+
+template<typename T>
+void writeValue(std::ofstream& file, const T& value)
+{
+    file.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+/// \brief Pad the file with zeros until \p offset is a multiple of \p alignment.
+void pad(std::ofstream& file, std::uint64_t& offset, std::size_t alignment)
+{
+    while(offset % alignment != 0)
+    {
+        file.put('\0');
+        ++offset;
+    }
+}
+
+} // namespace
+
+void AssetPackWriter::addTexture(std::string name, const TextureRawData& texture, bool mips)
+{
+    // NOTE: Compressed blocks can't be box filtered, only their full resolution level is stored
+    const auto compressed{ texture.compression != TextureCompression::None };
+    auto pixels{ texture.pixels.bytes() };
+    if(compressed)
+        pixels = pixels.first(compressedSize(texture.compression, texture.width, texture.height));
+
+    PendingEntry pending{ .name = std::move(name),
+                          .entry = { .type = assetPack::EntryType::Texture,
+                                     .width = texture.width,
+                                     .height = texture.height,
+                                     .channels = texture.channels,
+                                     .mipLevels = 1,
+                                     .compression = static_cast<std::uint32_t>(texture.compression) },
+                          .data = std::vector<std::byte>(pixels.begin(), pixels.end()) };
+
+    if(mips && !compressed)
+    {
+        const auto levels{ mipLevelCount(texture.width, texture.height) };
+        pending.data.resize(mipChainSize(texture.width, texture.height, texture.channels, levels));
+        boxFilterMips(pending.data, texture.width, texture.height, texture.channels, levels);
+        pending.entry.mipLevels = static_cast<std::uint32_t>(levels);
+    }
+
+    m_entries.push_back(std::move(pending));
+}
+
+void AssetPackWriter::addData(std::string name, std::span<const std::byte> data)
+{
+    m_entries.push_back(
+        { .name = std::move(name),
+          .entry = { .type = assetPack::EntryType::Data },
+          .data = std::vector<std::byte>(data.begin(), data.end()) }
+    );
+}
+
+std::expected<void, ResourceError> AssetPackWriter::write(const std::filesystem::path& filepath) const
+{
+    std::vector<const PendingEntry*> sorted;
+    sorted.reserve(m_entries.size());
+    for(const auto& entry : m_entries)
+        sorted.push_back(&entry);
+
+    std::ranges::sort(sorted, {}, &PendingEntry::name);
+
+    const auto duplicate{ std::ranges::adjacent_find(sorted, {}, &PendingEntry::name) };
+    if(duplicate != sorted.end())
+    {
+        return std::unexpected(
+            ResourceError::invalidFormat(filepath, fmt::format("Duplicate entry '{}'", (*duplicate)->name))
+        );
+    }
+
+    std::ofstream file(filepath, std::ios::binary | std::ios::trunc);
+    if(!file)
+    {
+        return std::unexpected(
+            ResourceError{ .type = ResourceError::Type::Unknown,
+                           .message = "Failed to open the pack for writing",
+                           .filepath = filepath }
+        );
+    }
+
+    assetPack::Header header{ .entryCount = static_cast<std::uint32_t>(sorted.size()) };
+    writeValue(file, header);
+
+    std::vector<assetPack::Entry> entries;
+    entries.reserve(sorted.size());
+    std::string names;
+
+    std::uint64_t offset{ sizeof(assetPack::Header) };
+    for(const auto* pending : sorted)
+    {
+        pad(file, offset, assetPack::DATA_ALIGNMENT);
+
+        auto& entry{ entries.emplace_back(pending->entry) };
+        entry.dataOffset = offset;
+        entry.dataSize = pending->data.size();
+        entry.nameOffset = static_cast<std::uint32_t>(names.size());
+        entry.nameSize = static_cast<std::uint32_t>(pending->name.size());
+        names += pending->name;
+
+        file.write(
+            reinterpret_cast<const char*>(pending->data.data()), static_cast<std::streamsize>(pending->data.size())
+        );
+        offset += pending->data.size();
+    }
+
+    pad(file, offset, alignof(assetPack::Entry));
+    header.entriesOffset = offset;
+    for(const auto& entry : entries)
+        writeValue(file, entry);
+
+    header.namesOffset = offset + entries.size() * sizeof(assetPack::Entry);
+    header.namesSize = static_cast<std::uint32_t>(names.size());
+    file.write(names.data(), static_cast<std::streamsize>(names.size()));
+
+    file.seekp(0);
+    writeValue(file, header);
+
+    if(!file)
+    {
+        return std::unexpected(
+            ResourceError{
+                .type = ResourceError::Type::Unknown, .message = "Failed to write the pack", .filepath = filepath }
+        );
+    }
+
+    return {};
+}
+
+} // namespace sfa
@@ -0,0 +1,60 @@
+#ifndef SFA_SRC_ENGINE_CORE_RESOURCE_MANAGEMENT_ASSET_PACK_WRITER_HPP
+#define SFA_SRC_ENGINE_CORE_RESOURCE_MANAGEMENT_ASSET_PACK_WRITER_HPP
+
+#include "core/resourceManagement/AssetPackFormat.hpp"
+#include "core/resourceManagement/IntermediateResourceData.hpp"
+#include "core/resourceManagement/ResourceError.hpp"
+
+#include <cstddef>
+#include <expected>
+#include <filesystem>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace sfa
+{
+
+/// \brief Bakes decoded textures and raw files into a single asset pack, see \ref assetPack.
+///
+/// Used offline by the asset packer tool, the game reads the pack through \ref AssetPackLoader.
+///
+/// \author Felix Hommel
+/// \date 3/20/2026
+class AssetPackWriter
+{
+public:
+    /// \brief Add a decoded texture.
+    ///
+    /// \param name name the texture is looked up with
+    /// \param texture decoded pixels or compressed blocks of the texture
+    /// \param mips (optional) also store the smaller mip levels, each a box filtered half of the previous one, ignored
+    /// for compressed textures
+    void addTexture(std::string name, const TextureRawData& texture, bool mips = false);
+    /// \brief Add a file as is.
+    ///
+    /// \param name name the data is looked up with
+    /// \param data content of the file
+    void addData(std::string name, std::span<const std::byte> data);
+
+    /// \brief Write every added entry to \p filepath, replacing the file if it exists.
+    ///
+    /// \returns a \ref ResourceError if two entries share a name or the file can't be written
+    [[nodiscard]] std::expected<void, ResourceError> write(const std::filesystem::path& filepath) const;
+
+    [[nodiscard]] std::size_t size() const noexcept { return m_entries.size(); }
+
+private:
+    struct PendingEntry
+    {
+        std::string name;
+        assetPack::Entry entry;
+        std::vector<std::byte> data;
+    };
+
+    std::vector<PendingEntry> m_entries;
+};
+
+} // namespace sfa
+
+#endif // !SFA_SRC_ENGINE_CORE_RESOURCE_MANAGEMENT_ASSET_PACK_WRITER_HPP
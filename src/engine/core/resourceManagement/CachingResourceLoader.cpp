@@ -0,0 +1,46 @@
+#include "CachingResourceLoader.hpp"
+
+#include "core/resourceManagement/DecodedTextureCache.hpp"
+#include "core/resourceManagement/IntermediateResourceData.hpp"
+
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <utility>
+#include <variant>
+
+namespace sfa
+{
+
+CachingResourceLoader::CachingResourceLoader(
+    std::unique_ptr<IResourceLoader> loader, std::filesystem::path cacheDirectory, std::uintmax_t maxCacheSize
+)
+    : m_loader(std::move(loader)), m_cache(std::move(cacheDirectory), maxCacheSize)
+{
+}
+
+LoadResult CachingResourceLoader::loadShader(
+    const std::filesystem::path& vert, const std::filesystem::path& frag, const std::filesystem::path& geom
+)
+{
+    return m_loader->loadShader(vert, frag, geom);
+}
+
+LoadResult CachingResourceLoader::loadTexture(const std::filesystem::path& filepath)
+{
+    // NOTE: The key is taken before decoding, so a file changing in between is never stored under its new content
+    const auto key{ DecodedTextureCache::keyOf(filepath) };
+    if(!key)
+        return m_loader->loadTexture(filepath);
+
+    if(auto cached{ m_cache.load(*key) })
+        return ResourceData{ std::move(*cached) };
+
+    auto result{ m_loader->loadTexture(filepath) };
+    if(result && std::holds_alternative<TextureRawData>(*result))
+        m_cache.store(*key, std::get<TextureRawData>(*result));
+
+    return result;
+}
+
+} // namespace sfa
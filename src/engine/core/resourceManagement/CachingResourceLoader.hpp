@@ -0,0 +1,53 @@
+#ifndef SFA_SRC_ENGINE_CORE_RESOURCE_MANAGEMENT_CACHING_RESOURCE_LOADER_HPP
+#define SFA_SRC_ENGINE_CORE_RESOURCE_MANAGEMENT_CACHING_RESOURCE_LOADER_HPP
+
+#include "core/resourceManagement/DecodedTextureCache.hpp"
+#include "core/resourceManagement/IResourceLoader.hpp"
+#include "core/resourceManagement/IntermediateResourceData.hpp"
+
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+
+namespace sfa
+{
+
+/// \brief Resource loader that keeps the textures decoded by another loader in a \ref DecodedTextureCache.
+///
+/// Textures that have been decoded in an earlier run are read from the cache instead of being decoded again, every
+/// other texture is decoded by the wrapped loader and stored afterwards. Shaders are always loaded by the wrapped
+/// loader.
+///
+/// \author Felix Hommel
+/// \date 3/21/2026
+class CachingResourceLoader : public IResourceLoader
+{
+public:
+    /// \brief Wrap \p loader with a cache in \p cacheDirectory.
+    ///
+    /// \param loader loader that decodes the textures missing from the cache
+    /// \param cacheDirectory directory the decoded textures are stored in
+    /// \param maxCacheSize (optional) amount of bytes the cache may use on the disk
+    CachingResourceLoader(
+        std::unique_ptr<IResourceLoader> loader,
+        std::filesystem::path cacheDirectory,
+        std::uintmax_t maxCacheSize = DecodedTextureCache::DEFAULT_MAX_SIZE
+    );
+
+    LoadResult loadShader(
+        const std::filesystem::path& vert,
+        const std::filesystem::path& frag,
+        const std::filesystem::path& geom = std::filesystem::path("")
+    ) override;
+    LoadResult loadTexture(const std::filesystem::path& filepath) override;
+
+    [[nodiscard]] const DecodedTextureCache& cache() const noexcept { return m_cache; }
+
+private:
+    std::unique_ptr<IResourceLoader> m_loader;
+    DecodedTextureCache m_cache;
+};
+
+} // namespace sfa
+
+#endif // !SFA_SRC_ENGINE_CORE_RESOURCE_MANAGEMENT_CACHING_RESOURCE_LOADER_HPP
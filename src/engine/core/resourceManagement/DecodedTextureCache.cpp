@@ -0,0 +1,281 @@
+#include "DecodedTextureCache.hpp"
+
+#include "core/PixelBuffer.hpp"
+#include "core/TextureCompression.hpp"
+#include "core/resourceManagement/IntermediateResourceData.hpp"
+#include "core/resourceManagement/MappedFile.hpp"
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+namespace sfa
+{
+
+namespace
+{
+
+constexpr std::array<char, 4> MAGIC{ 'S', 'F', 'A', 'T' };
+constexpr std::uint32_t VERSION{ 1 };
+constexpr std::string_view ENTRY_EXTENSION{ ".sfatex" };
+constexpr std::string_view TEMPORARY_EXTENSION{ ".tmp" };
+
+constexpr std::uint64_t FNV_OFFSET_BASIS{ 0xcbf29ce484222325ull };
+constexpr std::uint64_t FNV_PRIME{ 0x100000001b3ull };
+
+/// \brief Header in front of the source path and the pixels of every entry.
+///
+/// The key of the source file is stored in full, so a collision of the hashed file names is detected on lookup.
+struct EntryHeader
+{
+    std::array<char, 4> magic{ MAGIC };
+    std::uint32_t version{ VERSION };
+    std::uint64_t sourceSize{ 0 };
+    std::int64_t sourceModified{ 0 };
+    std::uint64_t contentHash{ 0 };
+    std::int32_t width{ 0 };
+    std::int32_t height{ 0 };
+    std::int32_t channels{ 0 };
+    std::uint32_t pathSize{ 0 };
+};
+
+static_assert(sizeof(EntryHeader) == 48);
+
+std::uint64_t hashBytes(std::span<const std::byte> bytes, std::uint64_t hash = FNV_OFFSET_BASIS)
+{
+    for(const auto byte : bytes)
+    {
+        hash ^= static_cast<std::uint64_t>(byte);
+        hash *= FNV_PRIME;
+    }
+
+    return hash;
+}
+
+template<typename T>
+std::uint64_t hashValue(const T& value, std::uint64_t hash)
+{
+    return hashBytes(std::as_bytes(std::span{ &value, 1 }), hash);
+}
+
+std::size_t textureSize(const EntryHeader& header)
+{
+    return static_cast<std::size_t>(header.width) * static_cast<std::size_t>(header.height)
+         * static_cast<std::size_t>(header.channels);
+}
+
+bool matches(const EntryHeader& header, const DecodedTextureCache::Key& key)
+{
+    return header.magic == MAGIC && header.version == VERSION && header.sourceSize == key.size
+        && header.sourceModified == key.modified && header.contentHash == key.contentHash
+        && header.pathSize == key.path.size() && header.width > 0 && header.height > 0 && header.channels > 0;
+}
+
+} // namespace
+
+DecodedTextureCache::DecodedTextureCache(std::filesystem::path directory, std::uintmax_t maxSize)
+    : m_directory(std::move(directory)), m_maxSize(maxSize)
+{
+    std::error_code error;
+    std::filesystem::create_directories(m_directory, error);
+
+    std::uintmax_t size{ 0 };
+    for(const auto& entry : std::filesystem::directory_iterator{ m_directory, error })
+    {
+        // NOTE: Leftovers of a store that was interrupted, e.g. by a crash
+        if(entry.path().extension() == TEMPORARY_EXTENSION)
+            std::filesystem::remove(entry.path(), error);
+        else if(const auto entrySize{ entry.file_size(error) }; !error && entry.path().extension() == ENTRY_EXTENSION)
+            size += entrySize;
+    }
+
+    m_size = size;
+    if(m_size > m_maxSize)
+        evict();
+}
+
+std::optional<DecodedTextureCache::Key> DecodedTextureCache::keyOf(const std::filesystem::path& filepath)
+{
+    std::error_code error;
+    auto path{ std::filesystem::weakly_canonical(filepath, error) };
+    if(error)
+        return std::nullopt;
+
+    const auto modified{ std::filesystem::last_write_time(path, error) };
+    if(error)
+        return std::nullopt;
+
+    const auto file{ MappedFile::open(path) };
+    if(!file)
+        return std::nullopt;
+
+    return Key{ .path = path.generic_string(),
+                .size = file->size(),
+                .modified = modified.time_since_epoch().count(),
+                .contentHash = hashBytes(file->bytes()) };
+}
+
+std::optional<TextureRawData> DecodedTextureCache::load(const Key& key)
+{
+    const auto path{ entryPath(key) };
+    const auto miss{ [this]() -> std::optional<TextureRawData> {
+        ++m_misses;
+        return std::nullopt;
+    } };
+
+    std::ifstream file{ path, std::ios::binary };
+    EntryHeader header;
+    if(!file.read(reinterpret_cast<char*>(&header), sizeof(header)) || !matches(header, key))
+        return miss();
+
+    std::string sourcePath(header.pathSize, '\0');
+    if(!file.read(sourcePath.data(), static_cast<std::streamsize>(sourcePath.size())) || sourcePath != key.path)
+        return miss();
+
+    auto pixels{ PixelBuffer::allocate(textureSize(header)) };
+    if(!file.read(reinterpret_cast<char*>(pixels.data()), static_cast<std::streamsize>(pixels.size())))
+        return miss();
+
+    // NOTE: The modification time of an entry is its last use, the least recently used entries are evicted first
+    std::error_code error;
+    std::filesystem::last_write_time(path, std::filesystem::file_time_type::clock::now(), error);
+
+    ++m_hits;
+
+    return TextureRawData{
+        .width = header.width, .height = header.height, .channels = header.channels, .pixels = std::move(pixels)
+    };
+}
+
+void DecodedTextureCache::store(const Key& key, const TextureRawData& texture)
+{
+    // NOTE: Compressed textures are read as they are, there is nothing to save by caching them. Entries only hold the
+    // full resolution level
+    if(texture.pixels.empty() || texture.compression != TextureCompression::None || texture.mipLevels != 1)
+        return;
+
+    const EntryHeader header{ .sourceSize = key.size,
+                              .sourceModified = key.modified,
+                              .contentHash = key.contentHash,
+                              .width = texture.width,
+                              .height = texture.height,
+                              .channels = texture.channels,
+                              .pathSize = static_cast<std::uint32_t>(key.path.size()) };
+
+    const auto path{ entryPath(key) };
+    auto temporary{ path };
+    temporary += fmt::format(".{}{}", m_nextTemporary++, TEMPORARY_EXTENSION);
+
+    std::error_code error;
+    {
+        // NOTE: Written to a temporary file first, so a concurrent lookup never sees a partially written entry
+        std::ofstream file{ temporary, std::ios::binary | std::ios::trunc };
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file.write(key.path.data(), static_cast<std::streamsize>(key.path.size()));
+        file.write(
+            reinterpret_cast<const char*>(texture.pixels.data()), static_cast<std::streamsize>(texture.pixels.size())
+        );
+
+        if(!file)
+        {
+            file.close();
+            std::filesystem::remove(temporary, error);
+            return;
+        }
+    }
+
+    const std::scoped_lock lock{ m_storeMutex };
+
+    const auto replacedSize{ std::filesystem::exists(path, error) ? std::filesystem::file_size(path, error) : 0 };
+    std::filesystem::rename(temporary, path, error);
+    if(error)
+    {
+        std::filesystem::remove(temporary, error);
+        return;
+    }
+
+    // NOTE: Stamped explicitly, the timestamps the file system sets may be too coarse to order entries stored in a row
+    std::filesystem::last_write_time(path, std::filesystem::file_time_type::clock::now(), error);
+
+    m_size += sizeof(header) + key.path.size() + texture.pixels.size();
+    m_size -= replacedSize;
+    ++m_stores;
+
+    if(m_size > m_maxSize)
+        evict();
+}
+
+DecodedTextureCache::Stats DecodedTextureCache::stats() const noexcept
+{
+    return { .hits = m_hits, .misses = m_misses, .stores = m_stores, .evictions = m_evictions, .size = m_size };
+}
+
+std::filesystem::path DecodedTextureCache::entryPath(const Key& key) const
+{
+    auto hash{ hashBytes(std::as_bytes(std::span{ key.path })) };
+    hash = hashValue(key.size, hash);
+    hash = hashValue(key.modified, hash);
+    hash = hashValue(key.contentHash, hash);
+
+    return m_directory / fmt::format("{:016x}{}", hash, ENTRY_EXTENSION);
+}
+
+/// \brief Remove the least recently used entries until the cache fits its size limit again.
+///
+/// Rescans the directory, so the tracked size can't drift from the entries that are actually on the disk.
+void DecodedTextureCache::evict()
+{
+    struct Candidate
+    {
+        std::filesystem::path path;
+        std::uintmax_t size;
+        std::filesystem::file_time_type lastUse;
+    };
+
+    std::error_code error;
+    std::vector<Candidate> candidates;
+    std::uintmax_t size{ 0 };
+    for(const auto& entry : std::filesystem::directory_iterator{ m_directory, error })
+    {
+        if(entry.path().extension() != ENTRY_EXTENSION)
+            continue;
+
+        const auto entrySize{ entry.file_size(error) };
+        const auto lastUse{ error ? std::filesystem::file_time_type{} : entry.last_write_time(error) };
+        if(error)
+            continue;
+
+        candidates.push_back({ .path = entry.path(), .size = entrySize, .lastUse = lastUse });
+        size += entrySize;
+    }
+
+    std::ranges::sort(candidates, {}, &Candidate::lastUse);
+    for(const auto& candidate : candidates)
+    {
+        if(size <= m_maxSize)
+            break;
+
+        if(std::filesystem::remove(candidate.path, error))
+        {
+            size -= candidate.size;
+            ++m_evictions;
+        }
+    }
+
+    m_size = size;
+}
+
+} // namespace sfa
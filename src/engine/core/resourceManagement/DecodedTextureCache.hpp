@@ -0,0 +1,101 @@
+#ifndef SFA_SRC_ENGINE_CORE_RESOURCE_MANAGEMENT_DECODED_TEXTURE_CACHE_HPP
+#define SFA_SRC_ENGINE_CORE_RESOURCE_MANAGEMENT_DECODED_TEXTURE_CACHE_HPP
+
+#include "core/resourceManagement/IntermediateResourceData.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <mutex>
+#include <optional>
+#include <string>
+
+namespace sfa
+{
+
+/// \brief Persistent on-disk cache of decoded textures.
+///
+/// Every entry is a single file in the cache directory holding the raw pixels of one texture. Entries are keyed by the
+/// path, size, modification time and a content hash of the source file, so editing a texture invalidates its entry even
+/// if the modification time is preserved. Once the cache grows beyond its size limit, the least recently used entries
+/// are evicted.
+///
+/// Looking up and storing entries is thread safe, so the cache can be used from the workers of a
+/// \ref ResourceContext.
+///
+/// \author Felix Hommel
+/// \date 3/21/2026
+class DecodedTextureCache
+{
+public:
+    /// \brief Amount of bytes the cache may use on the disk by default.
+    static constexpr std::uintmax_t DEFAULT_MAX_SIZE{ 512ull * 1024 * 1024 };
+
+    /// \brief Counters of the cache since it was created.
+    struct Stats
+    {
+        std::size_t hits{ 0 };      ///< lookups that were served from the disk
+        std::size_t misses{ 0 };    ///< lookups without a valid entry
+        std::size_t stores{ 0 };    ///< entries written to the disk
+        std::size_t evictions{ 0 }; ///< entries removed to stay below the size limit
+        std::uintmax_t size{ 0 };   ///< bytes the entries currently use on the disk
+    };
+
+    /// \brief Identifies the content of a source file.
+    struct Key
+    {
+        std::string path;               ///< canonical path of the file
+        std::uint64_t size{ 0 };        ///< size of the file in bytes
+        std::int64_t modified{ 0 };     ///< modification time of the file
+        std::uint64_t contentHash{ 0 }; ///< FNV-1a hash of the content of the file
+    };
+
+    /// \brief Open the cache in \p directory, creating the directory if it doesn't exist.
+    ///
+    /// \param directory directory the entries are stored in
+    /// \param maxSize (optional) amount of bytes the entries may use on the disk
+    explicit DecodedTextureCache(std::filesystem::path directory, std::uintmax_t maxSize = DEFAULT_MAX_SIZE);
+
+    /// \brief Compute the key of the current content of the file at \p filepath.
+    ///
+    /// Reads the whole file to hash it, which is still far cheaper than decoding it.
+    ///
+    /// \returns the key, or std::nullopt if the file can't be read
+    [[nodiscard]] static std::optional<Key> keyOf(const std::filesystem::path& filepath);
+
+    /// \brief Look up the decoded texture of the source file identified by \p key.
+    ///
+    /// \returns the cached texture, or std::nullopt if there is no valid entry for \p key
+    [[nodiscard]] std::optional<TextureRawData> load(const Key& key);
+
+    /// \brief Store the decoded \p texture of the source file identified by \p key.
+    ///
+    /// Evicts the least recently used entries if the cache grows beyond its size limit.
+    void store(const Key& key, const TextureRawData& texture);
+
+    [[nodiscard]] Stats stats() const noexcept;
+    [[nodiscard]] const std::filesystem::path& directory() const noexcept { return m_directory; }
+    [[nodiscard]] std::uintmax_t maxSize() const noexcept { return m_maxSize; }
+
+private:
+    std::filesystem::path m_directory;
+    std::uintmax_t m_maxSize;
+
+    /// \brief Serializes writing and evicting entries, lookups only read.
+    std::mutex m_storeMutex;
+    std::atomic<std::uint64_t> m_nextTemporary{ 0 };
+
+    std::atomic<std::size_t> m_hits{ 0 };
+    std::atomic<std::size_t> m_misses{ 0 };
+    std::atomic<std::size_t> m_stores{ 0 };
+    std::atomic<std::size_t> m_evictions{ 0 };
+    std::atomic<std::uintmax_t> m_size{ 0 };
+
+    [[nodiscard]] std::filesystem::path entryPath(const Key& key) const;
+    void evict();
+};
+
+} // namespace sfa
+
+#endif // !SFA_SRC_ENGINE_CORE_RESOURCE_MANAGEMENT_DECODED_TEXTURE_CACHE_HPP
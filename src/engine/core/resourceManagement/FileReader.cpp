@@ -0,0 +1,163 @@
+#include "FileReader.hpp"
+
+#include "core/PixelBuffer.hpp"
+#include "core/resourceManagement/ResourceError.hpp"
+
+#if defined(_WIN32)
+#    define WIN32_LEAN_AND_MEAN
+#    define NOMINMAX
+#    include <windows.h>
+#else
+#    include <cerrno>
+#    include <fcntl.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <cstddef>
+#include <expected>
+#include <filesystem>
+#include <limits>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace sfa
+{
+
+#if defined(_WIN32)
+
+namespace
+{
+
+std::expected<PixelBuffer, ResourceError> readWholeFile(const std::filesystem::path& filepath)
+{
+    HANDLE file{ CreateFileW(
+        filepath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr
+    ) };
+    if(file == INVALID_HANDLE_VALUE)
+        return std::unexpected(ResourceError::fileNotFound(filepath));
+
+    LARGE_INTEGER size{};
+    if(GetFileSizeEx(file, &size) == 0 || size.QuadPart <= 0)
+    {
+        CloseHandle(file);
+        return std::unexpected(ResourceError::invalidFormat(filepath, "File is empty or its size is unknown"));
+    }
+
+    auto bytes{ PixelBuffer::allocate(static_cast<std::size_t>(size.QuadPart)) };
+    std::size_t offset{ 0 };
+    while(offset < bytes.size())
+    {
+        const auto chunk{ static_cast<DWORD>(
+            std::min<std::size_t>(bytes.size() - offset, std::numeric_limits<DWORD>::max())
+        ) };
+        DWORD read{ 0 };
+        if(ReadFile(file, bytes.data() + offset, chunk, &read, nullptr) == 0 || read == 0)
+        {
+            CloseHandle(file);
+            return std::unexpected(ResourceError::invalidFormat(filepath, "Failed to read the file"));
+        }
+
+        offset += read;
+    }
+
+    CloseHandle(file);
+
+    return bytes;
+}
+
+} // namespace
+
+std::vector<std::expected<PixelBuffer, ResourceError>> readFileBatch(std::span<const std::filesystem::path> filepaths)
+{
+    std::vector<std::expected<PixelBuffer, ResourceError>> files;
+    files.reserve(filepaths.size());
+    for(const auto& filepath : filepaths)
+        files.push_back(readWholeFile(filepath));
+
+    return files;
+}
+
+#else
+
+namespace
+{
+
+/// \brief A file of the batch that was opened, but not read yet.
+struct OpenFile
+{
+    int fd{ -1 };
+    std::size_t size{ 0 };
+};
+
+std::expected<OpenFile, ResourceError> openFile(const std::filesystem::path& filepath)
+{
+    const int fd{ ::open(filepath.c_str(), O_RDONLY | O_CLOEXEC) };
+    if(fd < 0)
+        return std::unexpected(ResourceError::fileNotFound(filepath));
+
+    struct stat info{};
+    if(::fstat(fd, &info) != 0 || !S_ISREG(info.st_mode) || info.st_size <= 0)
+    {
+        ::close(fd);
+        return std::unexpected(ResourceError::invalidFormat(filepath, "File is empty or not a regular file"));
+    }
+
+    const auto size{ static_cast<std::size_t>(info.st_size) };
+#    if defined(POSIX_FADV_WILLNEED)
+    // NOTE: Let the kernel start reading every file of the batch while the earlier ones are copied out
+    ::posix_fadvise(fd, 0, static_cast<off_t>(size), POSIX_FADV_WILLNEED);
+#    endif
+
+    return OpenFile{ .fd = fd, .size = size };
+}
+
+std::expected<PixelBuffer, ResourceError> readOpenFile(const OpenFile& file, const std::filesystem::path& filepath)
+{
+    auto bytes{ PixelBuffer::allocate(file.size) };
+    std::size_t offset{ 0 };
+    while(offset < file.size)
+    {
+        const auto read{ ::pread(file.fd, bytes.data() + offset, file.size - offset, static_cast<off_t>(offset)) };
+        if(read < 0 && errno == EINTR)
+            continue;
+        if(read <= 0)
+            return std::unexpected(ResourceError::invalidFormat(filepath, "Failed to read the file"));
+
+        offset += static_cast<std::size_t>(read);
+    }
+
+    return bytes;
+}
+
+} // namespace
+
+std::vector<std::expected<PixelBuffer, ResourceError>> readFileBatch(std::span<const std::filesystem::path> filepaths)
+{
+    std::vector<std::expected<OpenFile, ResourceError>> opened;
+    opened.reserve(filepaths.size());
+    for(const auto& filepath : filepaths)
+        opened.push_back(openFile(filepath));
+
+    std::vector<std::expected<PixelBuffer, ResourceError>> files;
+    files.reserve(filepaths.size());
+    for(std::size_t i{ 0 }; i < filepaths.size(); ++i)
+    {
+        if(!opened[i])
+        {
+            files.emplace_back(std::unexpected(std::move(opened[i].error())));
+            continue;
+        }
+
+        files.push_back(readOpenFile(*opened[i], filepaths[i]));
+        ::close(opened[i]->fd);
+    }
+
+    return files;
+}
+
+#endif
+
+} // namespace sfa
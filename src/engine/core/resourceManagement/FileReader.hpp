@@ -0,0 +1,31 @@
+#ifndef SFA_SRC_ENGINE_CORE_RESOURCE_MANAGEMENT_FILE_READER_HPP
+#define SFA_SRC_ENGINE_CORE_RESOURCE_MANAGEMENT_FILE_READER_HPP
+
+#include "core/PixelBuffer.hpp"
+#include "core/resourceManagement/ResourceError.hpp"
+
+#include <expected>
+#include <filesystem>
+#include <span>
+#include <vector>
+
+namespace sfa
+{
+
+/// \brief Read whole files into memory, a batch at a time.
+///
+/// On POSIX every file of the batch is opened and announced to the kernel with posix_fadvise first, so the files are
+/// read ahead concurrently while the earlier ones are copied out with pread. Windows reads the files one after the
+/// other with ReadFile.
+///
+/// \param filepaths files that are read
+///
+/// \returns the content of every file, or a \ref ResourceError if it doesn't exist, is empty or can't be read, in the
+/// order of \p filepaths
+[[nodiscard]] std::vector<std::expected<PixelBuffer, ResourceError>> readFileBatch(
+    std::span<const std::filesystem::path> filepaths
+);
+
+} // namespace sfa
+
+#endif // !SFA_SRC_ENGINE_CORE_RESOURCE_MANAGEMENT_FILE_READER_HPP
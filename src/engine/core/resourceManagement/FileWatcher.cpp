@@ -0,0 +1,162 @@
+#include "FileWatcher.hpp"
+
+#if defined(__linux__)
+#    include <cerrno>
+#    include <sys/inotify.h>
+#    include <unistd.h>
+#endif
+
+#include <spdlog/spdlog.h>
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstring>
+#include <filesystem>
+#include <system_error>
+#include <vector>
+
+namespace sfa
+{
+
+FileWatcher::FileWatcher(std::chrono::milliseconds debounce) : m_debounce(debounce)
+{
+#if defined(__linux__)
+    m_fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if(m_fd < 0)
+        spdlog::warn("Failed to initialize inotify, comparing write times instead: {}", std::strerror(errno));
+#endif
+}
+
+FileWatcher::~FileWatcher()
+{
+#if defined(__linux__)
+    if(m_fd >= 0)
+        ::close(m_fd);
+#endif
+}
+
+void FileWatcher::watch(const std::filesystem::path& filepath)
+{
+    const auto path{ normalize(filepath) };
+    if(m_files.contains(path))
+        return;
+
+    m_files.emplace(path, writeTime(path));
+
+#if defined(__linux__)
+    if(m_fd < 0)
+        return;
+
+    // NOTE: Watching a directory twice returns the same descriptor, so every directory is only stored once
+    const auto directory{ path.parent_path() };
+    const int wd{ inotify_add_watch(m_fd, directory.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO) };
+    if(wd < 0)
+    {
+        spdlog::warn("Failed to watch directory '{}': {}", directory.string(), std::strerror(errno));
+        return;
+    }
+
+    m_directories.emplace(wd, directory);
+#endif
+}
+
+std::vector<FileWatcher::Change> FileWatcher::poll()
+{
+    const auto now{ std::chrono::steady_clock::now() };
+    if(notified())
+        readEvents(now);
+    else if(now - m_lastScan >= m_debounce)
+        scanWriteTimes(now);
+
+    std::vector<Change> changes;
+    for(auto it{ m_pending.begin() }; it != m_pending.end();)
+    {
+        if(now - it->second.last < m_debounce)
+        {
+            ++it;
+            continue;
+        }
+
+        changes.push_back(Change{ .filepath = it->first, .changedAt = it->second.first });
+        it = m_pending.erase(it);
+    }
+
+    return changes;
+}
+
+/// \brief Drain the inotify events that arrived since the last call, without blocking.
+void FileWatcher::readEvents([[maybe_unused]] std::chrono::steady_clock::time_point now)
+{
+#if defined(__linux__)
+    constexpr std::size_t BUFFER_SIZE{ 4096 };
+    alignas(inotify_event) std::array<char, BUFFER_SIZE> buffer{};
+
+    for(;;)
+    {
+        const auto length{ ::read(m_fd, buffer.data(), buffer.size()) };
+        if(length < 0 && errno == EINTR)
+            continue;
+        if(length <= 0)
+            return;
+
+        for(std::size_t offset{ 0 }; offset < static_cast<std::size_t>(length);)
+        {
+            inotify_event event{};
+            std::memcpy(&event, buffer.data() + offset, sizeof(inotify_event));
+
+            const auto directory{ m_directories.find(event.wd) };
+            if(event.len > 0 && directory != m_directories.end())
+                markChanged(directory->second / (buffer.data() + offset + sizeof(inotify_event)), now);
+
+            offset += sizeof(inotify_event) + event.len;
+        }
+    }
+#endif
+}
+
+/// \brief Compare the write times of every watched file with the ones of the last scan.
+void FileWatcher::scanWriteTimes(std::chrono::steady_clock::time_point now)
+{
+    m_lastScan = now;
+
+    for(auto& [filepath, lastWrite] : m_files)
+    {
+        const auto write{ writeTime(filepath) };
+        if(write == lastWrite)
+            continue;
+
+        lastWrite = write;
+        markChanged(filepath, now);
+    }
+}
+
+/// \brief Remember that \p filepath changed at \p now, if it is watched at all.
+void FileWatcher::markChanged(const std::filesystem::path& filepath, std::chrono::steady_clock::time_point now)
+{
+    if(!m_files.contains(filepath))
+        return;
+
+    const auto [it, inserted]{ m_pending.try_emplace(filepath, PendingChange{ .first = now, .last = now }) };
+    if(!inserted)
+        it->second.last = now;
+}
+
+std::filesystem::path FileWatcher::normalize(const std::filesystem::path& filepath)
+{
+    std::error_code error;
+    auto path{ std::filesystem::absolute(filepath, error) };
+
+    return error ? filepath.lexically_normal() : path.lexically_normal();
+}
+
+/// \returns the last write time of \p filepath, or the minimum if it doesn't exist
+std::filesystem::file_time_type FileWatcher::writeTime(const std::filesystem::path& filepath)
+{
+    std::error_code error;
+    const auto time{ std::filesystem::last_write_time(filepath, error) };
+
+    return error ? std::filesystem::file_time_type::min() : time;
+}
+
+} // namespace sfa
@@ -0,0 +1,94 @@
+#ifndef SFA_SRC_ENGINE_CORE_RESOURCE_MANAGEMENT_FILE_WATCHER_HPP
+#define SFA_SRC_ENGINE_CORE_RESOURCE_MANAGEMENT_FILE_WATCHER_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <filesystem>
+#include <map>
+#include <unordered_map>
+#include <vector>
+
+namespace sfa
+{
+
+/// \brief Reports files that changed on disk, used to hot reload resources.
+///
+/// Linux is notified of changes through inotify, which watches the directories of the files, so files replaced by a
+/// rename (like most editors save them) are noticed too. Other platforms compare the last write times of the files on
+/// every \ref FileWatcher::poll. A file is only reported once it stopped changing for the debounce interval, so a burst
+/// of writes results in a single change.
+///
+/// \author Felix Hommel
+/// \date 3/25/2026
+class FileWatcher
+{
+public:
+    static constexpr std::chrono::milliseconds DEFAULT_DEBOUNCE{ 100 };
+
+    /// \brief A file that changed.
+    ///
+    /// \author Felix Hommel
+    /// \date 3/25/2026
+    struct Change
+    {
+        std::filesystem::path filepath;
+        /// \brief When the first change of the burst was noticed.
+        std::chrono::steady_clock::time_point changedAt;
+    };
+
+    /// \brief Create a new \ref FileWatcher that doesn't watch any file yet.
+    ///
+    /// \param debounce (optional) how long a file has to stay unchanged before it is reported
+    explicit FileWatcher(std::chrono::milliseconds debounce = DEFAULT_DEBOUNCE);
+    ~FileWatcher();
+
+    FileWatcher(const FileWatcher&) = delete;
+    FileWatcher& operator=(const FileWatcher&) = delete;
+    FileWatcher(FileWatcher&&) noexcept = delete;
+    FileWatcher& operator=(FileWatcher&&) noexcept = delete;
+
+    /// \brief Start watching \p filepath, watching a file twice has no effect.
+    ///
+    /// The file doesn't have to exist yet, but its directory does on Linux.
+    void watch(const std::filesystem::path& filepath);
+
+    /// \brief Return the watched files that changed and stayed unchanged for the debounce interval since.
+    ///
+    /// Doesn't block, meant to be called once per frame.
+    [[nodiscard]] std::vector<Change> poll();
+
+    /// \brief Turn \p filepath into the form the paths of \ref FileWatcher::Change have.
+    [[nodiscard]] static std::filesystem::path normalize(const std::filesystem::path& filepath);
+
+    [[nodiscard]] std::size_t watchedFiles() const noexcept { return m_files.size(); }
+    /// \brief Whether the operating system notifies the watcher, instead of it comparing write times.
+    [[nodiscard]] bool notified() const noexcept { return m_fd >= 0; }
+
+private:
+    /// \brief Changes of a file that are waiting for the debounce interval to pass.
+    struct PendingChange
+    {
+        std::chrono::steady_clock::time_point first;
+        std::chrono::steady_clock::time_point last;
+    };
+
+    std::chrono::milliseconds m_debounce;
+    /// \brief inotify instance, -1 if write times are compared instead.
+    int m_fd{ -1 };
+    /// \brief Watched directories by their inotify watch descriptor.
+    std::unordered_map<int, std::filesystem::path> m_directories;
+    /// \brief Watched files with their last write time, which is only kept up to date without inotify.
+    std::map<std::filesystem::path, std::filesystem::file_time_type> m_files;
+    std::map<std::filesystem::path, PendingChange> m_pending;
+    std::chrono::steady_clock::time_point m_lastScan;
+
+    void readEvents(std::chrono::steady_clock::time_point now);
+    void scanWriteTimes(std::chrono::steady_clock::time_point now);
+    void markChanged(const std::filesystem::path& filepath, std::chrono::steady_clock::time_point now);
+
+    [[nodiscard]] static std::filesystem::file_time_type writeTime(const std::filesystem::path& filepath);
+};
+
+} // namespace sfa
+
+#endif // !SFA_SRC_ENGINE_CORE_RESOURCE_MANAGEMENT_FILE_WATCHER_HPP
@@ -2,8 +2,12 @@
 #define SFA_SRC_ENGINE_CORE_RESOURCE_MANAGEMENT_I_RESOURCE_LOADER_HPP
 
 #include "core/resourceManagement/IntermediateResourceData.hpp"
+#include "core/resourceManagement/ResourceError.hpp"
 
+#include <expected>
 #include <filesystem>
+#include <span>
+#include <vector>
 
 namespace sfa
 {
@@ -43,12 +47,43 @@ public:
     ) = 0;
     /// \brief Load a texture from the disk.
     ///
-    /// A texture can be any PNG or JPEG image.
+    /// A texture can be any PNG or JPEG image, or a KTX2 container holding a (block compressed) 2D texture.
     ///
     /// \param filepath path to the texture file
     ///
     /// \returns \ref LoadResult of the load attempt
     virtual LoadResult loadTexture(const std::filesystem::path& filepath) = 0;
+
+    /// \brief Read a batch of textures from the disk without decoding them, the first half of
+    /// \ref IResourceLoader::loadTexture.
+    ///
+    /// Reading the whole batch at once lets a loader overlap the reads of its files. The default reads nothing and
+    /// leaves all of the work to \ref IResourceLoader::decodeTexture.
+    ///
+    /// \param filepaths paths to the texture files
+    ///
+    /// \returns an \ref EncodedTexture or a \ref ResourceError per path, in the order of \p filepaths
+    virtual std::vector<std::expected<EncodedTexture, ResourceError>> readTextures(
+        std::span<const std::filesystem::path> filepaths
+    )
+    {
+        std::vector<std::expected<EncodedTexture, ResourceError>> files;
+        files.reserve(filepaths.size());
+        for(const auto& filepath : filepaths)
+            files.emplace_back(EncodedTexture{ .filepath = filepath, .bytes = {} });
+
+        return files;
+    }
+    /// \brief Decode a texture read by \ref IResourceLoader::readTextures, the second half of
+    /// \ref IResourceLoader::loadTexture.
+    ///
+    /// Runs on any thread, every file of a batch may be decoded at the same time. The default loads the texture with
+    /// \ref IResourceLoader::loadTexture.
+    ///
+    /// \param file the texture file
+    ///
+    /// \returns \ref LoadResult of the decode attempt
+    virtual LoadResult decodeTexture(EncodedTexture file) { return loadTexture(file.filepath); }
 };
 
 } // namespace sfa
@@ -1,13 +1,14 @@
 #ifndef SFA_SRC_ENGINE_CORE_RESOURCE_MANAGEMENT_INTERMEDIATE_RESOURCE_DATA_HPP
 #define SFA_SRC_ENGINE_CORE_RESOURCE_MANAGEMENT_INTERMEDIATE_RESOURCE_DATA_HPP
 
+#include "core/PixelBuffer.hpp"
+#include "core/TextureCompression.hpp"
 #include "core/resourceManagement/ResourceError.hpp"
 
-#include <cstddef>
 #include <expected>
+#include <filesystem>
 #include <string>
 #include <variant>
-#include <vector>
 
 namespace sfa
 {
@@ -25,6 +26,10 @@ struct ShaderSourceData
 
 /// \brief Information from which an OpenGL texture can be created.
 ///
+/// Owns the decoded pixels without copying them, which makes it (and every \ref LoadResult) move-only. Compressed
+/// textures hold their compressed blocks instead, \ref TextureRawData::channels is the channel count they decode to.
+/// Textures with a mip chain hold every level, each directly following the previous one.
+///
 /// \author Felix Hommel
 /// \date 2/10/2026
 struct TextureRawData
@@ -32,7 +37,19 @@ struct TextureRawData
     int width;
     int height;
     int channels;
-    std::vector<std::byte> pixels;
+    PixelBuffer pixels;
+    TextureCompression compression{ TextureCompression::None };
+    int mipLevels{ 1 }; ///< Levels in pixels, including the full resolution one
+};
+
+/// \brief A texture file that was read from the disk but not decoded yet.
+///
+/// \author Felix Hommel
+/// \date 3/24/2026
+struct EncodedTexture
+{
+    std::filesystem::path filepath;
+    PixelBuffer bytes; ///< Whole content of the file, empty if the loader reads the file while decoding it
 };
 
 using ResourceData = std::variant<ShaderSourceData, TextureRawData>;
@@ -0,0 +1,156 @@
+#include "Ktx2.hpp"
+
+#include "core/PixelBuffer.hpp"
+#include "core/TextureCompression.hpp"
+#include "core/resourceManagement/IntermediateResourceData.hpp"
+#include "core/resourceManagement/ResourceError.hpp"
+
+#include <fmt/format.h>
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <expected>
+#include <filesystem>
+#include <optional>
+#include <span>
+#include <string>
+#include <utility>
+
+namespace sfa
+{
+
+namespace
+{
+
+static_assert(std::endian::native == std::endian::little, "KTX2 containers are stored little endian");
+
+constexpr std::array<unsigned char, 12> IDENTIFIER{ 0xab, 'K', 'T', 'X', ' ', '2', '0', 0xbb, '\r', '\n', 0x1a, '\n' };
+
+/// \brief Header and index of a KTX2 container, directly followed by the level index.
+struct Header
+{
+    std::array<unsigned char, 12> identifier;
+    std::uint32_t vkFormat;
+    std::uint32_t typeSize;
+    std::uint32_t pixelWidth;
+    std::uint32_t pixelHeight;
+    std::uint32_t pixelDepth;
+    std::uint32_t layerCount;
+    std::uint32_t faceCount;
+    std::uint32_t levelCount;
+    std::uint32_t supercompressionScheme;
+    std::uint32_t dfdByteOffset;
+    std::uint32_t dfdByteLength;
+    std::uint32_t kvdByteOffset;
+    std::uint32_t kvdByteLength;
+    std::uint64_t sgdByteOffset;
+    std::uint64_t sgdByteLength;
+};
+
+struct Level
+{
+    std::uint64_t byteOffset;
+    std::uint64_t byteLength;
+    std::uint64_t uncompressedByteLength;
+};
+
+static_assert(sizeof(Header) == 80 && sizeof(Level) == 24);
+
+/// \brief Layout of the texels of a supported VkFormat.
+struct Format
+{
+    TextureCompression compression;
+    int channels;
+};
+
+std::optional<Format> formatOf(std::uint32_t vkFormat)
+{
+    // NOTE: Values of the VkFormat enum, sRGB variants follow their linear counterpart
+    switch(vkFormat)
+    {
+        case 23: // VK_FORMAT_R8G8B8_UNORM
+        case 29: // VK_FORMAT_R8G8B8_SRGB
+            return Format{ .compression = TextureCompression::None, .channels = 3 };
+        case 37: // VK_FORMAT_R8G8B8A8_UNORM
+        case 43: // VK_FORMAT_R8G8B8A8_SRGB
+            return Format{ .compression = TextureCompression::None, .channels = 4 };
+        case 131: // VK_FORMAT_BC1_RGB_UNORM_BLOCK
+        case 132: // VK_FORMAT_BC1_RGB_SRGB_BLOCK
+            return Format{ .compression = TextureCompression::Bc1Rgb, .channels = 4 };
+        case 133: // VK_FORMAT_BC1_RGBA_UNORM_BLOCK
+        case 134: // VK_FORMAT_BC1_RGBA_SRGB_BLOCK
+            return Format{ .compression = TextureCompression::Bc1Rgba, .channels = 4 };
+        case 137: // VK_FORMAT_BC3_UNORM_BLOCK
+        case 138: // VK_FORMAT_BC3_SRGB_BLOCK
+            return Format{ .compression = TextureCompression::Bc3Rgba, .channels = 4 };
+        case 147: // VK_FORMAT_ETC2_R8G8B8_UNORM_BLOCK
+        case 148: // VK_FORMAT_ETC2_R8G8B8_SRGB_BLOCK
+            return Format{ .compression = TextureCompression::Etc2Rgb, .channels = 3 };
+        case 151: // VK_FORMAT_ETC2_R8G8B8A8_UNORM_BLOCK
+        case 152: // VK_FORMAT_ETC2_R8G8B8A8_SRGB_BLOCK
+            return Format{ .compression = TextureCompression::Etc2Rgba, .channels = 4 };
+        default:
+            return std::nullopt;
+    }
+}
+
+/// \brief Size of the full resolution level of a \p width x \p height texture in \p format.
+std::uint64_t levelSize(const Format& format, std::uint32_t width, std::uint32_t height)
+{
+    if(format.compression != TextureCompression::None)
+        return compressedSize(format.compression, static_cast<int>(width), static_cast<int>(height));
+
+    return static_cast<std::uint64_t>(width) * height * static_cast<std::uint64_t>(format.channels);
+}
+
+} // namespace
+
+std::expected<TextureRawData, ResourceError> parseKtx2(
+    std::span<const std::byte> file, const std::filesystem::path& filepath
+)
+{
+    const auto invalid{ [&filepath](std::string message) {
+        return std::unexpected(ResourceError::invalidFormat(filepath, std::move(message)));
+    } };
+
+    Header header;
+    if(file.size() < sizeof(header) + sizeof(Level))
+        return invalid("File is too small to be a KTX2 container");
+
+    std::memcpy(&header, file.data(), sizeof(header));
+    if(header.identifier != IDENTIFIER)
+        return invalid("File isn't a KTX2 container");
+    if(header.supercompressionScheme != 0)
+        return invalid(fmt::format("Unsupported supercompression scheme {}", header.supercompressionScheme));
+    if(header.pixelDepth != 0 || header.layerCount != 0 || header.faceCount != 1)
+        return invalid("Only single 2D textures are supported");
+
+    // NOTE: Limits the dimensions to what an int holds and keeps the size calculations from overflowing
+    constexpr std::uint32_t MAX_DIMENSION{ 1u << 16u };
+    if(header.pixelWidth == 0 || header.pixelHeight == 0 || header.pixelWidth > MAX_DIMENSION
+       || header.pixelHeight > MAX_DIMENSION)
+        return invalid(fmt::format("Invalid texture dimensions {}x{}", header.pixelWidth, header.pixelHeight));
+
+    const auto format{ formatOf(header.vkFormat) };
+    if(!format)
+        return invalid(fmt::format("Unsupported VkFormat {}", header.vkFormat));
+
+    // NOTE: The level index starts with the full resolution level
+    Level level;
+    std::memcpy(&level, file.data() + sizeof(header), sizeof(level));
+
+    const auto size{ levelSize(*format, header.pixelWidth, header.pixelHeight) };
+    if(level.byteOffset > file.size() || level.byteLength > file.size() - level.byteOffset || level.byteLength < size)
+        return invalid("Level data lies outside of the container");
+
+    return TextureRawData{ .width = static_cast<int>(header.pixelWidth),
+                           .height = static_cast<int>(header.pixelHeight),
+                           .channels = format->channels,
+                           .pixels = PixelBuffer::copyOf(file.subspan(level.byteOffset, size)),
+                           .compression = format->compression };
+}
+
+} // namespace sfa
@@ -0,0 +1,30 @@
+#ifndef SFA_SRC_ENGINE_CORE_RESOURCE_MANAGEMENT_KTX2_HPP
+#define SFA_SRC_ENGINE_CORE_RESOURCE_MANAGEMENT_KTX2_HPP
+
+#include "core/resourceManagement/IntermediateResourceData.hpp"
+#include "core/resourceManagement/ResourceError.hpp"
+
+#include <cstddef>
+#include <expected>
+#include <filesystem>
+#include <span>
+
+namespace sfa
+{
+
+/// \brief Read the full resolution level of a 2D texture stored in a KTX2 container.
+///
+/// Supports the BC1, BC3 and ETC2 block compressed formats as well as uncompressed RGB8 and RGBA8. sRGB formats are
+/// read as their linear counterpart. Supercompressed containers (BasisLZ, Zstandard) are rejected.
+///
+/// \param file the whole content of the container
+/// \param filepath path of the container, only used for errors
+///
+/// \returns the texture holding a copy of the level, or a \ref ResourceError if the container can't be used
+[[nodiscard]] std::expected<TextureRawData, ResourceError> parseKtx2(
+    std::span<const std::byte> file, const std::filesystem::path& filepath
+);
+
+} // namespace sfa
+
+#endif // !SFA_SRC_ENGINE_CORE_RESOURCE_MANAGEMENT_KTX2_HPP
@@ -0,0 +1,102 @@
+#include "MappedFile.hpp"
+
+#include "core/resourceManagement/ResourceError.hpp"
+
+#if defined(_WIN32)
+#    define WIN32_LEAN_AND_MEAN
+#    define NOMINMAX
+#    include <windows.h>
+#else
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#endif
+
+#include <cstddef>
+#include <expected>
+#include <filesystem>
+
+namespace sfa
+{
+
+#if defined(_WIN32)
+
+std::expected<MappedFile, ResourceError> MappedFile::open(const std::filesystem::path& filepath)
+{
+    HANDLE file{ CreateFileW(
+        filepath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr
+    ) };
+    if(file == INVALID_HANDLE_VALUE)
+        return std::unexpected(ResourceError::fileNotFound(filepath));
+
+    LARGE_INTEGER size{};
+    if(GetFileSizeEx(file, &size) == 0 || size.QuadPart <= 0)
+    {
+        CloseHandle(file);
+        return std::unexpected(ResourceError::invalidFormat(filepath, "File is empty or its size is unknown"));
+    }
+
+    // NOTE: The view keeps the mapping and the file alive, so both handles can be closed right away
+    HANDLE mapping{ CreateFileMappingW(file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr) };
+    CloseHandle(file);
+    if(mapping == nullptr)
+        return std::unexpected(ResourceError::invalidFormat(filepath, "Failed to create a file mapping"));
+
+    void* view{ MapViewOfFile(mapping, FILE_MAP_COPY, 0, 0, 0) };
+    CloseHandle(mapping);
+    if(view == nullptr)
+        return std::unexpected(ResourceError::invalidFormat(filepath, "Failed to map the file"));
+
+    return MappedFile{ static_cast<std::byte*>(view), static_cast<std::size_t>(size.QuadPart) };
+}
+
+void MappedFile::unmap() noexcept
+{
+    if(m_data != nullptr)
+        UnmapViewOfFile(m_data);
+
+    m_data = nullptr;
+    m_size = 0;
+}
+
+#else
+
+std::expected<MappedFile, ResourceError> MappedFile::open(const std::filesystem::path& filepath)
+{
+    const int fd{ ::open(filepath.c_str(), O_RDONLY | O_CLOEXEC) };
+    if(fd < 0)
+        return std::unexpected(ResourceError::fileNotFound(filepath));
+
+    struct stat info{};
+    if(::fstat(fd, &info) != 0 || info.st_size <= 0)
+    {
+        ::close(fd);
+        return std::unexpected(ResourceError::invalidFormat(filepath, "File is empty or its size is unknown"));
+    }
+
+    // NOTE: The mapping keeps the file alive, so the descriptor can be closed right away
+    const auto size{ static_cast<std::size_t>(info.st_size) };
+    void* view{ ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0) };
+    ::close(fd);
+    if(view == MAP_FAILED)
+        return std::unexpected(ResourceError::invalidFormat(filepath, "Failed to map the file"));
+
+    // NOTE: Start reading ahead right away, the whole file is usually needed during startup
+    ::madvise(view, size, MADV_WILLNEED);
+
+    return MappedFile{ static_cast<std::byte*>(view), size };
+}
+
+void MappedFile::unmap() noexcept
+{
+    if(m_data != nullptr)
+        ::munmap(m_data, m_size);
+
+    m_data = nullptr;
+    m_size = 0;
+}
+
+#endif
+
+} // namespace sfa
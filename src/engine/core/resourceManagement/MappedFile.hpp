@@ -0,0 +1,67 @@
+#ifndef SFA_SRC_ENGINE_CORE_RESOURCE_MANAGEMENT_MAPPED_FILE_HPP
+#define SFA_SRC_ENGINE_CORE_RESOURCE_MANAGEMENT_MAPPED_FILE_HPP
+
+#include "core/resourceManagement/ResourceError.hpp"
+
+#include <cstddef>
+#include <expected>
+#include <filesystem>
+#include <span>
+#include <utility>
+
+namespace sfa
+{
+
+/// \brief Maps a whole file into memory, read through mmap on POSIX and MapViewOfFile on Windows.
+///
+/// The mapping is private (copy-on-write), so the memory may be written to without changing the file. Pages are only
+/// read from the disk when they are first touched.
+///
+/// \author Felix Hommel
+/// \date 3/20/2026
+class MappedFile
+{
+public:
+    MappedFile() = default;
+    ~MappedFile() { unmap(); }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    MappedFile(MappedFile&& other) noexcept
+        : m_data(std::exchange(other.m_data, nullptr)), m_size(std::exchange(other.m_size, 0))
+    {
+    }
+    MappedFile& operator=(MappedFile&& other) noexcept
+    {
+        if(this != &other)
+        {
+            unmap();
+            m_data = std::exchange(other.m_data, nullptr);
+            m_size = std::exchange(other.m_size, 0);
+        }
+
+        return *this;
+    }
+
+    /// \brief Map the file at \p filepath.
+    ///
+    /// \returns the mapping, or a \ref ResourceError if the file doesn't exist, is empty or can't be mapped
+    static std::expected<MappedFile, ResourceError> open(const std::filesystem::path& filepath);
+
+    [[nodiscard]] std::byte* data() noexcept { return m_data; }
+    [[nodiscard]] const std::byte* data() const noexcept { return m_data; }
+    [[nodiscard]] std::size_t size() const noexcept { return m_size; }
+    [[nodiscard]] std::span<const std::byte> bytes() const noexcept { return { m_data, m_size }; }
+
+private:
+    std::byte* m_data{ nullptr };
+    std::size_t m_size{ 0 };
+
+    MappedFile(std::byte* data, std::size_t size) : m_data(data), m_size(size) {}
+
+    void unmap() noexcept;
+};
+
+} // namespace sfa
+
+#endif // !SFA_SRC_ENGINE_CORE_RESOURCE_MANAGEMENT_MAPPED_FILE_HPP
@@ -1,23 +1,34 @@
 #ifndef SFA_SRC_ENGINE_CORE_RESOURCE_MANAGEMENT_RESOURCE_CACHE_HPP
 #define SFA_SRC_ENGINE_CORE_RESOURCE_MANAGEMENT_RESOURCE_CACHE_HPP
 
+#include "core/resourceManagement/ResourceHandle.hpp"
+#include "core/resourceManagement/ResourceKey.hpp"
 #include "utility/exceptions/ResourceUnavailableException.hpp"
 
 #include "spdlog/spdlog.h"
 
 #include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
 #include <memory>
+#include <stdexcept>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 namespace sfa
 {
 
 /// \brief A resource cache is a container that stores a particular type of resource.
 ///
-/// Type-safe storage in a map, so that the resource can be accessed by a name. This requires that resources are move
-/// constructable.
+/// Resources live in a slot array and are referred to by a \ref ResourceHandle, which resolves in O(1). The name of a
+/// resource only has to be looked up once, to get its handle. Names are looked up as string views, so literals don't
+/// have to be copied into a string first, and a \ref ResourceKey is looked up by its precomputed hash alone. Every
+/// resource is stored with its size, once the sizes
+/// add up to more than the budget the least recently used resources that nobody but the cache holds are evicted.
 ///
 /// \author Felix Hommel
 /// \date 1/21/2026
@@ -25,6 +36,8 @@ template<typename T>
 class ResourceCache
 {
 public:
+    using Handle = ResourceHandle<T>;
+
     ResourceCache() = default;
     ~ResourceCache() = default;
 
@@ -35,16 +48,122 @@ public:
 
     /// \brief Store a new resource.
     ///
-    /// The method will overwrite an existing resource if the key already is in use.
+    /// The method will overwrite an existing resource if the key already is in use, its handle stays the same.
     ///
     /// \param key name by which the resource will be accessible
     /// \param resource the resource that is stored
-    void store(std::string key, std::shared_ptr<T> resource)
+    /// \param size (optional) memory the resource takes up, counted against the budget
+    ///
+    /// \returns handle to the resource
+    ///
+    /// \throws \ref std::length_error if there are more resources than a \ref ResourceHandle can refer to
+    /// \throws \ref std::invalid_argument if \p key has the same hash as the key of another resource
+    Handle store(std::string key, std::shared_ptr<T> resource, std::size_t size = 0)
     {
-        if(m_resources.contains(key))
+        if(const auto it{ m_handles.find(key) }; it != m_handles.end())
+        {
             spdlog::warn("Overwritten a resource with key: {}", key);
 
-        m_resources.insert_or_assign(std::move(key), std::move(resource));
+            auto& slot{ m_slots[it->second.index()] };
+            slot.resource = std::move(resource);
+            resize(slot, size);
+            touch(slot);
+            trim(it->second.index());
+
+            return it->second;
+        }
+
+        // NOTE: Looking up a ResourceKey only compares hashes, so two names must never share one
+        const auto hash{ ResourceKey::hash(key) };
+        if(m_keys.contains(hash))
+            throw std::invalid_argument("Resource key '" + key + "' has the same hash as another resource key");
+
+        const auto handle{ allocateSlot() };
+        auto& slot{ m_slots[handle.index()] };
+        slot.key = key;
+        slot.hash = hash;
+        slot.resource = std::move(resource);
+        resize(slot, size);
+        touch(slot);
+        m_keys.emplace(hash, handle);
+        m_handles.emplace(std::move(key), handle);
+        trim(handle.index());
+
+        return handle;
+    }
+
+    /// \brief Replace a stored resource in place, so everyone already holding it sees the new one.
+    ///
+    /// The new resource is move assigned into the stored one, which requires \p T to be move assignable. Stores
+    /// \p resource like \ref ResourceCache::store if the key isn't in use yet.
+    ///
+    /// \param key name of the resource that is replaced
+    /// \param resource the new resource
+    /// \param size (optional) memory the new resource takes up
+    ///
+    /// \returns handle to the resource
+    Handle replace(std::string_view key, std::shared_ptr<T> resource, std::size_t size = 0)
+    {
+        const auto it{ m_handles.find(key) };
+        if(it == m_handles.end() || resource == nullptr || m_slots[it->second.index()].resource == nullptr)
+            return store(std::string(key), std::move(resource), size);
+
+        auto& slot{ m_slots[it->second.index()] };
+        if(slot.resource != resource)
+            *slot.resource = std::move(*resource);
+        resize(slot, size);
+        touch(slot);
+        trim(it->second.index());
+
+        return it->second;
+    }
+
+    /// \brief Look up the handle of a resource, meant to be done once instead of looking up the name on every access.
+    ///
+    /// \returns handle to the resource, the default constructed handle if there is none stored under \p key
+    [[nodiscard]] Handle handle(std::string_view key) const
+    {
+        const auto it{ m_handles.find(key) };
+
+        return it != m_handles.end() ? it->second : Handle{};
+    }
+    /// \brief Look up the handle of a resource by the precomputed hash of \p key.
+    ///
+    /// \returns handle to the resource, the default constructed handle if there is none stored under \p key
+    [[nodiscard]] Handle handle(const ResourceKey& key) const
+    {
+        const auto it{ m_keys.find(key.hash()) };
+
+        return it != m_keys.end() ? it->second : Handle{};
+    }
+
+    /// \brief Resolve \p handle without taking ownership of the resource.
+    ///
+    /// The pointer stays valid until the resource is overwritten or evicted, which only happens while the cache is
+    /// modified.
+    ///
+    /// \returns the resource, *nullptr* if \p handle is stale or was never handed out
+    [[nodiscard]] T* resolve(Handle handle) const noexcept
+    {
+        const auto* slot{ find(handle) };
+        if(slot == nullptr)
+            return nullptr;
+
+        touch(*slot);
+        return slot->resource.get();
+    }
+
+    /// \brief Access a resource through its handle.
+    ///
+    /// \returns shared_ptr to the resource, *nullptr* if \p handle is stale or was never handed out
+    [[nodiscard]] std::shared_ptr<T> get(Handle handle) const noexcept
+    {
+        const auto* slot{ find(handle) };
+        if(slot == nullptr)
+            return nullptr;
+
+        touch(*slot);
+        return slot->resource;
     }
 
     /// \brief Access a resource.
@@ -54,41 +173,189 @@ public:
     /// \returns shared_ptr to the resource
     ///
     /// \throws \ref std::runtime_error if there is no resource stored under the name \p key
-    [[nodiscard]] std::shared_ptr<T> get(const std::string& key)
+    [[nodiscard]] std::shared_ptr<T> get(std::string_view key) const
     {
-        const auto it{ m_resources.find(key) };
-        if(it == m_resources.end())
-            throw ResourceUnavailableException("Resource cache could not find a resource with the provided key", key);
+        const auto it{ m_handles.find(key) };
+        if(it == m_handles.end())
+        {
+            throw ResourceUnavailableException(
+                "Resource cache could not find a resource with the provided key", std::string(key)
+            );
+        }
 
-        return it->second;
+        return get(it->second);
     }
 
-    /// \brief Access a resource.
+    /// \brief Access a resource by the precomputed hash of \p key.
     ///
     /// \param key which resource to access
     ///
     /// \returns shared_ptr to the resource
     ///
     /// \throws \ref std::runtime_error if there is no resource stored under the name \p key
-    [[nodiscard]] std::shared_ptr<T> get(const std::string& key) const
+    [[nodiscard]] std::shared_ptr<T> get(const ResourceKey& key) const
     {
-        const auto it{ m_resources.find(key) };
-        if(it == m_resources.end())
-            throw ResourceUnavailableException("Resource cache could not find a resource with the provided key", key);
+        const auto it{ m_keys.find(key.hash()) };
+        if(it == m_keys.end())
+        {
+            throw ResourceUnavailableException(
+                "Resource cache could not find a resource with the provided key", std::string(key.name())
+            );
+        }
 
-        return it->second;
+        return get(it->second);
     }
 
-    [[nodiscard]] bool contains(const std::string& key) const { return m_resources.contains(key); }
-    [[nodiscard]] bool empty() const noexcept { return m_resources.empty(); }
-    [[nodiscard]] std::size_t size() const noexcept { return m_resources.size(); }
-    void clear() noexcept { m_resources.clear(); }
+    /// \brief Evict the least recently used resources nobody but the cache holds, until the cache is within budget.
+    ///
+    /// Resources somebody else holds stay, even if the cache can't get within budget without them.
+    ///
+    /// \returns the size of the evicted resources
+    std::size_t trim() { return trim(NO_SLOT); }
+
+    /// \brief Limit the summed up size of the resources, 0 means unlimited.
+    ///
+    /// Evicts resources right away if the cache is over the new budget.
+    void setBudget(std::size_t budget)
+    {
+        m_budget = budget;
+        trim();
+    }
+
+    [[nodiscard]] std::size_t budget() const noexcept { return m_budget; }
+    /// \brief Summed up size of the stored resources.
+    [[nodiscard]] std::size_t usedSize() const noexcept { return m_usedSize; }
+    [[nodiscard]] bool overBudget() const noexcept { return m_budget != 0 && m_usedSize > m_budget; }
+    [[nodiscard]] bool contains(std::string_view key) const { return m_handles.contains(key); }
+    [[nodiscard]] bool contains(const ResourceKey& key) const { return m_keys.contains(key.hash()); }
+    [[nodiscard]] bool empty() const noexcept { return m_handles.empty(); }
+    [[nodiscard]] std::size_t size() const noexcept { return m_handles.size(); }
+
+    /// \brief Remove every resource, the handles handed out so far become stale.
+    void clear()
+    {
+        while(!m_handles.empty())
+            release(m_handles.begin()->second.index());
+    }
 
 private:
-    std::unordered_map<std::string, std::shared_ptr<T>> m_resources;
+    static constexpr auto NO_SLOT{ std::numeric_limits<std::uint32_t>::max() };
+
+    /// \brief Transparent hash, so names can be looked up as string views without creating a string first.
+    struct NameHash
+    {
+        using is_transparent = void;
+
+        std::size_t operator()(std::string_view name) const noexcept { return std::hash<std::string_view>{}(name); }
+    };
+
+    /// \brief The keys of the hash map already are hashes.
+    struct KeyHash
+    {
+        std::size_t operator()(std::uint64_t hash) const noexcept { return hash; }
+    };
+
+    /// \brief A resource together with what the cache knows about it.
+    struct Slot
+    {
+        std::string key;
+        /// \brief \ref ResourceKey::hash of the key.
+        std::uint64_t hash{ 0 };
+        std::shared_ptr<T> resource;
+        std::size_t size{ 0 };
+        std::uint32_t generation{ 1 };
+        /// \brief Value of the use clock when the resource was accessed last, the smallest one is evicted first.
+        mutable std::uint64_t lastUsed{ 0 };
+    };
+
+    std::vector<Slot> m_slots;
+    std::vector<std::uint32_t> m_freeSlots;
+    std::unordered_map<std::string, Handle, NameHash, std::equal_to<>> m_handles;
+    std::unordered_map<std::uint64_t, Handle, KeyHash> m_keys;
+    std::size_t m_budget{ 0 };
+    std::size_t m_usedSize{ 0 };
+    mutable std::uint64_t m_useClock{ 0 };
+
+    [[nodiscard]] const Slot* find(Handle handle) const noexcept
+    {
+        if(handle.index() >= m_slots.size())
+            return nullptr;
+
+        const auto& slot{ m_slots[handle.index()] };
+
+        return slot.generation == handle.generation() && slot.resource != nullptr ? &slot : nullptr;
+    }
+
+    void touch(const Slot& slot) const noexcept { slot.lastUsed = ++m_useClock; }
+
+    void resize(Slot& slot, std::size_t size) noexcept
+    {
+        m_usedSize = m_usedSize - slot.size + size;
+        slot.size = size;
+    }
+
+    Handle allocateSlot()
+    {
+        if(!m_freeSlots.empty())
+        {
+            const auto index{ m_freeSlots.back() };
+            m_freeSlots.pop_back();
+
+            return Handle{ index, m_slots[index].generation };
+        }
+
+        if(m_slots.size() > Handle::MAX_INDEX)
+            throw std::length_error("Resource cache is out of handles");
+
+        m_slots.emplace_back();
+
+        return Handle{ static_cast<std::uint32_t>(m_slots.size() - 1), m_slots.back().generation };
+    }
+
+    /// \brief Drop the resource in slot \p index and make its handles stale.
+    void release(std::uint32_t index)
+    {
+        auto& slot{ m_slots[index] };
+        m_handles.erase(slot.key);
+        m_keys.erase(slot.hash);
+        resize(slot, 0);
+        slot.key.clear();
+        slot.resource.reset();
+        // NOTE: Generation 0 is reserved for the default constructed handle
+        slot.generation = slot.generation == Handle::MAX_GENERATION ? 1 : slot.generation + 1;
+        m_freeSlots.push_back(index);
+    }
+
+    /// \brief Evict until the cache is within budget, never the resource in slot \p keep.
+    std::size_t trim(std::uint32_t keep)
+    {
+        // NOTE: Eviction is rare compared to accesses, so finding the least recently used resource is a scan instead of
+        // a list every access would have to reorder
+        std::size_t evicted{ 0 };
+        while(overBudget())
+        {
+            auto victim{ NO_SLOT };
+            for(std::uint32_t i{ 0 }; i < m_slots.size(); ++i)
+            {
+                const auto& slot{ m_slots[i] };
+                if(i == keep || slot.resource == nullptr || slot.resource.use_count() > 1)
+                    continue;
+                if(victim == NO_SLOT || slot.lastUsed < m_slots[victim].lastUsed)
+                    victim = i;
+            }
+
+            if(victim == NO_SLOT)
+                break;
+
+            spdlog::info("Evicted resource '{}' to stay within the budget", m_slots[victim].key);
+            evicted += m_slots[victim].size;
+            release(victim);
+        }
+
+        return evicted;
+    }
 };
 
 } // namespace sfa
 
 #endif // !SFA_SRC_ENGINE_CORE_RESOURCE_MANAGEMENT_RESOURCE_CACHE_HPP
-
@@ -1,152 +1,887 @@
 #include "ResourceContext.hpp"
 
+#include "core/Mipmaps.hpp"
+#include "core/Profiler.hpp"
 #include "core/Shader.hpp"
 #include "core/Texture.hpp"
+#include "core/TextureCompression.hpp"
+#include "core/resourceManagement/FileWatcher.hpp"
 #include "core/resourceManagement/IResourceLoader.hpp"
 #include "core/resourceManagement/IntermediateResourceData.hpp"
+#include "core/resourceManagement/ResourceError.hpp"
 #include "core/resourceManagement/ResourceLoader.hpp"
+#include "utility/TaskGroup.hpp"
 
 #include <spdlog/spdlog.h>
 
-#include <atomic>
+#include <algorithm>
+#include <array>
+#include <chrono>
 #include <cstddef>
+#include <cstdint>
 #include <exception>
+#include <expected>
+#include <filesystem>
+#include <map>
 #include <memory>
+#include <mutex>
+#include <optional>
+#include <span>
 #include <string>
-#include <thread>
 #include <utility>
 #include <variant>
+#include <vector>
 
 namespace sfa
 {
 
+namespace
+{
+
+using Clock = std::chrono::steady_clock;
+
+/// \brief Result an upload task sees when its load task threw before storing a result.
+LoadResult abortedLoad(const std::filesystem::path& path)
+{
+    return std::unexpected(
+        ResourceError{ .type = ResourceError::Type::Unknown, .message = "Loading was aborted", .filepath = path }
+    );
+}
+
+/// \brief Amount of bytes a stage produced for \p result, 0 if it failed.
+std::size_t resultSize(const LoadResult& result)
+{
+    const auto* texture{ result ? std::get_if<TextureRawData>(&*result) : nullptr };
+
+    return texture != nullptr ? texture->pixels.size() : 0;
+}
+
+/// \brief Name the resource of \p request is stored under.
+const std::string& requestName(const ResourceContext::ResourceRequest& request)
+{
+    return std::visit([](const auto& req) -> const std::string& { return req.name; }, request);
+}
+
+/// \brief Whether \p request loads the file \p filepath, which has to be normalized.
+bool requestReads(const ResourceContext::ResourceRequest& request, const std::filesystem::path& filepath)
+{
+    const auto matches{ [&filepath](const std::filesystem::path& path) {
+        return !path.empty() && FileWatcher::normalize(path) == filepath;
+    } };
+
+    if(const auto* shader{ std::get_if<ResourceContext::ShaderLoadRequest>(&request) })
+        return matches(shader->vert) || matches(shader->frag) || matches(shader->geom);
+
+    return matches(std::get<ResourceContext::TextureLoadRequest>(request).filepath);
+}
+
+} // namespace
+
+void ResourceContext::StageCounters::record(
+    std::size_t count, std::size_t size, std::chrono::nanoseconds busyTime, std::chrono::nanoseconds latencyTime
+) noexcept
+{
+    items.fetch_add(count, std::memory_order_relaxed);
+    bytes.fetch_add(size, std::memory_order_relaxed);
+    busy.fetch_add(busyTime.count(), std::memory_order_relaxed);
+    latency.fetch_add(latencyTime.count(), std::memory_order_relaxed);
+}
+
+ResourceContext::StageStats ResourceContext::StageCounters::snapshot() const noexcept
+{
+    return { .items = items.load(std::memory_order_relaxed),
+             .bytes = bytes.load(std::memory_order_relaxed),
+             .busy = std::chrono::nanoseconds{ busy.load(std::memory_order_relaxed) },
+             .latency = std::chrono::nanoseconds{ latency.load(std::memory_order_relaxed) } };
+}
+
 ResourceContext::ResourceContext(std::unique_ptr<IResourceLoader> loader)
     : m_loader((loader != nullptr) ? std::move(loader) : std::make_unique<ResourceLoader>())
-{}
+{
+    for(std::size_t i{ 0 }; i < TEXTURE_COMPRESSION_COUNT; ++i)
+        m_supportedCompressions[i] = Texture2D::supports(static_cast<TextureCompression>(i));
+
+    const std::array WHITE_PIXEL{ std::byte{ 0xFF }, std::byte{ 0xFF }, std::byte{ 0xFF }, std::byte{ 0xFF } };
+    m_placeholder = std::make_shared<Texture2D>(1, 1, 4, WHITE_PIXEL);
+}
 
 ResourceContext::~ResourceContext()
 {
     m_threadPool->shutdown(true);
-    m_uploadQueue.close();
 }
 
-void ResourceContext::requestResource(const ResourceRequest& request)
+ResourceContext::RequestHandle ResourceContext::requestResource(const ResourceRequest& request, JobPriority priority)
+{
+    rememberRequest(request);
+
+    return enqueueRequest(request, priority, std::nullopt);
+}
+
+ResourceFuture<Shader> ResourceContext::requestShader(const ShaderLoadRequest& request, JobPriority priority)
+{
+    rememberRequest(request);
+
+    return enqueueRequest(request, priority, std::nullopt);
+}
+
+ResourceFuture<Texture2D> ResourceContext::requestTexture(const TextureLoadRequest& request, JobPriority priority)
 {
-    m_inFlight.fetch_add(1, std::memory_order_acq_rel);
-    std::visit([this](const auto& req) { this->enqueueLoadTask(req); }, request);
+    rememberRequest(request);
+
+    return enqueueRequest(request, priority, std::nullopt);
 }
 
-void ResourceContext::processUploadQueue(std::size_t maxUploads)
+ResourceContext::UploadStats ResourceContext::processUploadQueue(const UploadBudget& budget)
 {
-    std::size_t processed{ 0 };
-    while(maxUploads == 0 || processed < maxUploads)
+    SFA_PROFILE_SCOPE("ResourceContext::processUploadQueue");
+
+    const auto start{ Clock::now() };
+
+    // NOTE: Textures stored by the last call were held until now, so callers could take them before they are evicted
+    m_storedTextures.clear();
+    if(m_textureCache.overBudget())
+        m_textureCache.trim();
+
+    reloadChangedFiles();
+
+    // NOTE: Queues the uploads of the loads that finished since the last call
+    m_threadPool->runMainThreadJobs();
+    m_callbacks->run();
+
+    UploadStats stats;
+    bool progressed{ false };
+    const auto exhausted{ [&]() {
+        return progressed
+            && ((budget.maxUploads != 0 && stats.uploads >= budget.maxUploads)
+                || (budget.maxBytes != 0 && stats.bytes >= budget.maxBytes)
+                || (budget.maxTime.count() != 0 && Clock::now() - start >= budget.maxTime));
+    } };
+
+    std::size_t freedSlots{ 0 };
+    while(!m_uploads.empty() && !exhausted())
     {
-        if(const auto& task{ m_uploadQueue.tryPop() }; task.has_value())
+        auto& task{ m_uploads.front() };
+        if(!task.stopToken.stop_requested())
         {
-            processUploadTask(*task);
+            progressed = true;
+
+            const auto maxBytes{ budget.maxBytes == 0 ? 0 : budget.maxBytes - stats.bytes };
+            const auto bytes{ stats.bytes };
+            const auto uploadStart{ Clock::now() };
+            const auto finished{ processUploadTask(task, maxBytes, stats) };
+            const auto uploadEnd{ Clock::now() };
 
-            m_inFlight.fetch_sub(1, std::memory_order_acq_rel);
-            ++processed;
+            m_uploadStats.record(0, stats.bytes - bytes, uploadEnd - uploadStart, std::chrono::nanoseconds{ 0 });
+            if(!finished)
+                continue;
+
+            m_uploadStats.record(1, 0, std::chrono::nanoseconds{ 0 }, uploadEnd - task.queuedAt);
+            ++stats.uploads;
         }
         else
-            break;
+        {
+            task.shaderFuture.reject(ResourceFuture<Shader>::cancelled());
+            task.textureFuture.reject(ResourceFuture<Texture2D>::cancelled());
+        }
+
+        if(task.inFlight)
+            ++freedSlots;
+        m_uploads.pop_front();
     }
+
+    if(freedSlots > 0)
+        releaseReadSlots(freedSlots);
+
+    stats.time = std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - start);
+    stats.deferred = m_uploads.size();
+    m_lastUploadStats = stats;
+
+    return stats;
 }
 
 void ResourceContext::waitForAllUploads()
 {
-    while(m_inFlight.load(std::memory_order_acquire) > 0)
-    {
-        processUploadQueue();
-        std::this_thread::yield();
-    }
+    SFA_PROFILE_SCOPE("ResourceContext::waitForAllUploads");
+
+    waitUntil(std::chrono::steady_clock::time_point::max());
+}
+
+bool ResourceContext::waitFor(std::chrono::nanoseconds timeout)
+{
+    SFA_PROFILE_SCOPE("ResourceContext::waitFor");
+
+    return waitUntil(std::chrono::steady_clock::now() + timeout);
+}
+
+void ResourceContext::enableHotReload(std::chrono::milliseconds debounce)
+{
+    std::lock_guard lock(m_requestMutex);
+
+    m_watcher = std::make_unique<FileWatcher>(debounce);
+    for(const auto& [name, request] : m_requests)
+        watchFiles(request);
+
+    spdlog::info("Hot reloading is watching {} files", m_watcher->watchedFiles());
 }
 
 void ResourceContext::clear()
 {
+    {
+        std::lock_guard lock(m_requestMutex);
+        m_requests.clear();
+    }
+    m_reloads.clear();
+
     m_shaderCache.clear();
+    m_storedTextures.clear();
     m_textureCache.clear();
+    m_samplers.clear();
+}
+
+/// \brief Start loading the resource of \p request.
+///
+/// \param request the resource that is loaded
+/// \param priority lane of the load
+/// \param changedAt when the change that caused a hot reload was noticed, empty for the first load
+///
+/// \returns handle to cancel the request
+ResourceContext::RequestHandle ResourceContext::enqueueRequest(
+    const ResourceRequest& request, JobPriority priority, ChangeTime changedAt
+)
+{
+    return std::visit(
+        [this, priority, changedAt](const auto& req) {
+            return handleOf(this->enqueueRequest(req, priority, changedAt));
+        },
+        request
+    );
+}
+
+/// \brief Start loading the shader of \p request.
+///
+/// \returns future of the request
+ResourceFuture<Shader> ResourceContext::enqueueRequest(
+    const ShaderLoadRequest& request, JobPriority priority, ChangeTime changedAt
+)
+{
+    auto future{ ResourceFuture<Shader>::create(m_callbacks) };
+    enqueueLoadTask(request, JobOptions{ .priority = priority, .stopToken = future.stopToken() }, changedAt, future);
+
+    return future;
+}
+
+/// \brief Start loading the texture of \p request.
+///
+/// \returns future of the request
+ResourceFuture<Texture2D> ResourceContext::enqueueRequest(
+    const TextureLoadRequest& request, JobPriority priority, ChangeTime changedAt
+)
+{
+    auto future{ ResourceFuture<Texture2D>::create(m_callbacks) };
+    enqueueLoadTask(request, JobOptions{ .priority = priority, .stopToken = future.stopToken() }, changedAt, future);
+
+    return future;
+}
+
+/// \brief Remember \p request to reload it once its files change, and watch them if hot reloading is enabled.
+void ResourceContext::rememberRequest(const ResourceRequest& request)
+{
+    std::lock_guard lock(m_requestMutex);
+
+    m_requests.insert_or_assign(requestName(request), request);
+    if(m_watcher != nullptr)
+        watchFiles(request);
 }
 
 /// \brief Enqueue a new \ref ShaderLoadRequest.
 ///
 /// \param request providing details about the shader that is to be loaded.
-void ResourceContext::enqueueLoadTask(const ShaderLoadRequest& request)
+/// \param options priority and stop token of the request
+/// \param changedAt set if the shader is hot reloaded
+/// \param future completed once the shader is uploaded or failed
+void ResourceContext::enqueueLoadTask(
+    const ShaderLoadRequest& request,
+    const JobOptions& options,
+    ChangeTime changedAt,
+    const ResourceFuture<Shader>& future
+)
 {
-    m_threadPool->enqueue([this, req = request]() {
-        m_uploadQueue.emplace(req.name, m_loader->loadShader(req.vert, req.frag, req.geom));
-    });
+    auto task{ std::make_shared<UploadTask>(request.name, abortedLoad(request.vert), options.stopToken) };
+    task->changedAt = changedAt;
+    task->shaderFuture = future;
+
+    const auto load{ m_loads.run(
+        [this, task, req = request]() {
+            SFA_PROFILE_SCOPE("ResourceContext::loadShader");
+
+            task->result = m_loader->loadShader(req.vert, req.frag, req.geom);
+        },
+        TaskAffinity::Worker,
+        options
+    ) };
+
+    enqueueUploadTask(load, task, options);
 }
 
 /// \brief Enqueue a new \ref TextureLoadRequest.
 ///
+/// The request waits for the read stage, which takes requests of higher priority first.
+///
 /// \param request providing details about the texture that is to be loaded.
-void ResourceContext::enqueueLoadTask(const TextureLoadRequest& request)
+/// \param options priority and stop token of the request
+/// \param changedAt set if the texture is hot reloaded
+/// \param future completed once the texture is uploaded or failed
+void ResourceContext::enqueueLoadTask(
+    const TextureLoadRequest& request,
+    const JobOptions& options,
+    ChangeTime changedAt,
+    const ResourceFuture<Texture2D>& future
+)
+{
+    auto task{ std::make_shared<UploadTask>(request.name, abortedLoad(request.filepath), options.stopToken) };
+    task->mips = request.mips;
+    task->changedAt = changedAt;
+    task->textureFuture = future;
+
+    std::lock_guard lock(m_readMutex);
+
+    m_reads[static_cast<std::size_t>(options.priority)].push_back(PendingRead{ .task = std::move(task),
+                                                                               .filepath = request.filepath,
+                                                                               .options = options,
+                                                                               .queuedAt = Clock::now() });
+    startReader();
+}
+
+/// \brief Continue a load task with queueing its upload on the main thread.
+///
+/// \param load the task that fills in \p task
+/// \param task shared between the load and the upload task
+/// \param options stop token of the request
+void ResourceContext::enqueueUploadTask(
+    const TaskHandle& load, const std::shared_ptr<UploadTask>& task, const JobOptions& options
+)
 {
-    m_threadPool->enqueue([this, req = request]() {
-        m_uploadQueue.emplace(req.name, m_loader->loadTexture(req.filepath));
-    });
+    m_loads.runAfter(
+        { load },
+        [this, task]() {
+            task->queuedAt = Clock::now();
+            m_uploads.push_back(std::move(*task));
+        },
+        TaskAffinity::MainThread,
+        options
+    );
 }
 
-/// \brief Upload a loaded resource to the GPU.
+/// \brief Decode a texture the read stage read and queue its upload afterwards.
+///
+/// \param read the request the texture was read for
+/// \param file result of reading the texture
+void ResourceContext::enqueueDecodeTask(PendingRead read, std::expected<EncodedTexture, ResourceError> file)
+{
+    read.task->inFlight = true;
+
+    // NOTE: The stop token is polled instead of handed to the tasks, a cancelled texture still has to reach the upload
+    // queue to give its slot back
+    const JobOptions options{ .priority = read.options.priority, .stopToken = {} };
+    const auto decode{ m_loads.run(
+        [this,
+         task = read.task,
+         filepath = std::move(read.filepath),
+         stopToken = std::move(read.options.stopToken),
+         file = std::move(file),
+         queuedAt = Clock::now()]() mutable {
+            if(stopToken.stop_requested())
+                return;
+
+            SFA_PROFILE_SCOPE("ResourceContext::decodeTexture");
+
+            const auto start{ Clock::now() };
+
+            auto result{
+                file ? m_loader->decodeTexture(std::move(*file)) : LoadResult{ std::unexpected(file.error()) }
+            };
+            result = decompressUnsupported(std::move(result), filepath);
+            if(task->mips == MipmapMode::Cpu)
+                result = buildMips(std::move(result));
+
+            const auto end{ Clock::now() };
+            m_decodeStats.record(1, resultSize(result), end - start, end - queuedAt);
+
+            task->result = std::move(result);
+        },
+        TaskAffinity::Worker,
+        options
+    ) };
+
+    enqueueUploadTask(decode, read.task, options);
+}
+
+/// \brief Start the read stage unless it is running already or every slot of the pipeline is taken.
+///
+/// \note m_readMutex has to be locked by the caller.
+void ResourceContext::startReader()
+{
+    const auto queued{ std::ranges::any_of(m_reads, [](const auto& lane) { return !lane.empty(); }) };
+    if(m_readerActive || m_freeReadSlots == 0 || !queued)
+        return;
+
+    m_readerActive = true;
+    m_loads.run(
+        [this]() { readTextures(); },
+        TaskAffinity::Worker,
+        JobOptions{ .priority = JobPriority::Critical, .stopToken = {} }
+    );
+}
+
+/// \brief The read stage, reads batches of queued textures until the queue is empty or the pipeline is full.
+void ResourceContext::readTextures()
+{
+    SFA_PROFILE_SCOPE("ResourceContext::readTextures");
+
+    std::vector<PendingRead> batch;
+    std::vector<std::filesystem::path> filepaths;
+    for(;;)
+    {
+        batch.clear();
+        filepaths.clear();
+        {
+            std::lock_guard lock(m_readMutex);
+
+            takeReads(batch);
+            if(batch.empty())
+            {
+                m_readerActive = false;
+                return;
+            }
+        }
+
+        for(const auto& read : batch)
+            filepaths.push_back(read.filepath);
+
+        const auto start{ Clock::now() };
+
+        std::vector<std::expected<EncodedTexture, ResourceError>> files;
+        try
+        {
+            files = m_loader->readTextures(filepaths);
+        }
+        catch(const std::exception& e)
+        {
+            spdlog::error("Failed to read a batch of textures: {}", e.what());
+            files.clear();
+        }
+
+        const auto end{ Clock::now() };
+
+        std::size_t bytes{ 0 };
+        std::chrono::nanoseconds latency{ 0 };
+        for(std::size_t i{ 0 }; i < batch.size(); ++i)
+        {
+            if(i >= files.size())
+                files.emplace_back(std::unexpected(abortedLoad(batch[i].filepath).error()));
+            else if(files[i])
+                bytes += files[i]->bytes.size();
+
+            latency += end - batch[i].queuedAt;
+        }
+        m_readStats.record(batch.size(), bytes, end - start, latency);
+
+        for(std::size_t i{ 0 }; i < batch.size(); ++i)
+            enqueueDecodeTask(std::move(batch[i]), std::move(files[i]));
+    }
+}
+
+/// \brief Take the next batch of queued reads, limited by \ref ResourceContext::READ_BATCH_SIZE and the free slots.
+///
+/// Cancelled requests are dropped on the way. m_readMutex has to be locked by the caller.
+///
+/// \param batch receives the reads, in priority order
+void ResourceContext::takeReads(std::vector<PendingRead>& batch)
+{
+    for(auto& lane : m_reads)
+    {
+        while(!lane.empty() && batch.size() < std::min(READ_BATCH_SIZE, m_freeReadSlots))
+        {
+            if(!lane.front().options.stopToken.stop_requested())
+                batch.push_back(std::move(lane.front()));
+
+            lane.pop_front();
+        }
+    }
+
+    m_freeReadSlots -= batch.size();
+}
+
+/// \brief Give back the slots of textures that left the upload queue and resume reading if it stalled on them.
+///
+/// \param count amount of slots that are free again
+void ResourceContext::releaseReadSlots(std::size_t count)
+{
+    std::lock_guard lock(m_readMutex);
+
+    m_freeReadSlots += count;
+    startReader();
+}
+
+/// \brief Watch every file \p request loads.
+///
+/// \note m_requestMutex has to be locked by the caller.
+void ResourceContext::watchFiles(const ResourceRequest& request)
+{
+    if(const auto* shader{ std::get_if<ShaderLoadRequest>(&request) })
+    {
+        for(const auto* path : { &shader->vert, &shader->frag, &shader->geom })
+        {
+            if(!path->empty())
+                m_watcher->watch(*path);
+        }
+
+        return;
+    }
+
+    m_watcher->watch(std::get<TextureLoadRequest>(request).filepath);
+}
+
+/// \brief Load every resource whose files changed again, cancelling reloads of them that are still running.
+///
+/// A resource with several changed files is only reloaded once.
+void ResourceContext::reloadChangedFiles()
+{
+    std::map<std::string, std::pair<ResourceRequest, Clock::time_point>> reloads;
+    {
+        std::lock_guard lock(m_requestMutex);
+        if(m_watcher == nullptr)
+            return;
+
+        for(const auto& change : m_watcher->poll())
+        {
+            for(const auto& [name, request] : m_requests)
+            {
+                if(!requestReads(request, change.filepath))
+                    continue;
+
+                const auto [it, inserted]{ reloads.try_emplace(name, request, change.changedAt) };
+                if(!inserted)
+                    it->second.second = std::min(it->second.second, change.changedAt);
+            }
+        }
+    }
+
+    for(const auto& [name, reload] : reloads)
+    {
+        SFA_PROFILE_SCOPE("ResourceContext::reloadChangedFiles");
+
+        spdlog::info("Files of '{}' changed, reloading it", name);
+
+        auto& handle{ m_reloads[name] };
+        handle.cancel();
+        handle = enqueueRequest(reload.first, JobPriority::Critical, reload.second);
+    }
+}
+
+/// \brief Account for a hot reload that finished uploading.
+///
+/// \param task upload of the reloaded resource
+/// \param succeeded whether the resource was replaced, the previous version is kept otherwise
+void ResourceContext::finishReload(const UploadTask& task, bool succeeded)
+{
+    m_reloads.erase(task.key);
+
+    if(!succeeded)
+    {
+        ++m_hotReloadStats.failures;
+        spdlog::warn("Hot reload of '{}' failed, keeping the previous version", task.key);
+        return;
+    }
+
+    const auto latency{ Clock::now() - *task.changedAt };
+    ++m_hotReloadStats.reloads;
+    m_hotReloadStats.lastLatency = latency;
+    m_hotReloadStats.totalLatency += latency;
+
+    spdlog::info(
+        "Hot reloaded '{}' in {:.2f} ms",
+        task.key,
+        std::chrono::duration<double, std::milli>(latency).count()
+    );
+}
+
+/// \brief Upload until every requested resource is uploaded or \p deadline passed.
+///
+/// Sleeps while there is nothing to upload yet.
+///
+/// \returns *true* if every requested resource is uploaded
+bool ResourceContext::waitUntil(std::chrono::steady_clock::time_point deadline)
+{
+    const auto unlimited{ deadline == Clock::time_point::max() };
+    for(;;)
+    {
+        UploadBudget budget{};
+        if(!unlimited)
+        {
+            const auto now{ Clock::now() };
+            if(now >= deadline)
+                return uploadsFinished();
+
+            budget.maxTime = std::chrono::ceil<std::chrono::microseconds>(deadline - now);
+        }
+
+        processUploadQueue(budget);
+        if(uploadsFinished())
+            return true;
+
+        if(m_uploads.empty())
+            m_loads.waitForMainThreadTasks(deadline);
+    }
+}
+
+/// \brief Upload (the next part of) a loaded resource to the GPU.
 ///
 /// \param task a \ref UploadTask containing the needed information to upload the resource.
-void ResourceContext::processUploadTask(const UploadTask& task)
+/// \param maxBytes how many bytes to upload at most (0 := unlimited)
+/// \param stats stats of the current \ref ResourceContext::processUploadQueue call
+///
+/// \returns *true* once the resource is uploaded or failed, *false* if parts of it are left
+bool ResourceContext::processUploadTask(UploadTask& task, std::size_t maxBytes, UploadStats& stats)
 {
-    if(const auto t{ task.result }; t.has_value())
-        std::visit([this, &task](const auto& resourceData) { this->uploadToGPU(task.key, resourceData); }, t.value());
-    else
+    if(const auto& t{ task.result }; !t.has_value())
     {
         const auto& error{ t.error() };
         spdlog::error("Failed to load resource '{}': {} ({})", task.key, error.message, error.filepath.string());
+        failUpload(task, error);
 
-        // TODO: Potentially store error in the resource cache, or give other possibility for accessors to know the resource
-        // failed loading.
-        return;
+        return true;
     }
+
+    if(const auto* shader{ std::get_if<ShaderSourceData>(&task.result.value()) })
+    {
+        stats.bytes += shader->vertexSource.size() + shader->fragmentSource.size() + shader->geometrySource.size();
+        uploadToGPU(task, *shader);
+
+        return true;
+    }
+
+    return uploadToGPU(task, std::get<TextureRawData>(task.result.value()), maxBytes, stats);
+}
+
+/// \brief Fail the future of a resource that couldn't be loaded or uploaded.
+///
+/// A hot reloaded resource keeps its previous version.
+///
+/// \param task upload of the resource
+/// \param error why the resource failed
+void ResourceContext::failUpload(const UploadTask& task, const ResourceError& error)
+{
+    task.shaderFuture.reject(error);
+    task.textureFuture.reject(error);
+
+    if(task.changedAt)
+        finishReload(task, false);
+}
+
+/// \brief Decompress a loaded texture on the CPU if the driver can't sample from its compressed format.
+///
+/// \param result result of loading the texture
+/// \param filepath path of the texture, only used for errors
+///
+/// \returns \p result, or the decompressed texture if it is compressed in an unsupported format
+LoadResult ResourceContext::decompressUnsupported(LoadResult result, const std::filesystem::path& filepath) const
+{
+    auto* texture{ result ? std::get_if<TextureRawData>(&*result) : nullptr };
+    if(texture == nullptr || m_supportedCompressions[static_cast<std::size_t>(texture->compression)])
+        return result;
+
+    if(!canDecompress(texture->compression))
+    {
+        return std::unexpected(
+            ResourceError::invalidFormat(filepath, "The driver doesn't support the compression of the texture")
+        );
+    }
+
+    SFA_PROFILE_SCOPE("ResourceContext::decompressTexture");
+
+    auto pixels{ decompress(texture->compression, texture->width, texture->height, texture->pixels.bytes()) };
+    if(pixels.empty())
+        return std::unexpected(ResourceError::invalidFormat(filepath, "Compressed blocks don't match the texture"));
+
+    return ResourceData{ TextureRawData{
+        .width = texture->width, .height = texture->height, .channels = 4, .pixels = std::move(pixels) } };
+}
+
+/// \brief Box filter the mip chain of a loaded texture on the CPU.
+///
+/// \param result result of loading the texture
+///
+/// \returns \p result, or the texture together with its mip chain if it is uncompressed and has no mip levels yet
+LoadResult ResourceContext::buildMips(LoadResult result)
+{
+    auto* texture{ result ? std::get_if<TextureRawData>(&*result) : nullptr };
+    if(texture == nullptr || texture->compression != TextureCompression::None || texture->mipLevels != 1)
+        return result;
+
+    SFA_PROFILE_SCOPE("ResourceContext::buildMips");
+
+    const auto levelSize{ mipChainSize(texture->width, texture->height, texture->channels, 1) };
+    if(levelSize == 0 || texture->pixels.size() < levelSize)
+        return result;
+
+    auto chain{ buildMipChain(texture->pixels.bytes(), texture->width, texture->height, texture->channels) };
+
+    return ResourceData{ TextureRawData{ .width = texture->width,
+                                         .height = texture->height,
+                                         .channels = texture->channels,
+                                         .pixels = std::move(chain),
+                                         .mipLevels = mipLevelCount(texture->width, texture->height) } };
 }
 
 /// \brief Upload a shader to the GPU
 ///
-/// \param key with which the shader can be accessed
+/// \param task upload the shader belongs to, its key is the one the shader can be accessed with
 /// \param data \ref ShaderSourceData containing the source code for the shader
-void ResourceContext::uploadToGPU(const std::string& key, const ShaderSourceData& data)
+void ResourceContext::uploadToGPU(const UploadTask& task, const ShaderSourceData& data)
 {
     try
     {
-        m_shaderCache.store(
-            key,
+        storeResource(
+            m_shaderCache,
+            task,
             std::make_shared<Shader>(
                 data.vertexSource.c_str(),
                 data.fragmentSource.c_str(),
                 data.geometrySource.empty() ? nullptr : data.geometrySource.c_str()
-            )
+            ),
+            0
         );
 
-        spdlog::info("Upload shader '{}' to GPU", key);
+        spdlog::info("Upload shader '{}' to GPU", task.key);
     }
     catch(const std::exception& e)
     {
-        spdlog::error("Failed to upload shader '{}': {}", key, e.what());
+        spdlog::error("Failed to upload shader '{}': {}", task.key, e.what());
+        failUpload(task, ResourceError{ .type = ResourceError::Type::GLError, .message = e.what(), .filepath = {} });
     }
 }
 
-/// \brief Upload a texture to the GPU
+/// \brief Upload the next chunk of rows of a texture to the GPU
+///
+/// The texture is only stored in the cache once all of its rows are uploaded.
 ///
-/// \param key with which the texture can be accessed
+/// \param task upload the texture belongs to, keeps track of the uploaded rows
 /// \param data \ref TextureRawData containing the pixel data for the texture
-void ResourceContext::uploadToGPU(const std::string& key, const TextureRawData& data)
+/// \param maxBytes how many bytes the chunk may have at most (0 := unlimited), at least one row is uploaded
+/// \param stats stats of the current \ref ResourceContext::processUploadQueue call
+///
+/// \returns *true* once the texture is uploaded completely or failed
+bool ResourceContext::uploadToGPU(
+    UploadTask& task, const TextureRawData& data, std::size_t maxBytes, UploadStats& stats
+)
 {
     try
     {
-        m_textureCache.store(key, std::make_shared<Texture2D>(data.width, data.height, data.channels, data.pixels));
+        if(data.compression != TextureCompression::None)
+        {
+            // NOTE: Compressed blocks are a fraction of the decoded size, they are uploaded in a single step
+            const auto size{ compressedSize(data.compression, data.width, data.height) };
+            if(size == 0 || data.pixels.size() < size)
+            {
+                failUpload(
+                    task, ResourceError::invalidFormat({}, "Compressed data doesn't match the texture dimensions")
+                );
+                return true;
+            }
+
+            stats.bytes += size;
+            auto texture{ std::make_shared<Texture2D>(
+                data.width, data.height, data.compression, data.pixels.bytes().first(size)
+            ) };
+            const auto gpuSize{ texture->gpuSize() };
+            storeResource(m_textureCache, task, std::move(texture), gpuSize);
+
+            spdlog::info("Upload compressed texture '{}' to GPU", task.key);
+            return true;
+        }
+
+        const auto rowSize{ static_cast<std::size_t>(data.width) * static_cast<std::size_t>(data.channels) };
+        const auto levelSize{ rowSize * static_cast<std::size_t>(std::max(data.height, 0)) };
+        if(levelSize == 0 || data.mipLevels < 1 || data.mipLevels > mipLevelCount(data.width, data.height)
+           || data.pixels.size() < mipChainSize(data.width, data.height, data.channels, data.mipLevels))
+        {
+            failUpload(task, ResourceError::invalidFormat({}, "Pixel data doesn't match the texture dimensions"));
+            return true;
+        }
+
+        const auto remainingRows{ static_cast<std::size_t>(data.height - task.uploadedRows) };
+        auto rows{ remainingRows };
+        if(maxBytes != 0)
+        {
+            // NOTE: Keep streamed chunks within one pixel buffer, so they take the asynchronous path
+            const auto bufferSize{ m_uploader.bufferSize() };
+            const auto chunkSize{ bufferSize == 0 ? maxBytes : std::min(maxBytes, bufferSize) };
+            rows = std::clamp<std::size_t>(chunkSize / rowSize, 1, remainingRows);
+        }
+
+        if(task.texture == nullptr)
+        {
+            // NOTE: A texture that doesn't fit into a pixel buffer would be uploaded from the decoded pixels anyway
+            const auto wholeTexture{ rows == static_cast<std::size_t>(data.height) };
+            if(wholeTexture && levelSize > m_uploader.bufferSize())
+            {
+                stats.bytes += mipChainSize(data.width, data.height, data.channels, data.mipLevels);
+                task.texture =
+                    std::make_shared<Texture2D>(data.width, data.height, data.channels, data.pixels, data.mipLevels);
+                task.uploadedRows = data.height;
+                finishTexture(task, data);
+                return true;
+            }
+
+            task.texture = std::make_shared<Texture2D>(
+                data.width, data.height, data.channels, std::span<const std::byte>{}, data.mipLevels
+            );
+        }
+
+        const auto offset{ static_cast<std::size_t>(task.uploadedRows) * rowSize };
+        const auto size{ rows * rowSize };
+        m_uploader.upload(
+            *task.texture, task.uploadedRows, static_cast<int>(rows), data.pixels.bytes().subspan(offset, size)
+        );
+
+        task.uploadedRows += static_cast<int>(rows);
+        stats.bytes += size;
+        if(task.uploadedRows < data.height)
+            return false;
+
+        // NOTE: The smaller levels add up to a third of the full resolution one at most, they are uploaded at once
+        for(int level{ 1 }; level < data.mipLevels; ++level)
+        {
+            const auto levelOffset{ mipChainSize(data.width, data.height, data.channels, level) };
+            task.texture->uploadLevel(level, data.pixels.data() + levelOffset);
+        }
+        stats.bytes += mipChainSize(data.width, data.height, data.channels, data.mipLevels) - levelSize;
 
-        spdlog::info("Upload texture '{}' to GPU", key);
+        finishTexture(task, data);
     }
     catch(const std::exception& e)
     {
-        spdlog::error("Failed to upload texture '{}': {}", key, e.what());
+        spdlog::error("Failed to upload texture '{}': {}", task.key, e.what());
+        failUpload(task, ResourceError{ .type = ResourceError::Type::GLError, .message = e.what(), .filepath = {} });
     }
+
+    return true;
+}
+
+/// \brief Generate the requested mip levels of a completely uploaded texture and make it accessible.
+///
+/// \param task upload the texture belongs to
+/// \param data \ref TextureRawData the texture was uploaded from
+void ResourceContext::finishTexture(UploadTask& task, const TextureRawData& data)
+{
+    if(task.mips == MipmapMode::Gpu && data.mipLevels == 1)
+        task.texture->generateMipmaps();
+
+    const auto gpuSize{ task.texture->gpuSize() };
+    storeResource(m_textureCache, task, std::move(task.texture), gpuSize);
+
+    spdlog::info("Upload texture '{}' to GPU", task.key);
 }
 
 } // namespace sfa
@@ -1,30 +1,61 @@
 #ifndef SFA_SRC_ENGINE_CORE_RESOURCE_MANAGEMENT_RESOURCE_CONTEXT_HPP
 #define SFA_SRC_ENGINE_CORE_RESOURCE_MANAGEMENT_RESOURCE_CONTEXT_HPP
 
+#include "core/Mipmaps.hpp"
+#include "core/Sampler.hpp"
 #include "core/Shader.hpp"
 #include "core/Texture.hpp"
+#include "core/TextureCompression.hpp"
+#include "core/TextureUploader.hpp"
+#include "core/resourceManagement/FileWatcher.hpp"
 #include "core/resourceManagement/IResourceLoader.hpp"
 #include "core/resourceManagement/IntermediateResourceData.hpp"
 #include "core/resourceManagement/ResourceCache.hpp"
-#include "utility/BlockingQueue.hpp"
+#include "core/resourceManagement/ResourceError.hpp"
+#include "core/resourceManagement/ResourceFuture.hpp"
+#include "core/resourceManagement/ResourceHandle.hpp"
+#include "core/resourceManagement/ResourceKey.hpp"
+#include "utility/TaskGroup.hpp"
 #include "utility/ThreadPool.hpp"
+#include "utility/details/Threading.hpp"
 
 #include <algorithm>
+#include <array>
 #include <atomic>
-#include <condition_variable>
+#include <bitset>
+#include <chrono>
 #include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <expected>
 #include <filesystem>
+#include <map>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <string>
+#include <string_view>
 #include <thread>
+#include <type_traits>
+#include <utility>
 #include <variant>
+#include <vector>
 
 namespace sfa
 {
 
 /// \brief The \ref ResourceContext class is responsible for loading and managing resources.
 ///
+/// Textures go through a pipeline of three stages: a single read task at a time reads batches of files through
+/// \ref IResourceLoader::readTextures, every file is then decoded in a task of its own on the workers and the main
+/// thread finally uploads the decoded textures. Only \ref ResourceContext::TEXTURES_IN_FLIGHT_PER_WORKER textures per
+/// worker may be between being read and being uploaded at a time, further reads wait until uploads make room again.
+/// Shaders are small enough to be loaded by a single task.
+///
+/// With \ref ResourceContext::enableHotReload the files of every requested resource are watched, a resource whose
+/// files changed is loaded again and replaces the previous version in place once it is uploaded, so every holder of
+/// the resource draws with the new version from the next frame on.
+///
 /// \author Felix Hommel
 /// \date 1/23/2026
 class ResourceContext
@@ -50,12 +81,115 @@ public:
     {
         std::string name;
         std::filesystem::path filepath;
+        /// \brief Where the mip chain comes from, levels the loader already provides are uploaded as they are.
+        MipmapMode mips{ MipmapMode::None };
     };
 
     using ResourceRequest = std::variant<ShaderLoadRequest, TextureLoadRequest>;
+    using ShaderHandle = ResourceHandle<Shader>;
+    using TextureHandle = ResourceHandle<Texture2D>;
+
+    /// \brief Textures per worker that may be between being read and being uploaded, bounds the pixels held in memory.
+    static constexpr std::size_t TEXTURES_IN_FLIGHT_PER_WORKER{ 4 };
+
+    /// \brief Limits how much upload work a single \ref ResourceContext::processUploadQueue call does.
+    ///
+    /// A limit of 0 means unlimited. A call always makes some progress, even if the very first step exceeds the budget.
+    ///
+    /// \author Felix Hommel
+    /// \date 3/18/2026
+    struct UploadBudget
+    {
+        std::size_t maxBytes{ 0 };
+        std::chrono::microseconds maxTime{ 0 };
+        std::size_t maxUploads{ 0 };
+    };
+
+    /// \brief What a single \ref ResourceContext::processUploadQueue call did.
+    ///
+    /// \author Felix Hommel
+    /// \date 3/18/2026
+    struct UploadStats
+    {
+        std::size_t uploads{ 0 };            ///< resources that finished uploading, failed ones included
+        std::size_t bytes{ 0 };              ///< pixel and shader source bytes handed to OpenGL
+        std::chrono::microseconds time{ 0 }; ///< time spent uploading
+        std::size_t deferred{ 0 };           ///< uploads left for a later call
+    };
+
+    /// \brief Throughput and latency of one stage of the texture pipeline, summed up since the context was created.
+    ///
+    /// \author Felix Hommel
+    /// \date 3/24/2026
+    struct StageStats
+    {
+        std::size_t items{ 0 };                 ///< resources that left the stage, failed ones included
+        std::size_t bytes{ 0 };                 ///< bytes read, decoded or uploaded by the stage
+        std::chrono::nanoseconds busy{ 0 };     ///< time spent working, summed over every thread running the stage
+        std::chrono::nanoseconds latency{ 0 };  ///< time from entering the stage until leaving it, summed over items
+
+        /// \returns bytes processed per second of busy time
+        [[nodiscard]] double throughput() const noexcept
+        {
+            return busy.count() == 0 ? 0.0 : static_cast<double>(bytes) / std::chrono::duration<double>(busy).count();
+        }
+        /// \returns average time an item spent waiting for and in the stage
+        [[nodiscard]] std::chrono::nanoseconds averageLatency() const noexcept
+        {
+            return items == 0 ? std::chrono::nanoseconds{ 0 } : latency / static_cast<std::int64_t>(items);
+        }
+    };
+
+    /// \brief Stats of every stage of the texture pipeline, the upload stage counts shaders too.
+    ///
+    /// \author Felix Hommel
+    /// \date 3/24/2026
+    struct PipelineStats
+    {
+        StageStats read;
+        StageStats decode;
+        StageStats upload;
+    };
+
+    /// \brief Outcome of the hot reloads since \ref ResourceContext::enableHotReload.
+    ///
+    /// \author Felix Hommel
+    /// \date 3/25/2026
+    struct HotReloadStats
+    {
+        std::size_t reloads{ 0 };                   ///< resources that were replaced by their changed version
+        std::size_t failures{ 0 };                  ///< reloads that failed, the previous version is kept for those
+        std::chrono::nanoseconds lastLatency{ 0 };  ///< time from noticing the change until the replacement
+        std::chrono::nanoseconds totalLatency{ 0 }; ///< summed up over every successful reload
+    };
+
+    /// \brief Refers to a requested resource, lets the requester drop the request while it is still queued.
+    ///
+    /// \author Felix Hommel
+    /// \date 3/17/2026
+    class RequestHandle
+    {
+    public:
+        RequestHandle() = default;
+
+        /// \brief Drop the request unless it is already uploaded, a load that is running still finishes but its
+        /// upload is skipped.
+        void cancel() noexcept { m_stop.request_stop(); }
+        [[nodiscard]] bool cancelled() const noexcept { return m_stop.get_token().stop_requested(); }
+
+    private:
+        friend class ResourceContext;
+
+        threading::stop_source_t m_stop;
+    };
 
     /// \brief Create a new \ref ResourceContext with a default \ref ResourceLoader for a loader.
     ///
+    /// Queries which compressed texture formats the driver supports, textures in any other format are decompressed on
+    /// the workers before they are uploaded.
+    ///
+    /// \note Has to be created on the thread the OpenGL context is current on, after it has been loaded.
+    ///
     /// \param loader (optional) custom resource loader implementing \ref IResourceLoader
     explicit ResourceContext(std::unique_ptr<IResourceLoader> loader = nullptr);
     ~ResourceContext();
@@ -67,24 +201,161 @@ public:
 
     /// \brief Request for a new resource to be uploaded.
     ///
+    /// The request is remembered to load the resource again if hot reloading notices a change of its files.
+    ///
     /// \param request providing details about the resource that is requested.
-    void requestResource(const ResourceRequest& request);
+    /// \param priority (optional) lane of the load, e.g. \ref JobPriority::Background for speculative preloads
+    ///
+    /// \returns handle to cancel the request
+    RequestHandle requestResource(const ResourceRequest& request, JobPriority priority = JobPriority::Normal);
+    /// \brief Request a shader and follow its loading through the returned future.
+    ///
+    /// \param request providing details about the shader that is requested
+    /// \param priority (optional) lane of the load
+    ///
+    /// \returns future that becomes ready once the shader is uploaded, or fails with the error of the load or upload
+    ResourceFuture<Shader> requestShader(const ShaderLoadRequest& request, JobPriority priority = JobPriority::Normal);
+    /// \brief Request a texture and follow its loading through the returned future.
+    ///
+    /// \param request providing details about the texture that is requested
+    /// \param priority (optional) lane of the load
+    ///
+    /// \returns future that becomes ready once the texture is uploaded, or fails with the error of the load or upload
+    ResourceFuture<Texture2D> requestTexture(
+        const TextureLoadRequest& request, JobPriority priority = JobPriority::Normal
+    );
     /// \brief Process pending GPU uploads.
     ///
     /// This method should only be called by the main OpenGL thread, to not interfere with OpenGL context boundaries.
     ///
     /// \param maxUploads (optional) specify a maximum number of queue elements to process (0 := unlimited)
-    void processUploadQueue(std::size_t maxUploads = 0);
+    void processUploadQueue(std::size_t maxUploads = 0)
+    {
+        processUploadQueue(UploadBudget{ .maxUploads = maxUploads });
+    }
+    /// \brief Process pending GPU uploads within \p budget.
+    ///
+    /// Textures are uploaded in chunks of rows through pixel buffer objects, a texture that doesn't fit into the budget
+    /// continues where it left off on the next call. It only becomes visible through \ref ResourceContext::getTexture
+    /// once all of its rows and mip levels are uploaded. This method should only be called by the main OpenGL thread.
+    /// With hot reloading enabled it also reloads the resources whose files changed since the last call.
+    ///
+    /// \param budget how much work to do at most
+    ///
+    /// \returns what was uploaded, also available through \ref ResourceContext::lastUploadStats
+    UploadStats processUploadQueue(const UploadBudget& budget);
 
+    /// \brief Block until every requested resource is loaded and uploaded, running the uploads meanwhile.
+    ///
+    /// The calling thread sleeps while there is no upload ready. Must only be called by the thread that created the
+    /// context.
     void waitForAllUploads();
+    /// \brief Like \ref ResourceContext::waitForAllUploads, but returns after \p timeout at the latest.
+    ///
+    /// Meant for loading screens: wait for the rest of the frame, render, repeat until it returns *true*.
+    ///
+    /// \param timeout how long to wait and upload at most
+    ///
+    /// \returns *true* if every requested resource is uploaded
+    bool waitFor(std::chrono::nanoseconds timeout);
 
-    [[nodiscard]] std::shared_ptr<Shader> getShader(const std::string& key) const { return m_shaderCache.get(key); }
-    [[nodiscard]] std::shared_ptr<Texture2D> getTexture(const std::string& key) const
+    /// \brief Start watching the files of every requested resource and reload the resources when they change.
+    ///
+    /// Meant for iterating on shaders and textures while the game is running. A reload runs the load of the resource
+    /// on the workers again and swaps the new version into the existing resource once it is uploaded, a reload that
+    /// fails keeps the previous version.
+    ///
+    /// \param debounce (optional) how long a file has to stay unchanged before the resource is reloaded
+    void enableHotReload(std::chrono::milliseconds debounce = FileWatcher::DEFAULT_DEBOUNCE);
+
+    /// \brief Limit the video memory the cached textures take up, 0 means unlimited.
+    ///
+    /// Once the textures take up more, the least recently used ones that nobody but the context holds are evicted at
+    /// the start of \ref ResourceContext::processUploadQueue. Textures uploaded by a call aren't evicted before the
+    /// next call, so the caller gets a chance to take them. An evicted texture has to be requested again.
+    ///
+    /// \param bytes estimated video memory the textures may take up, see \ref Texture2D::gpuSize
+    void setTextureMemoryBudget(std::size_t bytes) { m_textureCache.setBudget(bytes); }
+    /// \brief Estimated video memory the cached textures take up, in bytes.
+    [[nodiscard]] std::size_t textureMemory() const noexcept { return m_textureCache.usedSize(); }
+
+    /// \brief Access an uploaded shader.
+    ///
+    /// \throws \ref ResourceUnavailableException if the shader is pending, failed or was never requested, per frame
+    /// lookups should use \ref ResourceContext::findShader or the future of the request instead
+    [[nodiscard]] std::shared_ptr<Shader> getShader(std::string_view key) const { return m_shaderCache.get(key); }
+    /// \brief Access an uploaded texture.
+    ///
+    /// \throws \ref ResourceUnavailableException if the texture is pending, failed or was never requested, per frame
+    /// lookups should use \ref ResourceContext::findTexture or the future of the request instead
+    [[nodiscard]] std::shared_ptr<Texture2D> getTexture(std::string_view key) const { return m_textureCache.get(key); }
+    /// \brief Access a shader by the precomputed hash of \p key, e.g. `getShader("sprite"_key)`.
+    [[nodiscard]] std::shared_ptr<Shader> getShader(const ResourceKey& key) const { return m_shaderCache.get(key); }
+    /// \brief Access a texture by the precomputed hash of \p key, e.g. `getTexture("ship"_key)`.
+    [[nodiscard]] std::shared_ptr<Texture2D> getTexture(const ResourceKey& key) const
     {
         return m_textureCache.get(key);
     }
-    [[nodiscard]] bool hasPendingUploads() const { return !m_uploadQueue.empty(); }
-    [[nodiscard]] std::size_t pendingUploadTasks() const { return m_uploadQueue.size(); }
+    /// \returns the shader, *nullptr* if it isn't uploaded
+    [[nodiscard]] std::shared_ptr<Shader> findShader(std::string_view key) const
+    {
+        return m_shaderCache.get(m_shaderCache.handle(key));
+    }
+    /// \returns the shader, *nullptr* if it isn't uploaded
+    [[nodiscard]] std::shared_ptr<Shader> findShader(const ResourceKey& key) const
+    {
+        return m_shaderCache.get(m_shaderCache.handle(key));
+    }
+    /// \returns the texture, *nullptr* if it isn't uploaded
+    [[nodiscard]] std::shared_ptr<Texture2D> findTexture(std::string_view key) const
+    {
+        return m_textureCache.get(m_textureCache.handle(key));
+    }
+    /// \returns the texture, *nullptr* if it isn't uploaded
+    [[nodiscard]] std::shared_ptr<Texture2D> findTexture(const ResourceKey& key) const
+    {
+        return m_textureCache.get(m_textureCache.handle(key));
+    }
+    /// \returns the texture, \ref ResourceContext::placeholderTexture while it is pending or if it failed
+    [[nodiscard]] std::shared_ptr<Texture2D> textureOrPlaceholder(const ResourceKey& key) const
+    {
+        auto texture{ findTexture(key) };
+
+        return texture != nullptr ? texture : m_placeholder;
+    }
+    /// \brief 1x1 white texture to draw instead of pending or failed textures, like the sprite renderer's fallback.
+    [[nodiscard]] const std::shared_ptr<Texture2D>& placeholderTexture() const noexcept { return m_placeholder; }
+    /// \brief Look up the handle of an uploaded shader once, to access it without looking up its name every frame.
+    ///
+    /// \returns handle to the shader, one that doesn't resolve if it isn't uploaded
+    [[nodiscard]] ShaderHandle shaderHandle(std::string_view key) const { return m_shaderCache.handle(key); }
+    [[nodiscard]] ShaderHandle shaderHandle(const ResourceKey& key) const { return m_shaderCache.handle(key); }
+    /// \brief Look up the handle of an uploaded texture once, to access it without looking up its name every frame.
+    ///
+    /// \returns handle to the texture, one that doesn't resolve if it isn't uploaded
+    [[nodiscard]] TextureHandle textureHandle(std::string_view key) const { return m_textureCache.handle(key); }
+    [[nodiscard]] TextureHandle textureHandle(const ResourceKey& key) const { return m_textureCache.handle(key); }
+    /// \returns the shader, *nullptr* if \p handle doesn't refer to an uploaded shader (anymore)
+    [[nodiscard]] Shader* resolve(ShaderHandle handle) const noexcept { return m_shaderCache.resolve(handle); }
+    /// \returns the texture, *nullptr* if \p handle doesn't refer to an uploaded texture (anymore)
+    [[nodiscard]] Texture2D* resolve(TextureHandle handle) const noexcept { return m_textureCache.resolve(handle); }
+    /// \brief Get the \ref Sampler for \p state, every caller asking for the same state shares one sampler.
+    [[nodiscard]] std::shared_ptr<Sampler> getSampler(const SamplerState& state) { return m_samplers.get(state); }
+    [[nodiscard]] bool hasPendingUploads() const { return pendingUploadTasks() > 0; }
+    [[nodiscard]] std::size_t pendingUploadTasks() const
+    {
+        return m_threadPool->pendingMainThreadJobs() + m_uploads.size();
+    }
+    /// \brief Return the stats of the last \ref ResourceContext::processUploadQueue call.
+    [[nodiscard]] const UploadStats& lastUploadStats() const noexcept { return m_lastUploadStats; }
+    /// \brief Return a snapshot of the stats of the texture pipeline, may be called from any thread.
+    [[nodiscard]] PipelineStats pipelineStats() const noexcept
+    {
+        return { .read = m_readStats.snapshot(),
+                 .decode = m_decodeStats.snapshot(),
+                 .upload = m_uploadStats.snapshot() };
+    }
+    [[nodiscard]] const HotReloadStats& hotReloadStats() const noexcept { return m_hotReloadStats; }
     [[nodiscard]] std::size_t totalResources() const noexcept { return m_shaderCache.size() + m_textureCache.size(); }
 
     void clear();
@@ -98,28 +369,174 @@ private:
     {
         std::string key;
         LoadResult result;
+        threading::stop_token_t stopToken;
+        /// \brief Texture that is filled chunk by chunk, *nullptr* until the first chunk.
+        std::shared_ptr<Texture2D> texture;
+        int uploadedRows{ 0 };
+        MipmapMode mips{ MipmapMode::None };
+        /// \brief Whether the texture takes up one of the slots of the pipeline until it leaves the upload queue.
+        bool inFlight{ false };
+        std::chrono::steady_clock::time_point queuedAt;
+        /// \brief When the change that caused this hot reload was noticed, empty for the first load.
+        std::optional<std::chrono::steady_clock::time_point> changedAt;
+        /// \brief Completed once the resource is uploaded or failed, only the one matching the resource is valid.
+        ResourceFuture<Shader> shaderFuture;
+        ResourceFuture<Texture2D> textureFuture;
+    };
+
+    /// \brief A texture request waiting for the read stage.
+    ///
+    /// \author Felix Hommel
+    /// \date 3/24/2026
+    struct PendingRead
+    {
+        std::shared_ptr<UploadTask> task;
+        std::filesystem::path filepath;
+        JobOptions options;
+        std::chrono::steady_clock::time_point queuedAt;
+    };
+
+    /// \brief Counters behind a \ref StageStats, updated by whichever thread runs the stage.
+    ///
+    /// \author Felix Hommel
+    /// \date 3/24/2026
+    struct StageCounters
+    {
+        std::atomic<std::size_t> items{ 0 };
+        std::atomic<std::size_t> bytes{ 0 };
+        std::atomic<std::int64_t> busy{ 0 };
+        std::atomic<std::int64_t> latency{ 0 };
+
+        void record(
+            std::size_t count, std::size_t size, std::chrono::nanoseconds busyTime, std::chrono::nanoseconds latencyTime
+        ) noexcept;
+        [[nodiscard]] StageStats snapshot() const noexcept;
     };
 
-    static constexpr auto THREAD_POOL_SIZE_SCALAR{ 4 };
+    /// \brief Files the read stage reads at once at most.
+    static constexpr std::size_t READ_BATCH_SIZE{ 8 };
 
-    std::unique_ptr<ThreadPool> m_threadPool{ std::make_unique<ThreadPool>(
-        static_cast<std::size_t>(std::max(std::thread::hardware_concurrency() / THREAD_POOL_SIZE_SCALAR, 1u))
-    ) };
+    /// \brief Decoding doesn't wait for the disk, so the workers take every core but the one of the main thread.
+    static std::size_t workerCount()
+    {
+        return static_cast<std::size_t>(std::max(std::thread::hardware_concurrency(), 2u) - 1);
+    }
+
+    std::unique_ptr<ThreadPool> m_threadPool{ std::make_unique<ThreadPool>(workerCount()) };
     std::unique_ptr<IResourceLoader> m_loader;
-    BlockingQueue<UploadTask> m_uploadQueue;
-    std::atomic<int> m_inFlight{ 0 };
-    std::condition_variable m_done;
-    std::mutex m_doneMutex;
+    /// \brief Compressed texture formats the driver can sample from, indexed by \ref TextureCompression.
+    std::bitset<TEXTURE_COMPRESSION_COUNT> m_supportedCompressions;
+    /// \brief Load tasks on the workers, each followed by a task on the main thread that queues the upload.
+    TaskGroup m_loads{ *m_threadPool };
+    /// \brief Uploads in the order their loads finished, only touched by the main thread.
+    std::deque<UploadTask> m_uploads;
+    TextureUploader m_uploader;
+    UploadStats m_lastUploadStats;
+
+    /// \brief Guards the queued reads, the read slots and whether the read stage is running.
+    std::mutex m_readMutex;
+    /// \brief Texture requests waiting to be read, one queue per \ref JobPriority.
+    std::array<std::deque<PendingRead>, JOB_PRIORITY_COUNT> m_reads;
+    std::size_t m_freeReadSlots{ workerCount() * TEXTURES_IN_FLIGHT_PER_WORKER };
+    bool m_readerActive{ false };
+
+    StageCounters m_readStats;
+    StageCounters m_decodeStats;
+    StageCounters m_uploadStats;
+
+    /// \brief Guards the remembered requests and the watcher, requests may come from any thread.
+    std::mutex m_requestMutex;
+    /// \brief Last request of every resource, by name.
+    std::map<std::string, ResourceRequest> m_requests;
+    std::unique_ptr<FileWatcher> m_watcher;
+    /// \brief Running reload of every resource, cancelled if its files change again. Only touched by the main thread.
+    std::map<std::string, RequestHandle> m_reloads;
+    HotReloadStats m_hotReloadStats;
 
     ResourceCache<Shader> m_shaderCache;
     ResourceCache<Texture2D> m_textureCache;
+    SamplerCache m_samplers;
+    /// \brief Textures stored by the last \ref ResourceContext::processUploadQueue call, held until the next one.
+    std::vector<std::shared_ptr<Texture2D>> m_storedTextures;
+    std::shared_ptr<Texture2D> m_placeholder;
+    /// \brief Callbacks of cancelled requests, run at the start of \ref ResourceContext::processUploadQueue.
+    std::shared_ptr<details::ResourceCallbackQueue> m_callbacks{ std::make_shared<details::ResourceCallbackQueue>() };
+
+    using ChangeTime = std::optional<std::chrono::steady_clock::time_point>;
 
-    void enqueueLoadTask(const ShaderLoadRequest& request);
-    void enqueueLoadTask(const TextureLoadRequest& request);
+    void rememberRequest(const ResourceRequest& request);
+    RequestHandle enqueueRequest(const ResourceRequest& request, JobPriority priority, ChangeTime changedAt);
+    ResourceFuture<Shader> enqueueRequest(const ShaderLoadRequest& request, JobPriority priority, ChangeTime changedAt);
+    ResourceFuture<Texture2D> enqueueRequest(
+        const TextureLoadRequest& request, JobPriority priority, ChangeTime changedAt
+    );
+    void enqueueLoadTask(
+        const ShaderLoadRequest& request,
+        const JobOptions& options,
+        ChangeTime changedAt,
+        const ResourceFuture<Shader>& future
+    );
+    void enqueueLoadTask(
+        const TextureLoadRequest& request,
+        const JobOptions& options,
+        ChangeTime changedAt,
+        const ResourceFuture<Texture2D>& future
+    );
+    void enqueueUploadTask(const TaskHandle& load, const std::shared_ptr<UploadTask>& task, const JobOptions& options);
+    void enqueueDecodeTask(PendingRead read, std::expected<EncodedTexture, ResourceError> file);
 
-    void processUploadTask(const UploadTask& task);
-    void uploadToGPU(const std::string& key, const ShaderSourceData& data);
-    void uploadToGPU(const std::string& key, const TextureRawData& data);
+    void startReader();
+    void readTextures();
+    void takeReads(std::vector<PendingRead>& batch);
+    void releaseReadSlots(std::size_t count);
+
+    void watchFiles(const ResourceRequest& request);
+    void reloadChangedFiles();
+    void finishReload(const UploadTask& task, bool succeeded);
+
+    bool waitUntil(std::chrono::steady_clock::time_point deadline);
+    [[nodiscard]] bool uploadsFinished() const { return m_uploads.empty() && m_loads.finished(); }
+
+    bool processUploadTask(UploadTask& task, std::size_t maxBytes, UploadStats& stats);
+    void failUpload(const UploadTask& task, const ResourceError& error);
+    [[nodiscard]] LoadResult decompressUnsupported(LoadResult result, const std::filesystem::path& filepath) const;
+    [[nodiscard]] static LoadResult buildMips(LoadResult result);
+    void uploadToGPU(const UploadTask& task, const ShaderSourceData& data);
+    bool uploadToGPU(UploadTask& task, const TextureRawData& data, std::size_t maxBytes, UploadStats& stats);
+    void finishTexture(UploadTask& task, const TextureRawData& data);
+
+    /// \brief Make an uploaded resource accessible, replacing the previous version in place for hot reloads.
+    ///
+    /// Completes the future of the request.
+    ///
+    /// \param size memory the resource takes up, counted against the budget of \p cache
+    template<typename T>
+    void storeResource(ResourceCache<T>& cache, const UploadTask& task, std::shared_ptr<T> resource, std::size_t size)
+    {
+        const auto handle{ task.changedAt ? cache.replace(task.key, std::move(resource), size)
+                                          : cache.store(task.key, std::move(resource), size) };
+
+        if constexpr(std::is_same_v<T, Shader>)
+            task.shaderFuture.resolve(cache.get(handle));
+        else
+        {
+            m_storedTextures.push_back(cache.get(handle));
+            task.textureFuture.resolve(m_storedTextures.back());
+        }
+
+        if(task.changedAt)
+            finishReload(task, true);
+    }
+
+    /// \brief Handle to cancel the request \p future belongs to.
+    template<typename T>
+    [[nodiscard]] static RequestHandle handleOf(const ResourceFuture<T>& future)
+    {
+        RequestHandle handle;
+        handle.m_stop = future.m_state->stop;
+
+        return handle;
+    }
 };
 
 } // namespace sfa
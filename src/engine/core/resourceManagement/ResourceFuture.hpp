@@ -0,0 +1,256 @@
+#ifndef SFA_SRC_ENGINE_CORE_RESOURCE_MANAGEMENT_RESOURCE_FUTURE_HPP
+#define SFA_SRC_ENGINE_CORE_RESOURCE_MANAGEMENT_RESOURCE_FUTURE_HPP
+
+#include "core/resourceManagement/ResourceError.hpp"
+#include "utility/details/Threading.hpp"
+
+#include <spdlog/spdlog.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace sfa
+{
+
+class ResourceContext;
+
+namespace details
+{
+
+/// \brief Callbacks of resource requests that completed outside of \ref ResourceContext::processUploadQueue, the
+/// context runs them on the main thread during its next call.
+///
+/// \author Felix Hommel
+/// \date 3/28/2026
+class ResourceCallbackQueue
+{
+public:
+    void post(std::function<void()> callback)
+    {
+        std::lock_guard lock(m_mutex);
+
+        m_callbacks.push_back(std::move(callback));
+    }
+
+    /// \brief Run every queued callback, callbacks queued meanwhile wait for the next call.
+    ///
+    /// \returns amount of callbacks that ran
+    std::size_t run()
+    {
+        std::vector<std::function<void()>> callbacks;
+        {
+            std::lock_guard lock(m_mutex);
+            callbacks.swap(m_callbacks);
+        }
+
+        for(const auto& callback : callbacks)
+            callback();
+
+        return callbacks.size();
+    }
+
+private:
+    std::mutex m_mutex;
+    std::vector<std::function<void()>> m_callbacks;
+};
+
+} // namespace details
+
+/// \brief Where a requested resource is at.
+enum class ResourceStatus : std::uint8_t
+{
+    Pending, ///< still loading or uploading
+    Ready,   ///< uploaded and accessible
+    Failed   ///< failed to load or upload, or the request was cancelled
+};
+
+/// \brief Refers to the outcome of a resource request, handed out by \ref ResourceContext::requestShader and
+/// \ref ResourceContext::requestTexture.
+///
+/// The status can be queried every frame without throwing, \ref ResourceFuture::getOr substitutes a placeholder while
+/// the resource is pending or after it failed. Callbacks registered with \ref ResourceFuture::then run once the
+/// request completes, on the main thread during \ref ResourceContext::processUploadQueue. Copies refer to the same
+/// request.
+///
+/// The future doesn't keep the resource alive, it can still be evicted from the cache of the context.
+///
+/// \author Felix Hommel
+/// \date 3/28/2026
+template<typename T>
+class ResourceFuture
+{
+public:
+    using Callback = std::function<void(const ResourceFuture&)>;
+
+    /// \brief Create a future that doesn't refer to any request.
+    ResourceFuture() = default;
+
+    /// \brief Whether the future refers to a request at all.
+    [[nodiscard]] bool valid() const noexcept { return m_state != nullptr; }
+    /// \returns where the request is at, \ref ResourceStatus::Failed for a future that doesn't refer to any request
+    [[nodiscard]] ResourceStatus status() const noexcept
+    {
+        return m_state != nullptr ? m_state->status.load(std::memory_order_acquire) : ResourceStatus::Failed;
+    }
+    [[nodiscard]] bool pending() const noexcept { return status() == ResourceStatus::Pending; }
+    [[nodiscard]] bool ready() const noexcept { return status() == ResourceStatus::Ready; }
+    [[nodiscard]] bool failed() const noexcept { return status() == ResourceStatus::Failed; }
+
+    /// \returns the resource once it is ready, *nullptr* otherwise or once it was evicted
+    [[nodiscard]] std::shared_ptr<T> get() const noexcept { return ready() ? m_state->resource.lock() : nullptr; }
+    /// \returns the resource once it is ready, \p placeholder while it is pending, if it failed or once it was evicted
+    [[nodiscard]] std::shared_ptr<T> getOr(std::shared_ptr<T> placeholder) const noexcept
+    {
+        auto resource{ get() };
+
+        return resource != nullptr ? resource : std::move(placeholder);
+    }
+    /// \returns why the request failed, *nullptr* unless it failed
+    [[nodiscard]] const ResourceError* error() const noexcept
+    {
+        return failed() && m_state != nullptr && m_state->error ? &*m_state->error : nullptr;
+    }
+
+    /// \brief Run \p callback once the request completes, right away if it already has.
+    ///
+    /// Callbacks of pending requests run on the main thread during \ref ResourceContext::processUploadQueue, in the
+    /// order they were registered. An exception thrown by a callback is logged and doesn't reach the context.
+    void then(Callback callback) const
+    {
+        if(m_state == nullptr)
+            return;
+
+        {
+            std::lock_guard lock(m_state->mutex);
+            if(m_state->status.load(std::memory_order_relaxed) == ResourceStatus::Pending)
+            {
+                m_state->callbacks.push_back(std::move(callback));
+                return;
+            }
+        }
+
+        invoke(callback);
+    }
+
+    /// \brief Drop the request unless it already completed.
+    ///
+    /// The future fails right away, its callbacks still run during the next \ref ResourceContext::processUploadQueue.
+    void cancel() const
+    {
+        if(m_state == nullptr)
+            return;
+
+        m_state->stop.request_stop();
+        settle(ResourceStatus::Failed, nullptr, cancelled(), true);
+    }
+
+private:
+    friend class ResourceContext;
+
+    /// \brief State every copy of a future shares.
+    struct State
+    {
+        std::atomic<ResourceStatus> status{ ResourceStatus::Pending };
+        /// \brief Only written before the status leaves \ref ResourceStatus::Pending.
+        std::weak_ptr<T> resource;
+        std::optional<ResourceError> error;
+        threading::stop_source_t stop;
+        /// \brief Where callbacks of requests completing outside of the upload queue go, expired once the context is
+        /// gone.
+        std::weak_ptr<details::ResourceCallbackQueue> queue;
+        /// \brief Guards the callbacks and the transition out of \ref ResourceStatus::Pending.
+        std::mutex mutex;
+        std::vector<Callback> callbacks;
+    };
+
+    std::shared_ptr<State> m_state;
+
+    /// \brief Create the future of a new request.
+    ///
+    /// \param queue where the callbacks of a cancelled request go
+    [[nodiscard]] static ResourceFuture create(std::weak_ptr<details::ResourceCallbackQueue> queue)
+    {
+        ResourceFuture future;
+        future.m_state = std::make_shared<State>();
+        future.m_state->queue = std::move(queue);
+
+        return future;
+    }
+
+    [[nodiscard]] static ResourceError cancelled()
+    {
+        return { .type = ResourceError::Type::Unknown, .message = "Request was cancelled", .filepath = {} };
+    }
+
+    [[nodiscard]] threading::stop_token_t stopToken() const noexcept
+    {
+        return m_state != nullptr ? m_state->stop.get_token() : threading::stop_token_t{};
+    }
+
+    void resolve(const std::shared_ptr<T>& resource) const { settle(ResourceStatus::Ready, resource, {}, false); }
+    void reject(ResourceError error) const { settle(ResourceStatus::Failed, nullptr, std::move(error), false); }
+
+    /// \brief Complete the request and run its callbacks, only the first completion counts.
+    ///
+    /// \param deferred queue the callbacks for the main thread instead of running them right away
+    void settle(
+        ResourceStatus status, const std::shared_ptr<T>& resource, std::optional<ResourceError> error, bool deferred
+    ) const
+    {
+        if(m_state == nullptr)
+            return;
+
+        std::vector<Callback> callbacks;
+        {
+            std::lock_guard lock(m_state->mutex);
+            if(m_state->status.load(std::memory_order_relaxed) != ResourceStatus::Pending)
+                return;
+
+            m_state->resource = resource;
+            m_state->error = std::move(error);
+            m_state->status.store(status, std::memory_order_release);
+            callbacks.swap(m_state->callbacks);
+        }
+
+        if(!deferred)
+        {
+            for(const auto& callback : callbacks)
+                invoke(callback);
+
+            return;
+        }
+
+        // NOTE: Without a context there is no upload queue left to run the callbacks in
+        if(auto queue{ m_state->queue.lock() }; queue != nullptr && !callbacks.empty())
+        {
+            queue->post([future = *this, callbacks = std::move(callbacks)]() {
+                for(const auto& callback : callbacks)
+                    future.invoke(callback);
+            });
+        }
+    }
+
+    void invoke(const Callback& callback) const
+    {
+        try
+        {
+            callback(*this);
+        }
+        catch(const std::exception& e)
+        {
+            spdlog::error("Resource callback threw: {}", e.what());
+        }
+    }
+};
+
+} // namespace sfa
+
+#endif // !SFA_SRC_ENGINE_CORE_RESOURCE_MANAGEMENT_RESOURCE_FUTURE_HPP
@@ -0,0 +1,45 @@
+#ifndef SFA_SRC_ENGINE_CORE_RESOURCE_MANAGEMENT_RESOURCE_HANDLE_HPP
+#define SFA_SRC_ENGINE_CORE_RESOURCE_MANAGEMENT_RESOURCE_HANDLE_HPP
+
+#include <cstdint>
+
+namespace sfa
+{
+
+/// \brief Refers to a resource stored in a \ref ResourceCache of \p T.
+///
+/// A handle is a 32 bit value made of the index of the slot the resource lives in and the generation of that slot.
+/// The generation changes whenever the resource is evicted, so a handle to an evicted resource resolves to nothing
+/// instead of to whichever resource takes over the slot next. The default constructed handle never resolves.
+///
+/// \author Felix Hommel
+/// \date 3/26/2026
+template<typename T>
+class ResourceHandle
+{
+public:
+    static constexpr std::uint32_t INDEX_BITS{ 20 };
+    static constexpr std::uint32_t MAX_INDEX{ (1U << INDEX_BITS) - 1 };
+    static constexpr std::uint32_t MAX_GENERATION{ (1U << (32 - INDEX_BITS)) - 1 };
+
+    constexpr ResourceHandle() noexcept = default;
+    constexpr ResourceHandle(std::uint32_t index, std::uint32_t generation) noexcept
+        : m_value{ (generation << INDEX_BITS) | (index & MAX_INDEX) }
+    {
+    }
+
+    [[nodiscard]] constexpr std::uint32_t index() const noexcept { return m_value & MAX_INDEX; }
+    [[nodiscard]] constexpr std::uint32_t generation() const noexcept { return m_value >> INDEX_BITS; }
+    [[nodiscard]] constexpr std::uint32_t value() const noexcept { return m_value; }
+    /// \brief Whether the handle was handed out by a cache at all, it may still be stale.
+    [[nodiscard]] constexpr bool valid() const noexcept { return generation() != 0; }
+
+    constexpr bool operator==(const ResourceHandle&) const noexcept = default;
+
+private:
+    std::uint32_t m_value{ 0 };
+};
+
+} // namespace sfa
+
+#endif // !SFA_SRC_ENGINE_CORE_RESOURCE_MANAGEMENT_RESOURCE_HANDLE_HPP
@@ -0,0 +1,40 @@
+#include "ResourceKey.hpp"
+
+#include <functional>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+
+namespace sfa
+{
+
+namespace
+{
+
+/// \brief Transparent hash, so the interned names can be looked up without creating a string first.
+struct NameHash
+{
+    using is_transparent = void;
+
+    std::size_t operator()(std::string_view name) const noexcept { return std::hash<std::string_view>{}(name); }
+};
+
+} // namespace
+
+ResourceKey ResourceKey::intern(std::string_view name)
+{
+    // NOTE: The nodes of the set never move, so the interned names stay where they are while the set grows
+    static std::mutex mutex;
+    static std::unordered_set<std::string, NameHash, std::equal_to<>> names;
+
+    std::lock_guard lock(mutex);
+
+    auto it{ names.find(name) };
+    if(it == names.end())
+        it = names.emplace(name).first;
+
+    return ResourceKey{ *it };
+}
+
+} // namespace sfa
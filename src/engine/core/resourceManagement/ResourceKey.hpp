@@ -0,0 +1,69 @@
+#ifndef SFA_SRC_ENGINE_CORE_RESOURCE_MANAGEMENT_RESOURCE_KEY_HPP
+#define SFA_SRC_ENGINE_CORE_RESOURCE_MANAGEMENT_RESOURCE_KEY_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace sfa
+{
+
+/// \brief Name of a resource together with its precomputed hash.
+///
+/// Looking a resource up by its key only compares the hash, instead of hashing and comparing the name on every access.
+/// Keys of literals are hashed at compile time, either through the constructor in a constant expression or through the
+/// `_key` literal. A key only views its name, names that don't outlive the key have to be interned with
+/// \ref ResourceKey::intern.
+///
+/// \author Felix Hommel
+/// \date 3/27/2026
+class ResourceKey
+{
+public:
+    constexpr ResourceKey() noexcept = default;
+    constexpr explicit ResourceKey(std::string_view name) noexcept : m_name(name), m_hash(hash(name)) {}
+
+    /// \brief Create a key whose name lives as long as the program, so it may be created from a temporary name.
+    [[nodiscard]] static ResourceKey intern(std::string_view name);
+
+    /// \brief 64 bit FNV-1a hash of \p name, the hash every key and resource cache uses.
+    [[nodiscard]] static constexpr std::uint64_t hash(std::string_view name) noexcept
+    {
+        constexpr std::uint64_t OFFSET_BASIS{ 14695981039346656037ULL };
+        constexpr std::uint64_t PRIME{ 1099511628211ULL };
+
+        auto value{ OFFSET_BASIS };
+        for(const char c : name)
+        {
+            value ^= static_cast<std::uint8_t>(c);
+            value *= PRIME;
+        }
+
+        return value;
+    }
+
+    [[nodiscard]] constexpr std::string_view name() const noexcept { return m_name; }
+    [[nodiscard]] constexpr std::uint64_t hash() const noexcept { return m_hash; }
+
+    /// \brief Keys are equal if their hashes are, resource caches make sure two names never share a hash.
+    constexpr bool operator==(const ResourceKey& other) const noexcept { return m_hash == other.m_hash; }
+
+private:
+    std::string_view m_name;
+    std::uint64_t m_hash{ hash({}) };
+};
+
+namespace literals
+{
+
+/// \brief Create a \ref ResourceKey that is hashed at compile time, e.g. `"ship"_key`.
+consteval ResourceKey operator""_key(const char* name, std::size_t length)
+{
+    return ResourceKey{ std::string_view{ name, length } };
+}
+
+} // namespace literals
+
+} // namespace sfa
+
+#endif // !SFA_SRC_ENGINE_CORE_RESOURCE_MANAGEMENT_RESOURCE_KEY_HPP
@@ -1,17 +1,20 @@
 #include "ResourceLoader.hpp"
 
+#include "core/PixelBuffer.hpp"
+#include "core/resourceManagement/FileReader.hpp"
 #include "core/resourceManagement/IntermediateResourceData.hpp"
+#include "core/resourceManagement/Ktx2.hpp"
 #include "core/resourceManagement/ResourceError.hpp"
 
 #include <fmt/format.h>
 #include <stb_image.h>
 
 #include <cstddef>
-#include <cstring>
 #include <expected>
 #include <filesystem>
 #include <fstream>
 #include <limits>
+#include <span>
 #include <sstream>
 #include <utility>
 #include <vector>
@@ -48,16 +51,59 @@ LoadResult ResourceLoader::loadShader(
 
 LoadResult ResourceLoader::loadTexture(const std::filesystem::path& filepath)
 {
-    if(!std::filesystem::exists(filepath))
-        return std::unexpected(ResourceError::fileNotFound(filepath));
+    auto files{ readTextures(std::span{ &filepath, 1 }) };
+    if(!files.front())
+        return std::unexpected(std::move(files.front().error()));
+
+    return decodeTexture(std::move(*files.front()));
+}
+
+std::vector<std::expected<EncodedTexture, ResourceError>> ResourceLoader::readTextures(
+    std::span<const std::filesystem::path> filepaths
+)
+{
+    auto contents{ readFileBatch(filepaths) };
+
+    std::vector<std::expected<EncodedTexture, ResourceError>> files;
+    files.reserve(contents.size());
+    for(std::size_t i{ 0 }; i < contents.size(); ++i)
+    {
+        if(contents[i])
+            files.emplace_back(EncodedTexture{ .filepath = filepaths[i], .bytes = std::move(*contents[i]) });
+        else
+            files.emplace_back(std::unexpected(std::move(contents[i].error())));
+    }
+
+    return files;
+}
+
+LoadResult ResourceLoader::decodeTexture(EncodedTexture file)
+{
+    const auto& filepath{ file.filepath };
+
+    if(filepath.extension() == ".ktx2")
+    {
+        auto texture{ parseKtx2(file.bytes.bytes(), filepath) };
+        if(!texture)
+            return std::unexpected(texture.error());
+
+        return ResourceData{ std::move(*texture) };
+    }
+
+    if(file.bytes.empty() || file.bytes.size() > static_cast<std::size_t>(std::numeric_limits<int>::max()))
+        return std::unexpected(ResourceError::invalidFormat(filepath, "File is empty or too large to be decoded"));
 
     int width{};
     int height{};
     int nrChannels{};
-    // NOTE: Need to access filepath as u8string to ensure windows file paths are accessed in the right way
-    stbi_uc* imageData{
-        stbi_load(reinterpret_cast<const char*>(filepath.u8string().c_str()), &width, &height, &nrChannels, 0)
-    };
+    stbi_uc* imageData{ stbi_load_from_memory(
+        reinterpret_cast<const stbi_uc*>(file.bytes.data()),
+        static_cast<int>(file.bytes.size()),
+        &width,
+        &height,
+        &nrChannels,
+        0
+    ) };
 
     if(imageData == nullptr)
         return std::unexpected(
@@ -90,11 +136,8 @@ LoadResult ResourceLoader::loadTexture(const std::filesystem::path& filepath)
         );
     }
 
-    const auto size{ w * h * c };
-
-    std::vector<std::byte> pixels(size);
-    std::memcpy(pixels.data(), imageData, size);
-    stbi_image_free(imageData);
+    // NOTE: Hand the decoded memory over as is, it is freed by stb_image once the texture is uploaded
+    PixelBuffer pixels{ imageData, w * h * c, &stbi_image_free };
 
     TextureRawData textureData{ .width = width, .height = height, .channels = nrChannels, .pixels = std::move(pixels) };
 
@@ -7,13 +7,18 @@
 
 #include <expected>
 #include <filesystem>
+#include <span>
 #include <string>
+#include <vector>
 
 namespace sfa
 {
 
 /// \brief Load resource data from the disk.
 ///
+/// PNG and JPEG textures are decoded with stb_image, KTX2 containers are read as they are, see \ref parseKtx2. Texture
+/// files are read in batches through \ref readFileBatch and decoded from memory afterwards.
+///
 /// \author Felix Hommel
 /// \date 2/14/2026
 class ResourceLoader : public IResourceLoader
@@ -25,6 +30,10 @@ public:
         const std::filesystem::path& geom = std::filesystem::path("")
     ) override;
     LoadResult loadTexture(const std::filesystem::path& filepath) override;
+    std::vector<std::expected<EncodedTexture, ResourceError>> readTextures(
+        std::span<const std::filesystem::path> filepaths
+    ) override;
+    LoadResult decodeTexture(EncodedTexture file) override;
 
 private:
     static std::expected<std::string, ResourceError> readFile(const std::filesystem::path& filepath);
@@ -0,0 +1,62 @@
+#ifndef SFA_SRC_ENGINE_ECS_COLLISION_LAYERS_HPP
+#define SFA_SRC_ENGINE_ECS_COLLISION_LAYERS_HPP
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+
+/// \brief Define the bitfields used to filter which colliders are allowed to collide with each other.
+///
+/// Every collider belongs to exactly one layer (its category) and carries a mask of the layers it wants to collide
+/// with. Two colliders only collide if each one's category is contained in the other's mask.
+///
+/// \author Felix Hommel
+/// \date 3/7/2026
+namespace sfa
+{
+
+using CollisionMask = std::uint32_t; ///< Define what represents a collision category or mask
+
+constexpr std::size_t MAX_COLLISION_LAYERS{ 32 };                  ///< One layer per bit of \ref CollisionMask
+constexpr CollisionMask COLLISION_LAYER_DEFAULT{ 1u };             ///< Layer colliders are put into by default
+constexpr CollisionMask COLLISION_MASK_ALL{ ~CollisionMask{ 0 } }; ///< Mask that accepts every layer
+constexpr CollisionMask COLLISION_MASK_NONE{ CollisionMask{ 0 } }; ///< Mask that rejects every layer
+
+/// \brief Get the category bit of a collision layer.
+///
+/// \param index the index of the layer in [0, \ref MAX_COLLISION_LAYERS)
+///
+/// \returns \ref CollisionMask with only the bit of layer \p index set
+constexpr CollisionMask collisionLayer(std::size_t index) noexcept
+{
+    return CollisionMask{ 1u } << index;
+}
+
+/// \brief Get the index of a collision layer from its category bit.
+///
+/// \param category \ref CollisionMask with exactly one bit set
+///
+/// \returns the index of the layer in [0, \ref MAX_COLLISION_LAYERS)
+constexpr std::size_t collisionLayerIndex(CollisionMask category) noexcept
+{
+    return static_cast<std::size_t>(std::countr_zero(category));
+}
+
+/// \brief Check if two colliders are allowed to collide based on their filtering data.
+///
+/// \param categoryA category of the first collider
+/// \param maskA mask of the first collider
+/// \param categoryB category of the second collider
+/// \param maskB mask of the second collider
+///
+/// \returns *true* if both colliders accept each other's layer, *false* otherwise
+constexpr bool canCollide(
+    CollisionMask categoryA, CollisionMask maskA, CollisionMask categoryB, CollisionMask maskB
+) noexcept
+{
+    return (maskA & categoryB) != 0 && (maskB & categoryA) != 0;
+}
+
+} // namespace sfa
+
+#endif // !SFA_SRC_ENGINE_ECS_COLLISION_LAYERS_HPP
@@ -67,7 +67,7 @@ public:
         m_indexToEntity[indexOfRemoved] = entityOfLast;
 
         m_entityToIndex.erase(entity);
-        m_indexToEntity.erase(indexOfLast);
+        m_indexToEntity[indexOfLast] = NULL_ENTITY;
         --m_actualSize;
     }
 
@@ -132,13 +132,15 @@ public:
 
     std::span<T> span() noexcept { return { m_components.data(), m_actualSize }; }
     std::span<const T> span() const noexcept { return { m_components.data(), m_actualSize }; }
+    /// \brief Get the owning entities of all components, index-aligned with \ref span().
+    std::span<const EntityID> entities() const noexcept { return { m_indexToEntity.data(), m_actualSize }; }
 
 private:
     static constexpr std::size_t MAX_COMPONENTS{ 10000 };
 
     std::array<T, MAX_COMPONENTS> m_components;
     std::unordered_map<EntityID, std::size_t> m_entityToIndex;
-    std::unordered_map<std::size_t, EntityID> m_indexToEntity;
+    std::array<EntityID, MAX_COMPONENTS> m_indexToEntity{};
     std::size_t m_actualSize{ 0 };
 };
 
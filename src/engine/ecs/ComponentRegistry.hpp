@@ -163,9 +163,6 @@ public:
     /// \returns How many components have been registered
     [[nodiscard]] std::size_t registeredComponents() const noexcept { return m_components.size(); }
 
-private:
-    std::unordered_map<ComponentTypeID, std::unique_ptr<IComponentArray>> m_components;
-
     /// \brief Check if a component is registered.
     ///
     /// \tparam T Type of the component
@@ -176,6 +173,9 @@ private:
     {
         return m_components.contains(getComponentTypeID<T>());
     }
+
+private:
+    std::unordered_map<ComponentTypeID, std::unique_ptr<IComponentArray>> m_components;
 };
 
 } // namespace sfa
@@ -28,7 +28,7 @@ EntityID EntityManager::createEntity()
 
 void EntityManager::destroyEntity(EntityID entity)
 {
-    SFA_ASSERT(entity <= m_livingEntityCount, "Entity out of range");
+    SFA_ASSERT(m_livingEntityCount > 0 && entity != NULL_ENTITY && entity <= MAX_ENTITIES, "Entity out of range");
 
     m_availableEntities.push(entity);
     --m_livingEntityCount;
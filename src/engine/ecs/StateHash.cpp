@@ -0,0 +1,70 @@
+#include "StateHash.hpp"
+
+#include "ecs/ComponentRegistry.hpp"
+#include "ecs/components/HealthComponent.hpp"
+#include "ecs/components/TransformComponent.hpp"
+#include "ecs/components/UIButtonComponent.hpp"
+#include "ecs/components/UITransformComponent.hpp"
+#include "ecs/components/VelocityComponent.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+namespace
+{
+
+/// \brief Feed every component of type \p T together with its owning entity into \p hasher.
+template<typename T, typename F>
+void hashComponents(const sfa::ComponentRegistry& registry, sfa::StateHasher& hasher, const F& addFields)
+{
+    if(!registry.isComponentRegistered<T>())
+        return;
+
+    const auto& components{ registry.getComponentArray<T>() };
+    const auto entities{ components.entities() };
+    const auto values{ components.span() };
+
+    hasher.add(values.size());
+    for(std::size_t i{ 0 }; i < values.size(); ++i)
+    {
+        hasher.add(entities[i]);
+        addFields(values[i]);
+    }
+}
+
+} // namespace
+
+namespace sfa
+{
+
+std::uint64_t hashSimulationState(const ComponentRegistry& registry)
+{
+    StateHasher hasher;
+
+    ::hashComponents<TransformComponent>(registry, hasher, [&hasher](const TransformComponent& transform) {
+        hasher.add(transform.position);
+        hasher.add(transform.rotation);
+        hasher.add(transform.scale);
+    });
+    ::hashComponents<VelocityComponent>(registry, hasher, [&hasher](const VelocityComponent& velocity) {
+        hasher.add(velocity.linear);
+        hasher.add(velocity.angular);
+    });
+    ::hashComponents<HealthComponent>(registry, hasher, [&hasher](const HealthComponent& health) {
+        hasher.add(health.current);
+        hasher.add(health.max);
+    });
+    ::hashComponents<UITransformComponent>(registry, hasher, [&hasher](const UITransformComponent& transform) {
+        hasher.add(transform.worldPosition);
+        hasher.add(transform.size);
+    });
+    ::hashComponents<UIButtonComponent>(registry, hasher, [&hasher](const UIButtonComponent& button) {
+        hasher.add(std::to_underlying(button.state));
+        hasher.add(button.cooldownTimer);
+    });
+
+    return hasher.value();
+}
+
+} // namespace sfa
@@ -0,0 +1,71 @@
+#ifndef SFA_SRC_ENGINE_ECS_STATE_HASH_HPP
+#define SFA_SRC_ENGINE_ECS_STATE_HASH_HPP
+
+#include "ecs/ComponentRegistry.hpp"
+
+#include <glm/glm.hpp>
+
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+
+namespace sfa
+{
+
+/// \brief Incremental 64-bit FNV-1a hash over simulation values.
+///
+/// Floating point values are hashed by their bit pattern, so two states only hash equal if they are bit-for-bit
+/// identical. Values are fed field by field instead of as raw component memory, which keeps padding and
+/// non-trivial members (callbacks, textures) out of the hash.
+///
+/// \author Felix Hommel
+/// \date 3/10/2026
+class StateHasher
+{
+public:
+    template<std::integral T>
+    void add(T value) noexcept
+    {
+        addBits(static_cast<std::uint64_t>(value), sizeof(T));
+    }
+    void add(float value) noexcept { addBits(std::bit_cast<std::uint32_t>(value), sizeof(float)); }
+    void add(const glm::vec2& value) noexcept
+    {
+        add(value.x);
+        add(value.y);
+    }
+
+    [[nodiscard]] std::uint64_t value() const noexcept { return m_hash; }
+
+private:
+    static constexpr std::uint64_t FNV_OFFSET_BASIS{ 0xcbf29ce484222325ull };
+    static constexpr std::uint64_t FNV_PRIME{ 0x100000001b3ull };
+    static constexpr std::uint64_t BYTE_MASK{ 0xffull };
+    static constexpr auto BITS_PER_BYTE{ 8u };
+
+    std::uint64_t m_hash{ FNV_OFFSET_BASIS };
+
+    void addBits(std::uint64_t bits, std::size_t bytes) noexcept
+    {
+        for(std::size_t i{ 0 }; i < bytes; ++i)
+        {
+            m_hash ^= (bits >> (i * BITS_PER_BYTE)) & BYTE_MASK;
+            m_hash *= FNV_PRIME;
+        }
+    }
+};
+
+/// \brief Hash the simulation relevant state of all registered components.
+///
+/// Covers transforms, velocities, health, UI transforms, and button state. Component types that aren't registered
+/// are skipped. Used to compare a replayed session frame by frame against its recording.
+///
+/// \param registry the \ref ComponentRegistry that holds the simulation state
+///
+/// \returns hash of the simulation state
+[[nodiscard]] std::uint64_t hashSimulationState(const ComponentRegistry& registry);
+
+} // namespace sfa
+
+#endif // !SFA_SRC_ENGINE_ECS_STATE_HASH_HPP
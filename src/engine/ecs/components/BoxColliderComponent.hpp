@@ -1,6 +1,7 @@
 #ifndef SFA_SRC_ENGINE_ECS_COMPONENTS_BOX_COLLIDER_COMPONENT_HPP
 #define SFA_SRC_ENGINE_ECS_COMPONENTS_BOX_COLLIDER_COMPONENT_HPP
 
+#include "ecs/CollisionLayers.hpp"
 #include "ecs/components/IComponent.hpp"
 
 #include "glm/glm.hpp"
@@ -10,12 +11,16 @@ namespace sfa
 
 /// \brief Allow an entity to collide with other entities.
 ///
+/// The box is placed by its top-left corner like sprites, so its center lies at `position + offset + size / 2`.
+///
 /// \author Felix Hommel
 /// \date 1/26/2026
 struct BoxColliderComponent : public IComponent
 {
     glm::vec2 size;
-    glm::vec2 offset{ glm::vec2(0.f) };
+    glm::vec2 offset{ glm::vec2(0.f) }; ///< Offset of the top-left corner from the position
+    CollisionMask category{ COLLISION_LAYER_DEFAULT }; ///< The single layer this collider belongs to
+    CollisionMask mask{ COLLISION_MASK_ALL };          ///< Layers this collider is allowed to collide with
 };
 
 } // namespace sfa
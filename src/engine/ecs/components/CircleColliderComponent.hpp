@@ -1,6 +1,7 @@
 #ifndef SFA_SRC_ENGINE_ECS_COMPONENTS_CIRCLE_COLLIDER_COMPONENT_HPP
 #define SFA_SRC_ENGINE_ECS_COMPONENTS_CIRCLE_COLLIDER_COMPONENT_HPP
 
+#include "ecs/CollisionLayers.hpp"
 #include "ecs/components/IComponent.hpp"
 
 #include "glm/glm.hpp"
@@ -10,15 +11,20 @@ namespace sfa
 
 /// \brief Allow a circle shaped entity to collide with other entities.
 ///
+/// Like the \ref BoxColliderComponent and sprites, the circle is placed by the top-left corner of its bounding square,
+/// so its center lies at `position + offset + radius`.
+///
 /// \author Felix Hommel
 /// \date 1/26/2026
 struct CircleColliderComponent : public IComponent
 {
     float radius;
-    glm::vec2 offset{ glm::vec2(0.f) };
+    glm::vec2 offset{ glm::vec2(0.f) }; ///< Offset of the top-left corner of the bounding square from the position
+    CollisionMask category{ COLLISION_LAYER_DEFAULT }; ///< The single layer this collider belongs to
+    CollisionMask mask{ COLLISION_MASK_ALL };          ///< Layers this collider is allowed to collide with
 };
 
-}
+} // namespace sfa
 
 #endif // !SFA_SRC_ENGINE_ECS_COMPONENTS_CIRCLE_COLLIDER_COMPONENT_HPP
 
@@ -10,7 +10,8 @@ namespace sfa
 
 /// \brief Allowing entities to have transform properties.
 ///
-/// Give position, rotation, and scale properties to an entity.
+/// Give position, rotation, and scale properties to an entity. The previous position and rotation hold the state of
+/// the last simulation step, so that rendering can interpolate between two fixed steps.
 ///
 /// \author Felix Hommel
 /// \date 1/26/2026
@@ -19,6 +20,11 @@ struct TransformComponent : public IComponent
     glm::vec2 position{ glm::vec2(0.f) };
     float rotation{ 0.f };
     glm::vec2 scale{ glm::vec2(1.f) };
+    glm::vec2 previousPosition{ glm::vec2(0.f) };
+    float previousRotation{ 0.f };
+    /// \brief Whether the previous position and rotation were captured yet, an entity spawned after the last
+    /// \ref InterpolationSystem::snapshot is rendered at its current state instead of blending from the origin.
+    bool hasPrevious{ false };
 };
 
 } // namespace sfa
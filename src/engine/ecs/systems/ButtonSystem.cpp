@@ -1,5 +1,6 @@
 #include "ButtonSystem.hpp"
 
+#include "core/Profiler.hpp"
 #include "ecs/ComponentRegistry.hpp"
 #include "ecs/components/SpriteComponent.hpp"
 #include "ecs/components/UIButtonComponent.hpp"
@@ -14,6 +15,8 @@ namespace sfa
 
 void ButtonSystem::update(ComponentRegistry& registry, float dt, const glm::vec2& mousePos, bool mousePressed)
 {
+    SFA_PROFILE_SCOPE("ButtonSystem::update");
+
     const auto& transforms{ registry.getComponentArray<UITransformComponent>() };
     auto& sprites{ registry.getComponentArray<SpriteComponent>() };
     auto& buttons{ registry.getComponentArray<UIButtonComponent>() };
@@ -0,0 +1,171 @@
+#include "CollisionSystem.hpp"
+
+#include "core/Profiler.hpp"
+#include "core/Utility.hpp"
+#include "ecs/CollisionLayers.hpp"
+#include "ecs/ComponentRegistry.hpp"
+#include "ecs/components/BoxColliderComponent.hpp"
+#include "ecs/components/CircleColliderComponent.hpp"
+#include "ecs/components/TransformComponent.hpp"
+
+#include <glm/glm.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstddef>
+
+namespace sfa
+{
+
+void CollisionSystem::update(const ComponentRegistry& components)
+{
+    SFA_PROFILE_SCOPE("CollisionSystem::update");
+
+    m_contacts.clear();
+    m_narrowPhaseTests = 0;
+
+    gatherColliders(components);
+
+    for(std::size_t i{ 0 }; i < MAX_COLLISION_LAYERS; ++i)
+    {
+        const auto& lhs{ m_buckets[i] };
+        if(lhs.colliders.empty())
+            continue;
+
+        for(std::size_t j{ i }; j < MAX_COLLISION_LAYERS; ++j)
+        {
+            const auto& rhs{ m_buckets[j] };
+            if(rhs.colliders.empty())
+                continue;
+
+            // NOTE: Reject the whole layer pair if no collider in either bucket accepts the other layer
+            if(!canCollide(collisionLayer(i), lhs.acceptedLayers, collisionLayer(j), rhs.acceptedLayers))
+                continue;
+
+            testBuckets(lhs, rhs, i == j);
+        }
+    }
+}
+
+/// \brief Sort every collider into the bucket of its collision layer.
+///
+/// The buckets keep their capacity between frames, so that the broad phase doesn't allocate in steady state.
+///
+/// \param components const-ref to a \ref ComponentRegistry that maintains the components
+void CollisionSystem::gatherColliders(const ComponentRegistry& components)
+{
+    for(auto& bucket : m_buckets)
+    {
+        bucket.colliders.clear();
+        bucket.acceptedLayers = COLLISION_MASK_NONE;
+    }
+
+    const auto& transforms{ components.getComponentArray<TransformComponent>() };
+    const auto& boxes{ components.getComponentArray<BoxColliderComponent>() };
+    const auto& circles{ components.getComponentArray<CircleColliderComponent>() };
+
+    const auto addToBucket{ [this](const Collider& collider) {
+        SFA_ASSERT(std::has_single_bit(collider.category), "A collider has to belong to exactly one layer");
+
+        auto& bucket{ m_buckets[collisionLayerIndex(collider.category)] };
+        bucket.colliders.push_back(collider);
+        bucket.acceptedLayers |= collider.mask;
+    } };
+
+    for(std::size_t i{ 0 }; i < boxes.size(); ++i)
+    {
+        const auto entity{ boxes.entityAtIndex(i) };
+        if(!transforms.contains(entity))
+            continue;
+
+        const auto& transform{ transforms.get(entity) };
+        const auto& box{ boxes.get(entity) };
+        const glm::vec2 halfSize{ box.size * transform.scale * 0.5f };
+
+        addToBucket({ .entity = entity,
+                      .category = box.category,
+                      .mask = box.mask,
+                      .shape = Shape::Box,
+                      .center = transform.position + box.offset + halfSize,
+                      .extent = halfSize });
+    }
+
+    for(std::size_t i{ 0 }; i < circles.size(); ++i)
+    {
+        const auto entity{ circles.entityAtIndex(i) };
+        if(!transforms.contains(entity))
+            continue;
+
+        const auto& transform{ transforms.get(entity) };
+        const auto& circle{ circles.get(entity) };
+        const float radius{ circle.radius * std::max(transform.scale.x, transform.scale.y) };
+
+        addToBucket({ .entity = entity,
+                      .category = circle.category,
+                      .mask = circle.mask,
+                      .shape = Shape::Circle,
+                      .center = transform.position + circle.offset + radius,
+                      .extent = glm::vec2(radius) });
+    }
+}
+
+/// \brief Test all collider pairs between two buckets that passed the layer filter.
+///
+/// \param lhs the first \ref LayerBucket
+/// \param rhs the second \ref LayerBucket
+/// \param sameBucket whether \p lhs and \p rhs are the same bucket, in which case every pair is only tested once
+void CollisionSystem::testBuckets(const LayerBucket& lhs, const LayerBucket& rhs, bool sameBucket)
+{
+    for(std::size_t i{ 0 }; i < lhs.colliders.size(); ++i)
+    {
+        const auto& a{ lhs.colliders[i] };
+
+        for(std::size_t j{ sameBucket ? i + 1 : 0 }; j < rhs.colliders.size(); ++j)
+        {
+            const auto& b{ rhs.colliders[j] };
+
+            if(a.entity == b.entity || !canCollide(a.category, a.mask, b.category, b.mask))
+                continue;
+
+            ++m_narrowPhaseTests;
+            if(overlaps(a, b))
+                m_contacts.push_back({ .a = a.entity, .b = b.entity });
+        }
+    }
+}
+
+/// \brief Narrow phase test of two colliders.
+///
+/// \param lhs the first \ref Collider
+/// \param rhs the second \ref Collider
+///
+/// \returns *true* if the colliders overlap, *false* otherwise
+bool CollisionSystem::overlaps(const Collider& lhs, const Collider& rhs)
+{
+    if(lhs.shape == Shape::Box && rhs.shape == Shape::Box)
+    {
+        const glm::vec2 distance{ rhs.center - lhs.center };
+        return std::abs(distance.x) <= lhs.extent.x + rhs.extent.x
+            && std::abs(distance.y) <= lhs.extent.y + rhs.extent.y;
+    }
+
+    if(lhs.shape == Shape::Circle && rhs.shape == Shape::Circle)
+    {
+        const glm::vec2 distance{ rhs.center - lhs.center };
+        const float radii{ lhs.extent.x + rhs.extent.x };
+        return (distance.x * distance.x) + (distance.y * distance.y) <= radii * radii;
+    }
+
+    const auto& box{ lhs.shape == Shape::Box ? lhs : rhs };
+    const auto& circle{ lhs.shape == Shape::Circle ? lhs : rhs };
+
+    // NOTE: Closest point on the box to the center of the circle
+    const glm::vec2 closest{ std::clamp(circle.center.x, box.center.x - box.extent.x, box.center.x + box.extent.x),
+                             std::clamp(circle.center.y, box.center.y - box.extent.y, box.center.y + box.extent.y) };
+    const glm::vec2 distance{ circle.center - closest };
+
+    return (distance.x * distance.x) + (distance.y * distance.y) <= circle.extent.x * circle.extent.x;
+}
+
+} // namespace sfa
@@ -0,0 +1,112 @@
+#ifndef SFA_SRC_ENGINE_ECS_SYSTEMS_COLLISION_SYSTEM_HPP
+#define SFA_SRC_ENGINE_ECS_SYSTEMS_COLLISION_SYSTEM_HPP
+
+#include "ecs/CollisionLayers.hpp"
+#include "ecs/ComponentRegistry.hpp"
+#include "ecs/ECSUtility.hpp"
+
+#include <glm/glm.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace sfa
+{
+
+/// \brief Describe two entities whose colliders overlap.
+///
+/// \author Felix Hommel
+/// \date 3/7/2026
+struct Contact
+{
+    EntityID a;
+    EntityID b;
+};
+
+/// \brief The \ref CollisionSystem is responsible for finding all pairs of overlapping colliders.
+///
+/// In order to take part in collision detection, an entity needs to have a \ref TransformComponent and either a
+/// \ref BoxColliderComponent or a \ref CircleColliderComponent.
+///
+/// The broad phase buckets all colliders by their collision layer. Whole pairs of layers that don't accept each other
+/// are skipped before any geometric test is performed, only the remaining pairs are handed to the narrow phase. The
+/// colliders of an entity with both a box and a circle are never tested against each other.
+///
+/// \author Felix Hommel
+/// \date 3/7/2026
+class CollisionSystem
+{
+public:
+    CollisionSystem() = default;
+    ~CollisionSystem() = default;
+
+    CollisionSystem(const CollisionSystem&) = delete;
+    CollisionSystem& operator=(const CollisionSystem&) = delete;
+    CollisionSystem(CollisionSystem&&) = delete;
+    CollisionSystem& operator=(CollisionSystem&&) = delete;
+
+    /// \brief Detect all collisions of the current frame.
+    ///
+    /// The contacts of the previous frame are discarded.
+    ///
+    /// \param components const-ref to a \ref ComponentRegistry that maintains the components
+    void update(const ComponentRegistry& components);
+
+    /// \brief Get the contacts that were found during the last update.
+    ///
+    /// \returns span over all \ref Contact of the current frame
+    [[nodiscard]] std::span<const Contact> contacts() const noexcept { return m_contacts; }
+    /// \brief Get the amount of collider pairs that were handed to the narrow phase during the last update.
+    [[nodiscard]] std::size_t narrowPhaseTests() const noexcept { return m_narrowPhaseTests; }
+
+private:
+    /// \brief Which shape a \ref Collider has.
+    enum class Shape : std::uint8_t
+    {
+        Box,
+        Circle
+    };
+
+    /// \brief World-space snapshot of a collider that is used during the narrow phase.
+    ///
+    /// For a box, \p center is the center of the box and \p extent its half size. For a circle, \p extent.x is the
+    /// radius.
+    ///
+    /// \author Felix Hommel
+    /// \date 3/7/2026
+    struct Collider
+    {
+        EntityID entity;
+        CollisionMask category;
+        CollisionMask mask;
+        Shape shape;
+        glm::vec2 center;
+        glm::vec2 extent;
+    };
+
+    /// \brief All colliders that belong to the same collision layer.
+    ///
+    /// \author Felix Hommel
+    /// \date 3/7/2026
+    struct LayerBucket
+    {
+        std::vector<Collider> colliders;
+        CollisionMask acceptedLayers{ COLLISION_MASK_NONE }; ///< Union of the masks of all colliders in the bucket
+    };
+
+    std::array<LayerBucket, MAX_COLLISION_LAYERS> m_buckets;
+    std::vector<Contact> m_contacts;
+    std::size_t m_narrowPhaseTests{ 0 };
+
+    void gatherColliders(const ComponentRegistry& components);
+    void testBuckets(const LayerBucket& lhs, const LayerBucket& rhs, bool sameBucket);
+
+    static bool overlaps(const Collider& lhs, const Collider& rhs);
+};
+
+} // namespace sfa
+
+#endif // !SFA_SRC_ENGINE_ECS_SYSTEMS_COLLISION_SYSTEM_HPP
@@ -0,0 +1,90 @@
+#include "DamageSystem.hpp"
+
+#include "core/Profiler.hpp"
+#include "ecs/ComponentRegistry.hpp"
+#include "ecs/ECSUtility.hpp"
+#include "ecs/EntityManager.hpp"
+#include "ecs/components/DamageComponent.hpp"
+#include "ecs/components/HealthComponent.hpp"
+#include "ecs/systems/CollisionSystem.hpp"
+
+#include <cstddef>
+#include <span>
+
+namespace sfa
+{
+
+DamageSystem::DamageSystem()
+    : m_dealtDamage(ENTITY_TABLE_SIZE, 0), m_receivedDamage(ENTITY_TABLE_SIZE, 0)
+{
+    m_destroyQueue.reserve(ENTITY_TABLE_SIZE);
+}
+
+void DamageSystem::update(ComponentRegistry& components, std::span<const Contact> contacts)
+{
+    SFA_PROFILE_SCOPE("DamageSystem::update");
+
+    const auto& damages{ components.getComponentArray<DamageComponent>() };
+    auto& healths{ components.getComponentArray<HealthComponent>() };
+
+    // NOTE: Snapshot how much damage every dealer does, so the contact pass only touches flat arrays
+    const auto dealers{ damages.entities() };
+    const auto dealerDamage{ damages.span() };
+    for(std::size_t i{ 0 }; i < dealers.size(); ++i)
+        m_dealtDamage[dealers[i]] = dealerDamage[i].amount;
+
+    accumulate(contacts);
+
+    const auto targets{ healths.entities() };
+    auto targetHealth{ healths.span() };
+    for(std::size_t i{ 0 }; i < targets.size(); ++i)
+    {
+        const int received{ m_receivedDamage[targets[i]] };
+        if(received == 0)
+            continue;
+
+        auto& health{ targetHealth[i] };
+        const bool wasAlive{ health.current > 0 };
+        health.current -= received;
+
+        if(wasAlive && health.current <= 0)
+            m_destroyQueue.push_back(targets[i]);
+    }
+
+    // NOTE: Reset only the entries that were written this frame instead of the whole tables
+    for(const auto& contact : contacts)
+    {
+        m_receivedDamage[contact.a] = 0;
+        m_receivedDamage[contact.b] = 0;
+    }
+
+    for(const auto dealer : dealers)
+        m_dealtDamage[dealer] = 0;
+}
+
+void DamageSystem::flushDestroyed(EntityManager& entities, ComponentRegistry& components)
+{
+    SFA_PROFILE_SCOPE("DamageSystem::flushDestroyed");
+
+    for(const auto entity : m_destroyQueue)
+    {
+        components.entityDestroyed(entity);
+        entities.destroyEntity(entity);
+    }
+
+    m_destroyQueue.clear();
+}
+
+/// \brief Sum up the damage every entity received from the contacts of the current frame.
+///
+/// \param contacts the contacts of the current frame
+void DamageSystem::accumulate(std::span<const Contact> contacts)
+{
+    for(const auto& contact : contacts)
+    {
+        m_receivedDamage[contact.b] += m_dealtDamage[contact.a];
+        m_receivedDamage[contact.a] += m_dealtDamage[contact.b];
+    }
+}
+
+} // namespace sfa
@@ -0,0 +1,22 @@
+#include "InterpolationSystem.hpp"
+
+#include "core/Profiler.hpp"
+#include "ecs/ComponentRegistry.hpp"
+#include "ecs/components/TransformComponent.hpp"
+
+namespace sfa
+{
+
+void InterpolationSystem::snapshot(ComponentRegistry& components)
+{
+    SFA_PROFILE_SCOPE("InterpolationSystem::snapshot");
+
+    for(auto& transform : components.getComponentArray<TransformComponent>().span())
+    {
+        transform.previousPosition = transform.position;
+        transform.previousRotation = transform.rotation;
+        transform.hasPrevious = true;
+    }
+}
+
+} // namespace sfa
@@ -0,0 +1,64 @@
+#ifndef SFA_SRC_ENGINE_ECS_SYSTEMS_INTERPOLATION_SYSTEM_HPP
+#define SFA_SRC_ENGINE_ECS_SYSTEMS_INTERPOLATION_SYSTEM_HPP
+
+#include "ecs/ComponentRegistry.hpp"
+#include "ecs/components/TransformComponent.hpp"
+
+#include "glm/glm.hpp"
+
+namespace sfa
+{
+
+/// \brief The \ref InterpolationSystem keeps the state needed to render between two fixed simulation steps.
+///
+/// \ref InterpolationSystem::snapshot has to run at the beginning of every simulation step, before any system changes a
+/// \ref TransformComponent. The render systems then blend between the snapshot and the current state with the
+/// interpolation factor reported by the \ref GameLoop.
+///
+/// \author Felix Hommel
+/// \date 3/9/2026
+class InterpolationSystem
+{
+public:
+    InterpolationSystem() = default;
+    ~InterpolationSystem() = default;
+
+    InterpolationSystem(const InterpolationSystem&) = delete;
+    InterpolationSystem& operator=(const InterpolationSystem&) = delete;
+    InterpolationSystem(InterpolationSystem&&) = delete;
+    InterpolationSystem& operator=(InterpolationSystem&&) = delete;
+
+    /// \brief Remember the current position and rotation of every entity with a \ref TransformComponent.
+    ///
+    /// \param components reference to \ref ComponentRegistry, which maintains the components
+    static void snapshot(ComponentRegistry& components);
+
+    /// \brief Move \p transform to \p position without blending from where it was for the rest of the step.
+    static void teleport(TransformComponent& transform, glm::vec2 position) noexcept
+    {
+        transform.position = position;
+        transform.previousPosition = position;
+    }
+
+    /// \brief Position of \p transform at \p alpha between the previous and the current simulation step.
+    [[nodiscard]] static glm::vec2 position(const TransformComponent& transform, float alpha) noexcept
+    {
+        if(!transform.hasPrevious)
+            return transform.position;
+
+        return transform.previousPosition + ((transform.position - transform.previousPosition) * alpha);
+    }
+
+    /// \brief Rotation of \p transform at \p alpha between the previous and the current simulation step.
+    [[nodiscard]] static float rotation(const TransformComponent& transform, float alpha) noexcept
+    {
+        if(!transform.hasPrevious)
+            return transform.rotation;
+
+        return transform.previousRotation + ((transform.rotation - transform.previousRotation) * alpha);
+    }
+};
+
+} // namespace sfa
+
+#endif // !SFA_SRC_ENGINE_ECS_SYSTEMS_INTERPOLATION_SYSTEM_HPP
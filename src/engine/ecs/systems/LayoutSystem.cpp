@@ -1,5 +1,6 @@
 #include "LayoutSystem.hpp"
 
+#include "core/Profiler.hpp"
 #include "ecs/ComponentArray.hpp"
 #include "ecs/ComponentRegistry.hpp"
 #include "ecs/ECSUtility.hpp"
@@ -19,6 +20,8 @@ namespace sfa
 
 void LayoutSystem::update(ComponentRegistry& registry)
 {
+    SFA_PROFILE_SCOPE("LayoutSystem::update");
+
     const auto& hierarchies{ registry.getComponentArray<UIHierarchyComponent>() };
     const auto& layouts{ registry.getComponentArray<UILayoutComponent>() };
     const auto& elements{ registry.getComponentArray<UILayoutElementComponent>() };
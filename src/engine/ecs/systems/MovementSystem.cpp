@@ -1,5 +1,6 @@
 #include "MovementSystem.hpp"
 
+#include "core/Profiler.hpp"
 #include "ecs/ComponentRegistry.hpp"
 #include "ecs/components/TransformComponent.hpp"
 #include "ecs/components/VelocityComponent.hpp"
@@ -11,6 +12,8 @@ namespace sfa
 
 void MovementSystem::update(ComponentRegistry& components, float dt)
 {
+    SFA_PROFILE_SCOPE("MovementSystem::update");
+
     auto& transforms{ components.getComponentArray<TransformComponent>() };
     auto& velocities{ components.getComponentArray<VelocityComponent>() };
 
@@ -1,11 +1,16 @@
 #include "SpriteRenderSystem.hpp"
 
+#include "core/GpuTimer.hpp"
+#include "core/ISpriteRenderer.hpp"
+#include "core/Profiler.hpp"
+#include "core/Sampler.hpp"
 #include "core/Shader.hpp"
 #include "core/SpriteRenderer.hpp"
 #include "ecs/ComponentRegistry.hpp"
 #include "ecs/ECSUtility.hpp"
 #include "ecs/components/SpriteComponent.hpp"
 #include "ecs/components/TransformComponent.hpp"
+#include "ecs/systems/InterpolationSystem.hpp"
 
 #include <algorithm>
 #include <cstddef>
@@ -16,12 +21,19 @@
 namespace sfa
 {
 
-SpriteRenderSystem::SpriteRenderSystem(std::shared_ptr<Shader> shader)
-    : m_renderer{ std::make_unique<SpriteRenderer>(std::move(shader)) }
+SpriteRenderSystem::SpriteRenderSystem(std::shared_ptr<Shader> shader, std::shared_ptr<Sampler> sampler)
+    : m_renderer{ std::make_unique<SpriteRenderer>(std::move(shader), std::move(sampler)) }
 {}
 
-void SpriteRenderSystem::render(const ComponentRegistry& components, const glm::mat4& projection)
+SpriteRenderSystem::SpriteRenderSystem(std::unique_ptr<ISpriteRenderer> renderer)
+    : m_renderer{ std::move(renderer) }
+{}
+
+void SpriteRenderSystem::render(const ComponentRegistry& components, const glm::mat4& projection, float alpha)
 {
+    SFA_PROFILE_SCOPE("SpriteRenderSystem::render");
+    const ScopedGpuZone gpuZone{ m_gpuTimer.get(), "SpriteRenderSystem::render" };
+
     const auto& transforms{ components.getComponentArray<TransformComponent>() };
     const auto& sprites{ components.getComponentArray<SpriteComponent>() };
 
@@ -43,7 +55,11 @@ void SpriteRenderSystem::render(const ComponentRegistry& components, const glm::
         const auto& sprite{ sprites.get(entity) };
 
         m_renderer->draw(
-            sprite.texture, transform.position, sprite.size * transform.scale, transform.rotation, sprite.color
+            sprite.texture,
+            InterpolationSystem::position(transform, alpha),
+            sprite.size * transform.scale,
+            InterpolationSystem::rotation(transform, alpha),
+            sprite.color
         );
     }
 }
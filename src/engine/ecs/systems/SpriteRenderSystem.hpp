@@ -1,13 +1,16 @@
 #ifndef SFA_SRC_ENGINE_ECS_SYSTEMS_SPRITE_RENDER_SYSTEM_HPP
 #define SFA_SRC_ENGINE_ECS_SYSTEMS_SPRITE_RENDER_SYSTEM_HPP
 
+#include "core/GpuTimer.hpp"
+#include "core/ISpriteRenderer.hpp"
+#include "core/Sampler.hpp"
 #include "core/Shader.hpp"
-#include "core/SpriteRenderer.hpp"
 #include "ecs/ComponentRegistry.hpp"
 
 #include "glm/glm.hpp"
 
 #include <memory>
+#include <utility>
 
 namespace sfa
 {
@@ -21,7 +24,15 @@ namespace sfa
 class SpriteRenderSystem
 {
 public:
-    explicit SpriteRenderSystem(std::shared_ptr<Shader> shader);
+    /// \brief Create a \ref SpriteRenderSystem that draws through a \ref SpriteRenderer.
+    ///
+    /// \param shader the \ref Shader the sprites are rendered with
+    /// \param sampler how the sprite textures are sampled, share one from a \ref SamplerCache between renderers
+    SpriteRenderSystem(std::shared_ptr<Shader> shader, std::shared_ptr<Sampler> sampler);
+    /// \brief Create a \ref SpriteRenderSystem that draws through an arbitrary \ref ISpriteRenderer.
+    ///
+    /// \param renderer the renderer the sprites are drawn with, e.g. a null renderer
+    explicit SpriteRenderSystem(std::unique_ptr<ISpriteRenderer> renderer);
     ~SpriteRenderSystem() = default;
 
     SpriteRenderSystem(const SpriteRenderSystem&) = delete;
@@ -35,10 +46,19 @@ public:
     ///
     /// \param components const-ref to a \ref ComponentRegistry that maintains the components
     /// \param projection the projection matrix
-    void render(const ComponentRegistry& components, const glm::mat4& projection);
+    /// \param alpha (optional) interpolation factor between the previous and the current simulation step
+    void render(const ComponentRegistry& components, const glm::mat4& projection, float alpha = 1.f);
+
+    /// \brief Measure the GPU time of \ref SpriteRenderSystem::render with \p timer, *nullptr* stops measuring.
+    void setGpuTimer(std::shared_ptr<GpuTimer> timer) { m_gpuTimer = std::move(timer); }
+    /// \brief Sample the sprite textures through \p sampler from now on.
+    ///
+    /// \param sampler the new sampler, *nullptr* restores the one passed on construction
+    void setSampler(std::shared_ptr<Sampler> sampler) { m_renderer->setSampler(std::move(sampler)); }
 
 private:
-    std::unique_ptr<SpriteRenderer> m_renderer;
+    std::unique_ptr<ISpriteRenderer> m_renderer;
+    std::shared_ptr<GpuTimer> m_gpuTimer;
 };
 
 } // namespace sfa
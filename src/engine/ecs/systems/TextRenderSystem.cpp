@@ -1,11 +1,15 @@
 #include "TextRenderSystem.hpp"
 
+#include "core/GpuTimer.hpp"
+#include "core/ITextRenderer.hpp"
+#include "core/Profiler.hpp"
 #include "core/Shader.hpp"
 #include "core/TextRenderer.hpp"
 #include "ecs/ComponentRegistry.hpp"
 #include "ecs/ECSUtility.hpp"
 #include "ecs/components/TextComponent.hpp"
 #include "ecs/components/TransformComponent.hpp"
+#include "ecs/systems/InterpolationSystem.hpp"
 
 #include <glm/glm.hpp>
 
@@ -22,8 +26,15 @@ TextRenderSystem::TextRenderSystem(std::shared_ptr<Shader> shader)
     : m_renderer{ std::make_unique<TextRenderer>(std::move(shader)) }
 {}
 
-void TextRenderSystem::render(const ComponentRegistry& components, const glm::mat4& projection)
+TextRenderSystem::TextRenderSystem(std::unique_ptr<ITextRenderer> renderer)
+    : m_renderer{ std::move(renderer) }
+{}
+
+void TextRenderSystem::render(const ComponentRegistry& components, const glm::mat4& projection, float alpha)
 {
+    SFA_PROFILE_SCOPE("TextRenderSystem::render");
+    const ScopedGpuZone gpuZone{ m_gpuTimer.get(), "TextRenderSystem::render" };
+
     const auto& transforms{ components.getComponentArray<TransformComponent>() };
     const auto& texts{ components.getComponentArray<TextComponent>() };
 
@@ -44,7 +55,7 @@ void TextRenderSystem::render(const ComponentRegistry& components, const glm::ma
         const auto& transform{ transforms.get(entity) };
         const auto& text{ texts.get(entity) };
 
-        const glm::vec2 renderPos{ transform.position + text.offset };
+        const glm::vec2 renderPos{ InterpolationSystem::position(transform, alpha) + text.offset };
         m_renderer->render(text.content, renderPos, transform.scale, text.color);
     }
 }
@@ -1,13 +1,15 @@
 #ifndef SFA_SRC_ENGINE_ECS_SYSTEMS_TEXT_RENDER_SYSTEM_HPP
 #define SFA_SRC_ENGINE_ECS_SYSTEMS_TEXT_RENDER_SYSTEM_HPP
 
+#include "core/GpuTimer.hpp"
+#include "core/ITextRenderer.hpp"
 #include "core/Shader.hpp"
-#include "core/TextRenderer.hpp"
 #include "ecs/ComponentRegistry.hpp"
 
 #include <glm/glm.hpp>
 
 #include <memory>
+#include <utility>
 
 namespace sfa
 {
@@ -20,6 +22,8 @@ class TextRenderSystem
 {
 public:
     explicit TextRenderSystem(std::shared_ptr<Shader> shader);
+    /// \brief Create a \ref TextRenderSystem that draws through an arbitrary \ref ITextRenderer, e.g. a null renderer.
+    explicit TextRenderSystem(std::unique_ptr<ITextRenderer> renderer);
     ~TextRenderSystem() = default;
 
     TextRenderSystem(const TextRenderSystem&) = delete;
@@ -33,10 +37,15 @@ public:
     ///
     /// \param components \ref ComponentRegistry that maintains all the components
     /// \param projection projection matrix
-    void render(const ComponentRegistry& components, const glm::mat4& projection);
+    /// \param alpha (optional) interpolation factor between the previous and the current simulation step
+    void render(const ComponentRegistry& components, const glm::mat4& projection, float alpha = 1.f);
+
+    /// \brief Measure the GPU time of \ref TextRenderSystem::render with \p timer, *nullptr* stops measuring.
+    void setGpuTimer(std::shared_ptr<GpuTimer> timer) { m_gpuTimer = std::move(timer); }
 
 private:
-    std::unique_ptr<TextRenderer> m_renderer;
+    std::unique_ptr<ITextRenderer> m_renderer;
+    std::shared_ptr<GpuTimer> m_gpuTimer;
 };
 
 } // namespace sfa
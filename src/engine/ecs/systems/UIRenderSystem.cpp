@@ -1,7 +1,9 @@
 #include "UIRenderSystem.hpp"
 
-#include "core/SpriteRenderer.hpp"
-#include "core/TextRenderer.hpp"
+#include "core/GpuTimer.hpp"
+#include "core/ISpriteRenderer.hpp"
+#include "core/ITextRenderer.hpp"
+#include "core/Profiler.hpp"
 #include "ecs/ComponentRegistry.hpp"
 #include "ecs/ECSUtility.hpp"
 #include "ecs/components/SpriteComponent.hpp"
@@ -23,13 +25,28 @@ namespace sfa
 {
 
 UIRenderSystem::UIRenderSystem(
-    std::shared_ptr<SpriteRenderer> spriteRenderer, std::shared_ptr<TextRenderer> textRenderer
+    std::shared_ptr<ISpriteRenderer> spriteRenderer, std::shared_ptr<ITextRenderer> textRenderer
 )
     : m_spriteRenderer(std::move(spriteRenderer)), m_textRenderer(std::move(textRenderer))
 {}
 
 void UIRenderSystem::render(ComponentRegistry& registry)
 {
+    // NOLINTNEXTLINE(readability-magic-numbers): 4 for viewport dimensions
+    std::array<int, 4> viewport{ 0, 0, 1, 1 };
+    glGetIntegerv(GL_VIEWPORT, viewport.data());
+
+    const float width{ static_cast<float>(viewport[2]) };
+    const float height{ static_cast<float>(viewport[3]) };
+
+    render(registry, glm::ortho(0.f, width, height, 0.f, -1.f, 1.f));
+}
+
+void UIRenderSystem::render(ComponentRegistry& registry, const glm::mat4& projection)
+{
+    SFA_PROFILE_SCOPE("UIRenderSystem::render");
+    const ScopedGpuZone gpuZone{ m_gpuTimer.get(), "UIRenderSystem::render" };
+
     const auto& transforms{ registry.getComponentArray<UITransformComponent>() };
     const auto& sprites{ registry.getComponentArray<SpriteComponent>() };
     const auto& texts{ registry.getComponentArray<TextComponent>() };
@@ -49,14 +66,6 @@ void UIRenderSystem::render(ComponentRegistry& registry)
         return lhsLayer < rhsLayer;
     });
 
-    // NOLINTNEXTLINE(readability-magic-numbers): 4 for viewport dimensions
-    std::array<int, 4> viewport{ 0, 0, 1, 1 };
-    glGetIntegerv(GL_VIEWPORT, viewport.data());
-
-    const float width{ static_cast<float>(viewport[2]) };
-    const float height{ static_cast<float>(viewport[3]) };
-    const glm::mat4 projection{ glm::ortho(0.f, width, height, 0.f, -1.f, 1.f) };
-
     m_spriteRenderer->beginFrame(projection);
     m_textRenderer->beginFrame(projection);
 
@@ -1,11 +1,15 @@
 #ifndef SFA_SRC_ENGINE_ECS_SYSTEMS_UI_RENDER_SYSTEM_HPP
 #define SFA_SRC_ENGINE_ECS_SYSTEMS_UI_RENDER_SYSTEM_HPP
 
-#include "core/SpriteRenderer.hpp"
-#include "core/TextRenderer.hpp"
+#include "core/GpuTimer.hpp"
+#include "core/ISpriteRenderer.hpp"
+#include "core/ITextRenderer.hpp"
 #include "ecs/ComponentRegistry.hpp"
 
+#include <glm/glm.hpp>
+
 #include <memory>
+#include <utility>
 
 namespace sfa
 {
@@ -13,13 +17,20 @@ namespace sfa
 class UIRenderSystem
 {
 public:
-    UIRenderSystem(std::shared_ptr<SpriteRenderer> spriteRenderer, std::shared_ptr<TextRenderer> textRenderer);
+    UIRenderSystem(std::shared_ptr<ISpriteRenderer> spriteRenderer, std::shared_ptr<ITextRenderer> textRenderer);
 
+    /// \brief Render the UI with an orthographic projection over the current OpenGL viewport.
     void render(ComponentRegistry& registry);
+    /// \brief Render the UI with an explicit projection, without querying OpenGL state.
+    void render(ComponentRegistry& registry, const glm::mat4& projection);
+
+    /// \brief Measure the GPU time of \ref UIRenderSystem::render with \p timer, *nullptr* stops measuring.
+    void setGpuTimer(std::shared_ptr<GpuTimer> timer) { m_gpuTimer = std::move(timer); }
 
 private:
-    std::shared_ptr<SpriteRenderer> m_spriteRenderer;
-    std::shared_ptr<TextRenderer> m_textRenderer;
+    std::shared_ptr<ISpriteRenderer> m_spriteRenderer;
+    std::shared_ptr<ITextRenderer> m_textRenderer;
+    std::shared_ptr<GpuTimer> m_gpuTimer;
 };
 
 } // namespace sfa
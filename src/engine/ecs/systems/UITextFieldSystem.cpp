@@ -1,5 +1,6 @@
 #include "UITextFieldSystem.hpp"
 
+#include "core/Profiler.hpp"
 #include "ecs/ComponentRegistry.hpp"
 #include "ecs/components/TextComponent.hpp"
 #include "ecs/components/UITextFieldComponent.hpp"
@@ -28,6 +29,8 @@ namespace sfa
 
 void UITextFieldSystem::update(ComponentRegistry& registry, float dt, const UIInputState& input)
 {
+    SFA_PROFILE_SCOPE("UITextFieldSystem::update");
+
     const auto& transforms{ registry.getComponentArray<UITransformComponent>() };
     auto& textFields{ registry.getComponentArray<UITextFieldComponent>() };
     auto& texts{ registry.getComponentArray<TextComponent>() };
@@ -1,5 +1,6 @@
 #include "UITransformSystem.hpp"
 
+#include "core/Profiler.hpp"
 #include "ecs/ComponentArray.hpp"
 #include "ecs/ComponentRegistry.hpp"
 #include "ecs/ECSUtility.hpp"
@@ -13,6 +14,8 @@ namespace sfa
 
 void UITransformSystem::update(ComponentRegistry& registry)
 {
+    SFA_PROFILE_SCOPE("UITransformSystem::update");
+
     const auto& hierarchies{ registry.getComponentArray<UIHierarchyComponent>() };
     auto& transforms{ registry.getComponentArray<UITransformComponent>() };
 
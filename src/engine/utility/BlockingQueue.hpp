@@ -3,17 +3,18 @@
 
 #include <condition_variable>
 #include <cstddef>
+#include <deque>
 #include <mutex>
 #include <optional>
-#include <queue>
 #include <utility>
+#include <vector>
 
 namespace sfa
 {
 
 /// \brief Simple thread-safe queue.
 ///
-/// This is a thread-safe queue that is built around std::queue with synchronization around the critical operations.
+/// This is a thread-safe queue that is built around std::deque with synchronization around the critical operations.
 ///
 /// \author Felix Hommel
 /// \date 2/7/2026
@@ -42,7 +43,7 @@ public:
             if(m_closed)
                 return;
 
-            m_queue.emplace(std::move(value));
+            m_queue.emplace_back(std::move(value));
         }
 
         m_signal.notify_one();
@@ -61,7 +62,7 @@ public:
             if(m_closed)
                 return;
 
-            m_queue.emplace(std::forward<Args>(args)...);
+            m_queue.emplace_back(std::forward<Args>(args)...);
         }
 
         m_signal.notify_one();
@@ -114,7 +115,7 @@ public:
             return std::nullopt;
 
         T v{ std::move(m_queue.front()) };
-        m_queue.pop();
+        m_queue.pop_front();
 
         return v;
     }
@@ -132,13 +133,54 @@ public:
             return std::nullopt;
 
         T v{ std::move(m_queue.front()) };
-        m_queue.pop();
+        m_queue.pop_front();
 
         return v;
     }
 
+    /// \brief Move up to \p maxItems elements out of the queue, in order, under a single lock acquisition.
+    ///
+    /// \param out vector the elements are appended to
+    /// \param maxItems (optional) maximum number of elements to take (0 := all)
+    ///
+    /// \returns how many elements were appended to \p out
+    std::size_t drainInto(std::vector<T>& out, std::size_t maxItems = 0)
+    {
+        std::lock_guard lock(m_mutex);
+
+        const auto count{ (maxItems == 0 || maxItems > m_queue.size()) ? m_queue.size() : maxItems };
+        out.reserve(out.size() + count);
+        for(std::size_t i{ 0 }; i < count; ++i)
+        {
+            out.emplace_back(std::move(m_queue.front()));
+            m_queue.pop_front();
+        }
+
+        return count;
+    }
+
+    /// \brief Take every element out of the queue by swapping the internal buffer with \p buffer.
+    ///
+    /// The swap is O(1) no matter how many elements are queued, so producers are blocked for as short as possible.
+    /// Elements that are still in \p buffer are destroyed before the lock is taken, pass the same buffer every time to
+    /// let the queue reuse its memory.
+    ///
+    /// \param buffer receives the queued elements in order
+    ///
+    /// \returns how many elements were taken
+    std::size_t takeAll(std::deque<T>& buffer)
+    {
+        buffer.clear();
+
+        std::lock_guard lock(m_mutex);
+
+        m_queue.swap(buffer);
+
+        return buffer.size();
+    }
+
 private:
-    std::queue<T> m_queue{};
+    std::deque<T> m_queue{};
     mutable std::mutex m_mutex;
     std::condition_variable m_signal;
     bool m_closed{ false };
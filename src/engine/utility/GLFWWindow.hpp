@@ -14,16 +14,6 @@
 namespace sfa
 {
 
-/// \brief Simple struct containing the dimensions of the window.
-///
-/// \author Felix Hommel
-/// \date 2/19/2026
-struct Viewport
-{
-    int width;
-    int height;
-};
-
 /// \brief Abstraction for GLFW window and context management.
 ///
 /// \author Felix Hommel
@@ -60,7 +50,9 @@ public:
     /// \param height the new window height
     void onResize(int width, int height);
 
-    void setShouldClose() { glfwSetWindowShouldClose(m_window.get(), GLFW_TRUE); }
+    void setShouldClose() override { glfwSetWindowShouldClose(m_window.get(), GLFW_TRUE); }
+    void swapBuffers() override { glfwSwapBuffers(m_window.get()); }
+    void pollEvents() override { glfwPollEvents(); }
 
 private:
     struct WindowDeleter
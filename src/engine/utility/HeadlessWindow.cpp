@@ -0,0 +1,40 @@
+#include "HeadlessWindow.hpp"
+
+#include "utility/IWindow.hpp"
+#include "utility/userInput/InputController.hpp"
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <utility>
+
+namespace sfa
+{
+
+HeadlessWindow::HeadlessWindow(Viewport viewport, std::optional<std::uint64_t> frameLimit)
+    : m_viewport{ viewport }
+    , m_frameLimit{ frameLimit }
+{}
+
+bool HeadlessWindow::shouldClose() const
+{
+    return m_shouldClose || (m_frameLimit.has_value() && m_frame >= *m_frameLimit);
+}
+
+void HeadlessWindow::attachInputController(std::shared_ptr<InputController> controller)
+{
+    if(controller == nullptr)
+        return;
+
+    m_inputController = std::move(controller);
+}
+
+void HeadlessWindow::pollEvents()
+{
+    if(m_inputController == nullptr || m_replay == nullptr)
+        return;
+
+    m_replay->feed(m_frame, *m_inputController);
+}
+
+} // namespace sfa
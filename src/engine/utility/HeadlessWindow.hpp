@@ -0,0 +1,69 @@
+#ifndef SFA_SRC_ENGINE_UTILITY_HEADLESS_WINDOW_HPP
+#define SFA_SRC_ENGINE_UTILITY_HEADLESS_WINDOW_HPP
+
+#include "utility/IWindow.hpp"
+#include "utility/userInput/InputController.hpp"
+#include "utility/userInput/InputRecording.hpp"
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <utility>
+
+namespace sfa
+{
+
+/// \brief \ref IWindow without an operating system window or OpenGL context.
+///
+/// Lets the full simulation run on machines without a display, e.g. on CI. Instead of the operating system, input
+/// events come from an optional \ref InputReplay, which is fed into the attached \ref InputController on every
+/// \ref HeadlessWindow::pollEvents, exactly like the GLFW callbacks would.
+///
+/// \author Felix Hommel
+/// \date 3/10/2026
+class HeadlessWindow : public IWindow
+{
+public:
+    /// \brief Create a new \ref HeadlessWindow.
+    ///
+    /// \param viewport the dimensions the window pretends to have
+    /// \param frameLimit (optional) after how many presented frames the window requests to be closed
+    explicit HeadlessWindow(Viewport viewport, std::optional<std::uint64_t> frameLimit = std::nullopt);
+    ~HeadlessWindow() override = default;
+
+    HeadlessWindow(const HeadlessWindow&) = delete;
+    HeadlessWindow& operator=(const HeadlessWindow&) = delete;
+    HeadlessWindow(HeadlessWindow&&) = delete;
+    HeadlessWindow& operator=(HeadlessWindow&&) = delete;
+
+    [[nodiscard]] Viewport viewport() const noexcept { return m_viewport; }
+    [[nodiscard]] bool shouldClose() const override;
+    void setShouldClose() override { m_shouldClose = true; }
+
+    void attachInputController(std::shared_ptr<InputController> controller) override;
+    /// \brief Replay recorded input through the attached \ref InputController.
+    ///
+    /// \param replay the \ref InputReplay that provides the input events
+    void attachReplay(std::shared_ptr<InputReplay> replay) { m_replay = std::move(replay); }
+
+    /// \brief Advance to the next frame.
+    void swapBuffers() override { ++m_frame; }
+    /// \brief Feed the recorded input events of the current frame into the \ref InputController.
+    void pollEvents() override;
+
+    /// \brief Index of the current frame, which is the amount of frames presented so far.
+    [[nodiscard]] std::uint64_t frame() const noexcept { return m_frame; }
+
+private:
+    Viewport m_viewport;
+    std::optional<std::uint64_t> m_frameLimit;
+    std::uint64_t m_frame{ 0 };
+    bool m_shouldClose{ false };
+
+    std::shared_ptr<InputController> m_inputController{ nullptr };
+    std::shared_ptr<InputReplay> m_replay{ nullptr };
+};
+
+} // namespace sfa
+
+#endif // !SFA_SRC_ENGINE_UTILITY_HEADLESS_WINDOW_HPP
@@ -8,6 +8,16 @@
 namespace sfa
 {
 
+/// \brief Simple struct containing the dimensions of the window.
+///
+/// \author Felix Hommel
+/// \date 2/19/2026
+struct Viewport
+{
+    int width;
+    int height;
+};
+
 class IWindow
 {
 public:
@@ -20,8 +30,14 @@ public:
     IWindow& operator=(IWindow&&) noexcept = delete;
 
     [[nodiscard]] virtual bool shouldClose() const = 0;
+    virtual void setShouldClose() = 0;
 
     virtual void attachInputController(std::shared_ptr<InputController> controller) = 0;
+
+    /// \brief Present the frame that was rendered last.
+    virtual void swapBuffers() = 0;
+    /// \brief Process pending window and input events.
+    virtual void pollEvents() = 0;
 };
 
 } // namespace sfa
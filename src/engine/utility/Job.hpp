@@ -0,0 +1,116 @@
+#ifndef SFA_SRC_ENGINE_UTILITY_JOB_HPP
+#define SFA_SRC_ENGINE_UTILITY_JOB_HPP
+
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace sfa
+{
+
+class Job;
+
+/// \brief Size of the inline storage of a \ref Job, in bytes.
+inline constexpr std::size_t JOB_STORAGE_SIZE{ 64 };
+
+/// \brief Whether a callable of type \p F can be stored inside a \ref Job without a heap allocation.
+template<typename F>
+concept FitsInJob = !std::same_as<std::remove_cvref_t<F>, Job> && std::is_invocable_v<std::decay_t<F>&>
+                 && std::is_nothrow_move_constructible_v<std::decay_t<F>> && sizeof(std::decay_t<F>) <= JOB_STORAGE_SIZE
+                 && alignof(std::decay_t<F>) <= alignof(std::max_align_t);
+
+/// \brief Move-only `void()` callable with fixed inline storage.
+///
+/// Works like a std::move_only_function that never allocates: the callable is constructed inside the job itself,
+/// callables that don't fit are rejected at compile time. Capture pointers or references to large state instead.
+///
+/// \author Felix Hommel
+/// \date 3/15/2026
+class Job
+{
+public:
+    Job() = default;
+
+    template<typename F>
+        requires FitsInJob<F>
+    // NOLINTNEXTLINE(bugprone-forwarding-reference-overload, google-explicit-constructor): constrained, wraps lambdas
+    Job(F&& f)
+    {
+        using Fn = std::decay_t<F>;
+
+        std::construct_at(reinterpret_cast<Fn*>(m_storage.data()), std::forward<F>(f));
+        m_operations = &OPERATIONS<Fn>;
+    }
+    ~Job() { reset(); }
+
+    Job(const Job&) = delete;
+    Job& operator=(const Job&) = delete;
+
+    Job(Job&& other) noexcept { moveFrom(other); }
+    Job& operator=(Job&& other) noexcept
+    {
+        if(this != &other)
+        {
+            reset();
+            moveFrom(other);
+        }
+
+        return *this;
+    }
+
+    /// \brief Invoke the stored callable. The job must not be empty.
+    void operator()() { m_operations->invoke(m_storage.data()); }
+
+    /// \brief Destroy the stored callable, the job is empty afterwards.
+    void reset() noexcept
+    {
+        if(m_operations != nullptr)
+        {
+            m_operations->destroy(m_storage.data());
+            m_operations = nullptr;
+        }
+    }
+
+    [[nodiscard]] explicit operator bool() const noexcept { return m_operations != nullptr; }
+
+private:
+    /// \brief Type-erased operations of the stored callable.
+    struct Operations
+    {
+        void (*invoke)(void*);
+        void (*move)(void* destination, void* source) noexcept;
+        void (*destroy)(void*) noexcept;
+    };
+
+    template<typename Fn>
+    static constexpr Operations OPERATIONS{
+        .invoke = [](void* f) { (*std::launder(static_cast<Fn*>(f)))(); },
+        .move =
+            [](void* destination, void* source) noexcept {
+                auto* from{ std::launder(static_cast<Fn*>(source)) };
+                std::construct_at(static_cast<Fn*>(destination), std::move(*from));
+                std::destroy_at(from);
+            },
+        .destroy = [](void* f) noexcept { std::destroy_at(std::launder(static_cast<Fn*>(f))); },
+    };
+
+    alignas(std::max_align_t) std::array<std::byte, JOB_STORAGE_SIZE> m_storage{};
+    const Operations* m_operations{ nullptr };
+
+    void moveFrom(Job& other) noexcept
+    {
+        if(other.m_operations != nullptr)
+        {
+            other.m_operations->move(m_storage.data(), other.m_storage.data());
+            m_operations = std::exchange(other.m_operations, nullptr);
+        }
+    }
+};
+
+} // namespace sfa
+
+#endif // !SFA_SRC_ENGINE_UTILITY_JOB_HPP
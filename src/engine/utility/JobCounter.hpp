@@ -0,0 +1,110 @@
+#ifndef SFA_SRC_ENGINE_UTILITY_JOB_COUNTER_HPP
+#define SFA_SRC_ENGINE_UTILITY_JOB_COUNTER_HPP
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+
+namespace sfa
+{
+
+/// \brief Counts the outstanding jobs of a batch, a lightweight replacement for a future per job.
+///
+/// Every \ref ThreadPool::submit with a counter increments it, the worker decrements it once the job ran. Only the
+/// transitions from and to zero take the lock, so a batch of jobs costs two lock acquisitions no matter its size.
+///
+/// \note The counter may be destroyed as soon as \ref JobCounter::wait returned or \ref JobCounter::finished returned
+/// *true*, the last worker doesn't touch it afterwards.
+///
+/// \author Felix Hommel
+/// \date 3/15/2026
+class JobCounter
+{
+public:
+    JobCounter() = default;
+    ~JobCounter() = default;
+
+    JobCounter(const JobCounter&) = delete;
+    JobCounter& operator=(const JobCounter&) = delete;
+    JobCounter(JobCounter&&) = delete;
+    JobCounter& operator=(JobCounter&&) = delete;
+
+    /// \brief Register \p count new outstanding jobs.
+    void add(std::size_t count = 1)
+    {
+        auto current{ m_outstanding.load(std::memory_order_relaxed) };
+        while(current != 0)
+        {
+            if(m_outstanding.compare_exchange_weak(current, current + count, std::memory_order_acq_rel))
+                return;
+        }
+
+        // NOTE: Leaving zero only happens under the lock, so the flag is never seen finished while jobs are outstanding
+        std::lock_guard lock(m_mutex);
+
+        m_outstanding.fetch_add(count, std::memory_order_acq_rel);
+        m_finished = m_outstanding.load(std::memory_order_acquire) == 0;
+    }
+
+    /// \brief Mark one job as done, wakes up the waiters when it was the last one.
+    ///
+    /// \returns *true* if it was the last outstanding job, the counter must not be touched afterwards
+    bool done() noexcept
+    {
+        if(m_outstanding.fetch_sub(1, std::memory_order_acq_rel) != 1)
+            return false;
+
+        // NOTE: Waiters only observe the flag under the lock, so the counter outlives this critical section. Jobs added
+        // between the decrement and the lock keep the counter unfinished.
+        std::lock_guard lock(m_mutex);
+
+        m_finished = m_outstanding.load(std::memory_order_acquire) == 0;
+        if(m_finished)
+            m_signal.notify_all();
+
+        return m_finished;
+    }
+
+    /// \brief Block until every registered job is done.
+    void wait() const
+    {
+        std::unique_lock lock(m_mutex);
+
+        m_signal.wait(lock, [this]() { return m_finished; });
+    }
+
+    /// \brief Block until every registered job is done or \p deadline passed.
+    ///
+    /// \returns *true* if every registered job is done
+    bool waitUntil(std::chrono::steady_clock::time_point deadline) const
+    {
+        std::unique_lock lock(m_mutex);
+
+        return m_signal.wait_until(lock, deadline, [this]() { return m_finished; });
+    }
+
+    /// \brief Check if every registered job is done, without blocking.
+    [[nodiscard]] bool finished() const
+    {
+        std::lock_guard lock(m_mutex);
+
+        return m_finished;
+    }
+
+    /// \brief Return the amount of outstanding jobs.
+    ///
+    /// \note Returned value is a point-in-time snapshot
+    [[nodiscard]] std::size_t outstanding() const noexcept { return m_outstanding.load(std::memory_order_acquire); }
+
+private:
+    std::atomic<std::size_t> m_outstanding{ 0 };
+    mutable std::mutex m_mutex;
+    mutable std::condition_variable m_signal;
+    bool m_finished{ true };
+};
+
+} // namespace sfa
+
+#endif // !SFA_SRC_ENGINE_UTILITY_JOB_COUNTER_HPP
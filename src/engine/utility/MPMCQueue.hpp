@@ -0,0 +1,224 @@
+#ifndef SFA_SRC_ENGINE_UTILITY_MPMC_QUEUE_HPP
+#define SFA_SRC_ENGINE_UTILITY_MPMC_QUEUE_HPP
+
+#include "utility/details/WaitSignal.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <utility>
+
+namespace sfa
+{
+
+/// \brief Bounded lock-free multi-producer/multi-consumer queue.
+///
+/// A ring of cells that each carry a sequence number, as described by Dmitry Vyukov. Producers and consumers claim a
+/// position with a single CAS and then only touch their own cell, so neither side ever takes a lock. Unlike the
+/// \ref BlockingQueue it has a fixed capacity, pushing into a full queue fails instead of growing it.
+///
+/// \tparam T type of the elements, has to be move constructible
+///
+/// \author Felix Hommel
+/// \date 3/13/2026
+///
+/// \see https://www.1024cores.net/home/lock-free-algorithms/queues/bounded-mpmc-queue
+template<typename T>
+class MPMCQueue
+{
+public:
+    /// \brief Create a new \ref MPMCQueue
+    ///
+    /// \param capacity how many elements the queue can hold, rounded up to the next power of two
+    explicit MPMCQueue(std::size_t capacity)
+        : m_capacity{ std::bit_ceil(std::max<std::size_t>(capacity, 2)) }
+        , m_mask{ m_capacity - 1 }
+        , m_cells{ std::make_unique<Cell[]>(m_capacity) }
+    {
+        for(std::size_t i{ 0 }; i < m_capacity; ++i)
+            m_cells[i].sequence.store(i, std::memory_order_relaxed);
+    }
+    ~MPMCQueue()
+    {
+        // NOTE: Destroy the elements that are still queued
+        while(tryPop().has_value())
+            continue;
+    }
+
+    MPMCQueue(const MPMCQueue&) = delete;
+    MPMCQueue& operator=(const MPMCQueue&) = delete;
+    MPMCQueue(MPMCQueue&&) = delete;
+    MPMCQueue& operator=(MPMCQueue&&) = delete;
+
+    /// \brief Push a new element to the queue.
+    ///
+    /// \param value the new element
+    ///
+    /// \returns *true* if the element was pushed, *false* if the queue is full or closed
+    bool push(T value) { return emplace(std::move(value)); }
+
+    /// \brief Emplace a new element into the queue.
+    ///
+    /// \tparam Args Types of the parameters needed to construct a \p T
+    /// \param args parameters to construct a \p T
+    ///
+    /// \returns *true* if the element was emplaced, *false* if the queue is full or closed
+    template<typename... Args>
+    bool emplace(Args&&... args)
+    {
+        if(m_closed.load(std::memory_order_acquire))
+            return false;
+
+        auto position{ m_enqueuePosition.load(std::memory_order_relaxed) };
+        Cell* cell{ nullptr };
+
+        for(;;)
+        {
+            cell = &m_cells[position & m_mask];
+            const auto sequence{ cell->sequence.load(std::memory_order_acquire) };
+            const auto difference{ static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(position) };
+
+            if(difference == 0)
+            {
+                if(m_enqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                    break;
+            }
+            else if(difference < 0)
+                return false;
+            else
+                position = m_enqueuePosition.load(std::memory_order_relaxed);
+        }
+
+        std::construct_at(&cell->value, std::forward<Args>(args)...);
+        cell->sequence.store(position + 1, std::memory_order_release);
+
+        m_signal.notifyOne();
+
+        return true;
+    }
+
+    /// \brief Try to take an element out of the queue.
+    ///
+    /// \returns optional containing the front queue value, empty optional if the queue is empty
+    [[nodiscard]] std::optional<T> tryPop()
+    {
+        auto position{ m_dequeuePosition.load(std::memory_order_relaxed) };
+        Cell* cell{ nullptr };
+
+        for(;;)
+        {
+            cell = &m_cells[position & m_mask];
+            const auto sequence{ cell->sequence.load(std::memory_order_acquire) };
+            const auto difference{ static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(position + 1) };
+
+            if(difference == 0)
+            {
+                if(m_dequeuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                    break;
+            }
+            else if(difference < 0)
+                return std::nullopt;
+            else
+                position = m_dequeuePosition.load(std::memory_order_relaxed);
+        }
+
+        std::optional<T> value{ std::move(cell->value) };
+        std::destroy_at(&cell->value);
+        cell->sequence.store(position + m_capacity, std::memory_order_release);
+
+        return value;
+    }
+
+    /// \brief Take an element out of the queue. Sleep until there is one if the queue is empty.
+    ///
+    /// \returns optional containing the front queue value, empty optional if the queue was closed and is drained
+    [[nodiscard]] std::optional<T> waitAndPop()
+    {
+        for(;;)
+        {
+            if(auto value{ tryPop() })
+                return value;
+            if(m_closed.load(std::memory_order_acquire))
+                return tryPop();
+
+            const auto ticket{ m_signal.prepareWait() };
+
+            if(auto value{ tryPop() })
+            {
+                m_signal.cancelWait();
+                return value;
+            }
+            if(m_closed.load(std::memory_order_acquire))
+            {
+                m_signal.cancelWait();
+                return tryPop();
+            }
+
+            m_signal.wait(ticket);
+        }
+    }
+
+    /// \brief Close the queue. Further pushes fail, elements that are already queued can still be popped.
+    void close()
+    {
+        m_closed.store(true, std::memory_order_release);
+        m_signal.notifyAll();
+    }
+
+    /// \brief Check if the queue is empty.
+    ///
+    /// \note Returned value is a point-in-time snapshot
+    [[nodiscard]] bool empty() const noexcept { return size() == 0; }
+
+    /// \brief Return the amount of enqueued elements.
+    ///
+    /// \note Returned value is a point-in-time snapshot
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        const auto dequeued{ m_dequeuePosition.load(std::memory_order_acquire) };
+        const auto enqueued{ m_enqueuePosition.load(std::memory_order_acquire) };
+
+        return enqueued > dequeued ? enqueued - dequeued : 0;
+    }
+
+    [[nodiscard]] std::size_t capacity() const noexcept { return m_capacity; }
+    [[nodiscard]] bool closed() const noexcept { return m_closed.load(std::memory_order_acquire); }
+
+private:
+    static constexpr std::size_t CACHE_LINE{ 64 };
+
+    /// \brief A slot of the ring. The value is only alive while the sequence marks the cell as filled.
+    struct Cell
+    {
+        Cell() {}  // NOLINT(modernize-use-equals-default): the union member must not be constructed
+        ~Cell() {} // NOLINT(modernize-use-equals-default): the value is destroyed by the queue
+
+        Cell(const Cell&) = delete;
+        Cell& operator=(const Cell&) = delete;
+        Cell(Cell&&) = delete;
+        Cell& operator=(Cell&&) = delete;
+
+        std::atomic<std::size_t> sequence;
+        union
+        {
+            T value;
+        };
+    };
+
+    const std::size_t m_capacity;
+    const std::size_t m_mask;
+    const std::unique_ptr<Cell[]> m_cells;
+
+    // NOTE: Producers and consumers spin on different positions, keep them on separate cache lines
+    alignas(CACHE_LINE) std::atomic<std::size_t> m_enqueuePosition{ 0 };
+    alignas(CACHE_LINE) std::atomic<std::size_t> m_dequeuePosition{ 0 };
+    alignas(CACHE_LINE) std::atomic<bool> m_closed{ false };
+    details::WaitSignal m_signal;
+};
+
+} // namespace sfa
+
+#endif // !SFA_SRC_ENGINE_UTILITY_MPMC_QUEUE_HPP
@@ -0,0 +1,197 @@
+#ifndef SFA_SRC_ENGINE_UTILITY_SPSC_QUEUE_HPP
+#define SFA_SRC_ENGINE_UTILITY_SPSC_QUEUE_HPP
+
+#include "utility/details/WaitSignal.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <utility>
+
+namespace sfa
+{
+
+/// \brief Bounded lock-free single-producer/single-consumer queue.
+///
+/// Same surface as the \ref MPMCQueue, but only one thread may push and only one thread may pop at a time. That
+/// removes every CAS: both sides only store their own position and read the other side's, which they additionally
+/// cache so the shared cache line is only touched when the cached value runs out.
+///
+/// \tparam T type of the elements, has to be move constructible
+///
+/// \author Felix Hommel
+/// \date 3/13/2026
+template<typename T>
+class SPSCQueue
+{
+public:
+    /// \brief Create a new \ref SPSCQueue
+    ///
+    /// \param capacity how many elements the queue can hold, rounded up to the next power of two
+    explicit SPSCQueue(std::size_t capacity)
+        : m_capacity{ std::bit_ceil(std::max<std::size_t>(capacity, 1)) }
+        , m_mask{ m_capacity - 1 }
+        , m_slots{ std::make_unique<Slot[]>(m_capacity) }
+    {}
+    ~SPSCQueue()
+    {
+        // NOTE: Destroy the elements that are still queued
+        while(tryPop().has_value())
+            continue;
+    }
+
+    SPSCQueue(const SPSCQueue&) = delete;
+    SPSCQueue& operator=(const SPSCQueue&) = delete;
+    SPSCQueue(SPSCQueue&&) = delete;
+    SPSCQueue& operator=(SPSCQueue&&) = delete;
+
+    /// \brief Push a new element to the queue. Must only be called by the producer.
+    ///
+    /// \param value the new element
+    ///
+    /// \returns *true* if the element was pushed, *false* if the queue is full or closed
+    bool push(T value) { return emplace(std::move(value)); }
+
+    /// \brief Emplace a new element into the queue. Must only be called by the producer.
+    ///
+    /// \tparam Args Types of the parameters needed to construct a \p T
+    /// \param args parameters to construct a \p T
+    ///
+    /// \returns *true* if the element was emplaced, *false* if the queue is full or closed
+    template<typename... Args>
+    bool emplace(Args&&... args)
+    {
+        if(m_closed.load(std::memory_order_acquire))
+            return false;
+
+        const auto tail{ m_tail.load(std::memory_order_relaxed) };
+        if(tail - m_cachedHead == m_capacity)
+        {
+            m_cachedHead = m_head.load(std::memory_order_acquire);
+            if(tail - m_cachedHead == m_capacity)
+                return false;
+        }
+
+        std::construct_at(&m_slots[tail & m_mask].value, std::forward<Args>(args)...);
+        m_tail.store(tail + 1, std::memory_order_release);
+
+        m_signal.notifyOne();
+
+        return true;
+    }
+
+    /// \brief Try to take an element out of the queue. Must only be called by the consumer.
+    ///
+    /// \returns optional containing the front queue value, empty optional if the queue is empty
+    [[nodiscard]] std::optional<T> tryPop()
+    {
+        const auto head{ m_head.load(std::memory_order_relaxed) };
+        if(head == m_cachedTail)
+        {
+            m_cachedTail = m_tail.load(std::memory_order_acquire);
+            if(head == m_cachedTail)
+                return std::nullopt;
+        }
+
+        auto& slot{ m_slots[head & m_mask] };
+        std::optional<T> value{ std::move(slot.value) };
+        std::destroy_at(&slot.value);
+        m_head.store(head + 1, std::memory_order_release);
+
+        return value;
+    }
+
+    /// \brief Take an element out of the queue. Sleep until there is one if the queue is empty.
+    ///
+    /// \returns optional containing the front queue value, empty optional if the queue was closed and is drained
+    [[nodiscard]] std::optional<T> waitAndPop()
+    {
+        for(;;)
+        {
+            if(auto value{ tryPop() })
+                return value;
+            if(m_closed.load(std::memory_order_acquire))
+                return tryPop();
+
+            const auto ticket{ m_signal.prepareWait() };
+
+            if(auto value{ tryPop() })
+            {
+                m_signal.cancelWait();
+                return value;
+            }
+            if(m_closed.load(std::memory_order_acquire))
+            {
+                m_signal.cancelWait();
+                return tryPop();
+            }
+
+            m_signal.wait(ticket);
+        }
+    }
+
+    /// \brief Close the queue. Further pushes fail, elements that are already queued can still be popped.
+    void close()
+    {
+        m_closed.store(true, std::memory_order_release);
+        m_signal.notifyAll();
+    }
+
+    /// \brief Check if the queue is empty.
+    ///
+    /// \note Returned value is a point-in-time snapshot
+    [[nodiscard]] bool empty() const noexcept { return size() == 0; }
+
+    /// \brief Return the amount of enqueued elements.
+    ///
+    /// \note Returned value is a point-in-time snapshot
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        const auto head{ m_head.load(std::memory_order_acquire) };
+        const auto tail{ m_tail.load(std::memory_order_acquire) };
+
+        return tail > head ? tail - head : 0;
+    }
+
+    [[nodiscard]] std::size_t capacity() const noexcept { return m_capacity; }
+    [[nodiscard]] bool closed() const noexcept { return m_closed.load(std::memory_order_acquire); }
+
+private:
+    static constexpr std::size_t CACHE_LINE{ 64 };
+
+    /// \brief A slot of the ring. The value is only alive between the head and the tail.
+    struct Slot
+    {
+        Slot() {}  // NOLINT(modernize-use-equals-default): the union member must not be constructed
+        ~Slot() {} // NOLINT(modernize-use-equals-default): the value is destroyed by the queue
+
+        Slot(const Slot&) = delete;
+        Slot& operator=(const Slot&) = delete;
+        Slot(Slot&&) = delete;
+        Slot& operator=(Slot&&) = delete;
+
+        union
+        {
+            T value;
+        };
+    };
+
+    const std::size_t m_capacity;
+    const std::size_t m_mask;
+    const std::unique_ptr<Slot[]> m_slots;
+
+    // NOTE: Each side owns one cache line: its own position and its cached copy of the other side's position
+    alignas(CACHE_LINE) std::atomic<std::size_t> m_tail{ 0 };
+    std::size_t m_cachedHead{ 0 };
+    alignas(CACHE_LINE) std::atomic<std::size_t> m_head{ 0 };
+    std::size_t m_cachedTail{ 0 };
+    alignas(CACHE_LINE) std::atomic<bool> m_closed{ false };
+    details::WaitSignal m_signal;
+};
+
+} // namespace sfa
+
+#endif // !SFA_SRC_ENGINE_UTILITY_SPSC_QUEUE_HPP
@@ -0,0 +1,135 @@
+#include "TaskGroup.hpp"
+
+#include "core/Utility.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace sfa
+{
+
+bool TaskHandle::finished() const
+{
+    SFA_ASSERT(valid(), "Can't query an empty task handle");
+
+    std::lock_guard lock(m_node->mutex);
+
+    return m_node->finished;
+}
+
+TaskGroup::~TaskGroup()
+{
+    wait();
+}
+
+TaskHandle TaskGroup::run(std::move_only_function<void()> task, TaskAffinity affinity, JobOptions options)
+{
+    auto node{ makeNode(std::move(task), affinity, std::move(options)) };
+    node->predecessors.store(0, std::memory_order_relaxed);
+
+    dispatch(node);
+
+    return TaskHandle{ std::move(node) };
+}
+
+TaskHandle TaskGroup::runAfter(
+    std::span<const TaskHandle> predecessors,
+    std::move_only_function<void()> task,
+    TaskAffinity affinity,
+    JobOptions options
+)
+{
+    auto node{ makeNode(std::move(task), affinity, std::move(options)) };
+    node->predecessors.store(predecessors.size() + 1, std::memory_order_relaxed);
+
+    for(const auto& predecessor : predecessors)
+    {
+        SFA_ASSERT(predecessor.valid(), "Can't depend on an empty task handle");
+        SFA_ASSERT(predecessor.m_node->group == this, "Tasks can only depend on tasks of the same group");
+
+        std::lock_guard lock(predecessor.m_node->mutex);
+
+        if(predecessor.m_node->finished)
+            node->predecessors.fetch_sub(1, std::memory_order_relaxed);
+        else
+            predecessor.m_node->successors.push_back(node);
+    }
+
+    // NOTE: Release the extra count, whoever drops it to zero schedules the task
+    if(node->predecessors.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        dispatch(node);
+
+    return TaskHandle{ std::move(node) };
+}
+
+std::shared_ptr<details::TaskNode> TaskGroup::makeNode(
+    std::move_only_function<void()> task, TaskAffinity affinity, JobOptions options
+) const
+{
+    auto node{ std::make_shared<details::TaskNode>() };
+    node->function = std::move(task);
+    node->affinity = affinity;
+    node->options = std::move(options);
+    node->group = this;
+
+    return node;
+}
+
+/// \brief Hand a task whose predecessors all ran to the pool.
+///
+/// The counter is incremented before the predecessor that scheduled it is done, so it never drops to zero in between.
+void TaskGroup::dispatch(std::shared_ptr<details::TaskNode> node)
+{
+    const auto affinity{ node->affinity };
+    const auto options{ node->options };
+    auto job{ [this, node = std::move(node)]() { execute(node); } };
+
+    if(affinity == TaskAffinity::MainThread)
+        m_pool.submitToMainThread(m_counter, options, std::move(job));
+    else
+        m_pool.submit(m_counter, options, std::move(job));
+}
+
+/// \brief Run a task and schedule its successors, even if it threw.
+void TaskGroup::execute(const std::shared_ptr<details::TaskNode>& node)
+{
+    try
+    {
+        node->function();
+    }
+    catch(...)
+    {
+        complete(*node);
+        throw;
+    }
+
+    complete(*node);
+}
+
+void TaskGroup::complete(details::TaskNode& node)
+{
+    // NOTE: Drop the captures right away, a finished task may stay referenced by handles for a long time
+    node.function = nullptr;
+
+    std::vector<std::shared_ptr<details::TaskNode>> successors;
+    {
+        std::lock_guard lock(node.mutex);
+
+        node.finished = true;
+        successors.swap(node.successors);
+    }
+
+    for(auto& successor : successors)
+    {
+        if(successor->predecessors.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            dispatch(std::move(successor));
+    }
+}
+
+} // namespace sfa
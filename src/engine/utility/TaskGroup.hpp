@@ -0,0 +1,169 @@
+#ifndef SFA_SRC_ENGINE_UTILITY_TASK_GROUP_HPP
+#define SFA_SRC_ENGINE_UTILITY_TASK_GROUP_HPP
+
+#include "utility/JobCounter.hpp"
+#include "utility/ThreadPool.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace sfa
+{
+
+class TaskGroup;
+
+/// \brief Where a task of a \ref TaskGroup runs.
+enum class TaskAffinity : std::uint8_t
+{
+    Worker,
+    MainThread
+};
+
+namespace details
+{
+
+/// \brief A task of a \ref TaskGroup together with its edges in the dependency graph.
+///
+/// \author Felix Hommel
+/// \date 3/16/2026
+struct TaskNode
+{
+    std::move_only_function<void()> function;
+    TaskAffinity affinity{ TaskAffinity::Worker };
+    JobOptions options;
+    const TaskGroup* group{ nullptr };
+    /// \brief Unfinished predecessors, plus one while the task is still being linked.
+    std::atomic<std::size_t> predecessors{ 1 };
+
+    std::mutex mutex;
+    std::vector<std::shared_ptr<TaskNode>> successors;
+    bool finished{ false };
+};
+
+} // namespace details
+
+/// \brief Refers to a task of a \ref TaskGroup, used to declare dependencies on it.
+///
+/// \author Felix Hommel
+/// \date 3/16/2026
+class TaskHandle
+{
+public:
+    TaskHandle() = default;
+
+    [[nodiscard]] bool valid() const noexcept { return m_node != nullptr; }
+    /// \brief Check if the task ran, its successors are scheduled by then.
+    [[nodiscard]] bool finished() const;
+
+private:
+    friend class TaskGroup;
+
+    std::shared_ptr<details::TaskNode> m_node;
+
+    explicit TaskHandle(std::shared_ptr<details::TaskNode> node) : m_node(std::move(node)) {}
+};
+
+/// \brief A set of tasks on a \ref ThreadPool that can depend on each other and be waited for as a whole.
+///
+/// A task is scheduled once all of its predecessors ran, by the thread that ran the last of them, so a chain of tasks
+/// never goes through a central queue. Tasks with \ref TaskAffinity::MainThread are handed to the main thread of the
+/// pool instead of a worker, which makes a continuation like "decode on a worker, upload on the GL thread" a single
+/// edge. A task whose predecessor threw still runs, the pool only logs the exception. A task that is dropped through
+/// the stop token of its \ref JobOptions never runs, and neither do its successors.
+///
+/// \note Dependencies may only point to tasks of the same group, otherwise \ref TaskGroup::wait could return before
+/// the dependent task was scheduled.
+///
+/// \author Felix Hommel
+/// \date 3/16/2026
+class TaskGroup
+{
+public:
+    /// \brief Create a new \ref TaskGroup
+    ///
+    /// \param pool thread pool the tasks run on, has to outlive the group
+    explicit TaskGroup(ThreadPool& pool) : m_pool(pool) {}
+    /// \brief Waits for all tasks of the group.
+    ~TaskGroup();
+
+    TaskGroup(const TaskGroup&) = delete;
+    TaskGroup& operator=(const TaskGroup&) = delete;
+    TaskGroup(TaskGroup&&) = delete;
+    TaskGroup& operator=(TaskGroup&&) = delete;
+
+    /// \brief Schedule a task right away.
+    ///
+    /// \param task function that is run
+    /// \param affinity (optional) which thread the task runs on
+    /// \param options (optional) priority and stop token of the task
+    ///
+    /// \returns handle to declare dependencies on the task
+    TaskHandle run(
+        std::move_only_function<void()> task, TaskAffinity affinity = TaskAffinity::Worker, JobOptions options = {}
+    );
+
+    /// \brief Schedule a task once all \p predecessors ran.
+    ///
+    /// \param predecessors tasks of this group that have to run first, finished ones are ignored
+    /// \param task function that is run
+    /// \param affinity (optional) which thread the task runs on
+    /// \param options (optional) priority and stop token of the task
+    ///
+    /// \returns handle to declare dependencies on the task
+    TaskHandle runAfter(
+        std::span<const TaskHandle> predecessors,
+        std::move_only_function<void()> task,
+        TaskAffinity affinity = TaskAffinity::Worker,
+        JobOptions options = {}
+    );
+    TaskHandle runAfter(
+        std::initializer_list<TaskHandle> predecessors,
+        std::move_only_function<void()> task,
+        TaskAffinity affinity = TaskAffinity::Worker,
+        JobOptions options = {}
+    )
+    {
+        return runAfter(
+            std::span{ predecessors.begin(), predecessors.size() }, std::move(task), affinity, std::move(options)
+        );
+    }
+
+    /// \brief Block until every task of the group ran, see \ref ThreadPool::wait.
+    void wait() { m_pool.wait(m_counter); }
+    /// \brief Block until every task of the group ran or \p timeout passed, see \ref ThreadPool::waitFor.
+    ///
+    /// \returns *true* if every task of the group ran
+    bool waitFor(std::chrono::nanoseconds timeout) { return m_pool.waitFor(m_counter, timeout); }
+    /// \brief Sleep until a main-thread task is ready, every task ran or \p deadline passed, see
+    /// \ref ThreadPool::waitForMainThreadJobs.
+    bool waitForMainThreadTasks(std::chrono::steady_clock::time_point deadline)
+    {
+        return m_pool.waitForMainThreadJobs(m_counter, deadline);
+    }
+    /// \brief Check if every task of the group ran, without blocking.
+    [[nodiscard]] bool finished() const { return m_counter.finished(); }
+
+private:
+    ThreadPool& m_pool;
+    JobCounter m_counter;
+
+    std::shared_ptr<details::TaskNode> makeNode(
+        std::move_only_function<void()> task, TaskAffinity affinity, JobOptions options
+    ) const;
+    void dispatch(std::shared_ptr<details::TaskNode> node);
+    void execute(const std::shared_ptr<details::TaskNode>& node);
+    void complete(details::TaskNode& node);
+};
+
+} // namespace sfa
+
+#endif // !SFA_SRC_ENGINE_UTILITY_TASK_GROUP_HPP
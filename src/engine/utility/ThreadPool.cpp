@@ -1,28 +1,67 @@
 #include "ThreadPool.hpp"
 
+#include "core/Profiler.hpp"
+#include "core/Utility.hpp"
 #include "utility/details/Threading.hpp"
 
 #include <spdlog/spdlog.h>
 
+#include <array>
+#include <atomic>
+#include <chrono>
 #include <cstddef>
+#include <cstdint>
 #include <exception>
-#include <functional>
+#include <memory>
 #include <mutex>
-#include <queue>
+#include <thread>
 #include <utility>
 
 namespace sfa
 {
 
+namespace
+{
+
+/// \brief Rounds a worker spins (yielding) without finding work before it parks.
+constexpr std::size_t IDLE_ROUNDS{ 64 };
+/// \brief Most jobs a worker takes from the injection queue at once, the surplus can be stolen from its deque.
+constexpr std::size_t INJECT_BATCH{ 16 };
+
+/// \brief Pool and index of the worker the current thread is, *nullptr* on threads that aren't workers.
+thread_local const void* t_pool{ nullptr };
+thread_local std::size_t t_workerIndex{ 0 };
+
+/// \brief xorshift64, good enough to pick steal victims without sharing state between workers.
+std::uint64_t nextRandom(std::uint64_t& state) noexcept
+{
+    // NOLINTBEGIN(readability-magic-numbers): xorshift shift constants
+    state ^= state << 13;
+    state ^= state >> 7;
+    state ^= state << 17;
+    // NOLINTEND(readability-magic-numbers)
+
+    return state;
+}
+
+} // namespace
+
 ThreadPool::ThreadPool(std::size_t nThreads)
 {
     if(nThreads < 1)
         nThreads = 1;
 
-    m_workers.reserve(nThreads);
+    // NOTE: All deques have to exist before the first worker starts stealing
+    m_queues.reserve(nThreads);
+    for(std::size_t i{ 0 }; i < nThreads; ++i)
+    {
+        m_queues.push_back(std::make_unique<WorkerQueue>());
+        m_queues.back()->rng = 0x9E3779B97F4A7C15ull * (i + 1); // NOLINT(readability-magic-numbers): golden ratio
+    }
 
+    m_workers.reserve(nThreads);
     for(std::size_t i{ 0 }; i < nThreads; ++i)
-        m_workers.emplace_back([this](threading::stop_token_t st) { worker(st); });
+        m_workers.emplace_back([this, i](threading::stop_token_t st) { worker(st, i); });
 }
 
 ThreadPool::~ThreadPool()
@@ -32,77 +71,394 @@ ThreadPool::~ThreadPool()
 
 void ThreadPool::shutdown(bool drainQueue) noexcept
 {
-    if(drainQueue)
+    if(m_stopped.exchange(true, std::memory_order_acq_rel))
+        return;
+
+    m_draining.store(drainQueue, std::memory_order_release);
+
+    for(auto& worker : m_workers)
+        worker.request_stop();
+
+    m_signal.notifyAll();
+
+    // NOTE: join by destruction. Allows currently running tasks to finish running. When draining, the workers only
+    // exit once there is no job left anywhere.
+    m_workers.clear();
+
+    // NOTE: Cancel whatever is left, the workers are gone so the deques can be popped from this thread
+    for(auto& queue : m_queues)
     {
-        std::unique_lock lock(m_mutex);
-        m_draining = true;
-        m_drainingComplete.wait(lock, [this]() { return m_queue.empty(); });
+        for(auto& deque : queue->deques)
+        {
+            while(const auto slot{ deque.pop() })
+                cancel(*slot);
+        }
     }
-    else
+    for(std::size_t lane{ 0 }; lane < JOB_PRIORITY_COUNT; ++lane)
     {
-        std::lock_guard lock(m_mutex);
+        auto& inject{ m_inject[lane] };
+        while(inject.head != nullptr)
+            cancel(std::exchange(inject.head, inject.head->next));
+        inject.tail = nullptr;
 
-        // NOTE: Easy way to clear the queue, canceling pending jobs
-        std::queue<std::function<void()>> emptyQueue;
-        std::swap(m_queue, emptyQueue);
+        m_injected[lane].store(0, std::memory_order_release);
     }
+    while(const auto slot{ m_mainThreadQueue.tryPop() })
+        cancel(*slot);
 
-    for(auto& worker : m_workers)
-        worker.request_stop();
+    m_pending.store(0, std::memory_order_release);
+}
 
-    m_signal.notify_all();
+bool ThreadPool::isWorkerThread() const noexcept
+{
+    return t_pool == this;
+}
 
-    // NOTE: join by destruction. Allows currently running tasks to finish running
-    m_workers.clear();
+std::size_t ThreadPool::runMainThreadJobs(std::size_t maxJobs)
+{
+    SFA_ASSERT(isMainThread(), "Main thread jobs must only be run by the thread that created the pool");
+
+    // NOTE: Borrow the buffer, a main thread job may itself run main thread jobs while waiting
+    auto batch{ std::move(m_mainThreadBatch) };
+    batch.clear();
+
+    const auto count{ m_mainThreadQueue.drainInto(batch, maxJobs) };
+    for(auto* slot : batch)
+        run(slot);
+
+    batch.clear();
+    m_mainThreadBatch = std::move(batch);
+
+    return count;
 }
 
-/// \brief Wrapper function that invokes the enqueued tasks
-void ThreadPool::worker(threading::stop_token_t st)
+bool ThreadPool::waitUntil(const JobCounter& counter, std::chrono::steady_clock::time_point deadline)
 {
+    using Clock = std::chrono::steady_clock;
+
+    const auto unlimited{ deadline == Clock::time_point::max() };
+    const auto expired{ [unlimited, deadline]() { return !unlimited && Clock::now() >= deadline; } };
+
+    if(isWorkerThread())
+    {
+        while(!counter.finished())
+        {
+            if(expired())
+                return false;
+
+            if(auto* slot{ findJob(t_workerIndex) })
+                run(slot);
+            else
+                std::this_thread::yield();
+        }
+
+        return true;
+    }
+
+    if(!isMainThread())
+    {
+        if(!unlimited)
+            return counter.waitUntil(deadline);
+
+        counter.wait();
+        return true;
+    }
+
+    for(;;)
+    {
+        runMainThreadJobs();
+        if(counter.finished())
+            return true;
+        if(expired())
+            return false;
+
+        if(!waitForMainThreadJobs(counter, deadline))
+            return counter.finished();
+    }
+}
+
+bool ThreadPool::waitForMainThreadJobs(const JobCounter& counter, std::chrono::steady_clock::time_point deadline)
+{
+    SFA_ASSERT(isMainThread(), "Only the main thread can wait for main thread jobs");
+
     for(;;)
     {
-        std::function<void()> job;
+        std::unique_lock lock(m_mainThreadMutex);
+        const auto epoch{ m_mainThreadEpoch };
+        lock.unlock();
+
+        // NOTE: Producers publish before they bump the epoch, anything this check misses wakes up the wait below
+        if(counter.finished() || !m_mainThreadQueue.empty())
+            return true;
+
+        lock.lock();
+        const auto woken{ [this, epoch]() { return m_mainThreadEpoch != epoch; } };
+        if(deadline == std::chrono::steady_clock::time_point::max())
+            m_mainThreadWakeup.wait(lock, woken);
+        else if(!m_mainThreadWakeup.wait_until(lock, deadline, woken))
+            return false;
+    }
+}
+
+/// \brief Hand a job to the workers: the local deque on a worker thread, the injection queue otherwise.
+void ThreadPool::schedule(Job&& job, JobCounter* counter, const JobOptions& options)
+{
+    // NOTE: Running jobs may still spawn follow-up jobs while the pool drains, they are cancelled otherwise
+    SFA_ASSERT(
+        !m_stopped.load(std::memory_order_acquire) || isWorkerThread(), "Can't enqueue on a stopped thread pool"
+    );
+
+    auto* slot{ details::JobSlotAllocator::instance().acquire() };
+    slot->job = std::move(job);
+    slot->counter = counter;
+    slot->stopToken = options.stopToken;
+
+    m_pending.fetch_add(1, std::memory_order_acq_rel);
+
+    const auto lane{ static_cast<std::size_t>(options.priority) };
+    if(isWorkerThread())
+        m_queues[t_workerIndex]->deques[lane].push(slot);
+    else
+    {
+        std::lock_guard lock(m_injectMutex);
+
+        auto& inject{ m_inject[lane] };
+        if(inject.tail != nullptr)
+            inject.tail->next = slot;
+        else
+            inject.head = slot;
+        inject.tail = slot;
+
+        m_injected[lane].fetch_add(1, std::memory_order_release);
+    }
+
+    m_signal.notifyOne();
+}
+
+/// \brief Hand a job to the main thread and wake it up if it waits.
+void ThreadPool::scheduleOnMainThread(Job&& job, JobCounter* counter, threading::stop_token_t stopToken)
+{
+    SFA_ASSERT(
+        !m_stopped.load(std::memory_order_acquire) || isWorkerThread(), "Can't enqueue on a stopped thread pool"
+    );
+
+    auto* slot{ details::JobSlotAllocator::instance().acquire() };
+    slot->job = std::move(job);
+    slot->counter = counter;
+    slot->stopToken = std::move(stopToken);
 
+    m_mainThreadQueue.push(slot);
+    wakeMainThread();
+}
+
+/// \brief Find the next job for worker \p index, from the highest lane that has one.
+///
+/// Every \ref ThreadPool::STARVATION_INTERVAL -th pick starts at the lowest lane instead.
+///
+/// \returns the job, *nullptr* if there is no work anywhere
+ThreadPool::JobSlot* ThreadPool::findJob(std::size_t index)
+{
+    auto& queue{ *m_queues[index] };
+    const auto reversed{ queue.picks % STARVATION_INTERVAL == STARVATION_INTERVAL - 1 };
+
+    for(std::size_t i{ 0 }; i < JOB_PRIORITY_COUNT; ++i)
+    {
+        const auto lane{ reversed ? JOB_PRIORITY_COUNT - 1 - i : i };
+        if(auto* slot{ findJob(index, lane) })
         {
-            std::unique_lock lock(m_mutex);
-            m_signal.wait(lock, [&]() { return st.stop_requested() || !m_queue.empty(); });
+            ++queue.picks;
+            m_pending.fetch_sub(1, std::memory_order_acq_rel);
+
+            return slot;
+        }
+    }
+
+    return nullptr;
+}
 
-            // NOTE:
-            // If queue is in draining mode, finish the current queue
-            // If not in draining mode and stopped, exit immediately
-            if(st.stop_requested() && (m_queue.empty() || !m_draining))
-            {
-                if(m_queue.empty())
-                    m_drainingComplete.notify_all();
+/// \brief Find the next job of \p lane for worker \p index: own deque first, then the injection queue, then the other
+/// workers.
+ThreadPool::JobSlot* ThreadPool::findJob(std::size_t index, std::size_t lane)
+{
+    if(const auto local{ m_queues[index]->deques[lane].pop() })
+        return *local;
+
+    if(m_injected[lane].load(std::memory_order_acquire) > 0)
+    {
+        if(auto* slot{ takeInjected(index, lane) })
+            return slot;
+    }
+
+    return steal(index, lane);
+}
 
-                return;
-            }
+/// \brief Take a batch of jobs from the injection queue of \p lane.
+///
+/// The first job is returned, the rest goes to the own deque in reverse so it is popped in submission order and idle
+/// workers can steal from it.
+ThreadPool::JobSlot* ThreadPool::takeInjected(std::size_t index, std::size_t lane)
+{
+    std::size_t taken{ 0 };
+    std::array<JobSlot*, INJECT_BATCH> batch{};
 
-            if(m_queue.empty())
-                continue;
+    {
+        std::lock_guard lock(m_injectMutex);
 
-            job = std::move(m_queue.front());
-            m_queue.pop();
+        auto& inject{ m_inject[lane] };
+        while(inject.head != nullptr && taken < INJECT_BATCH)
+        {
+            auto* slot{ inject.head };
+            inject.head = slot->next;
+            slot->next = nullptr;
 
-            // NOTE: Notify drain completion checker if the queue became empty
-            if(m_queue.empty() && m_draining)
-                m_drainingComplete.notify_all();
+            batch[taken++] = slot;
         }
+        if(inject.head == nullptr)
+            inject.tail = nullptr;
+
+        m_injected[lane].fetch_sub(taken, std::memory_order_release);
+    }
+
+    if(taken == 0)
+        return nullptr;
+
+    for(auto i{ taken - 1 }; i > 0; --i)
+        m_queues[index]->deques[lane].push(batch[i]);
+
+    if(taken > 1)
+        m_signal.notifyOne();
+
+    return batch[0];
+}
+
+/// \brief Try to steal a job of \p lane from the other workers, starting at a random victim.
+ThreadPool::JobSlot* ThreadPool::steal(std::size_t index, std::size_t lane)
+{
+    const auto count{ m_queues.size() };
+    if(count < 2)
+        return nullptr;
+
+    const auto start{ nextRandom(m_queues[index]->rng) % count };
+    for(std::size_t i{ 0 }; i < count; ++i)
+    {
+        const auto victim{ (start + i) % count };
+        if(victim == index)
+            continue;
+
+        if(const auto job{ m_queues[victim]->deques[lane].steal() })
+            return *job;
+    }
+
+    return nullptr;
+}
+
+/// \brief Run a job and recycle its slot afterwards, exceptions are logged and swallowed.
+///
+/// A job whose stop was requested while it was queued is dropped instead.
+void ThreadPool::run(JobSlot* slot)
+{
+    if(slot->stopToken.stop_requested())
+    {
+        cancel(slot);
+        return;
+    }
+
+    auto* counter{ slot->counter };
 
-        try
+    try
+    {
+        SFA_PROFILE_SCOPE("ThreadPool::job");
+
+        slot->job();
+    }
+    catch(const std::exception& e)
+    {
+        spdlog::error("ThreadPool worker caught exception: {}", e.what());
+    }
+    catch(...)
+    {
+        spdlog::error("ThreadPool worker caught unknown exception");
+    }
+
+    details::JobSlotAllocator::instance().release(slot);
+    complete(counter);
+}
+
+/// \brief Drop a job without running it, its counter still gets notified so nobody waits for it forever.
+void ThreadPool::cancel(JobSlot* slot) noexcept
+{
+    auto* counter{ slot->counter };
+
+    details::JobSlotAllocator::instance().release(slot);
+    complete(counter);
+}
+
+/// \brief Mark a job of \p counter as done, wakes up the main thread if it waits for the counter.
+void ThreadPool::complete(JobCounter* counter) noexcept
+{
+    if(counter != nullptr && counter->done())
+        wakeMainThread();
+}
+
+/// \brief Wake up the main thread if it sleeps in \ref ThreadPool::waitUntil.
+void ThreadPool::wakeMainThread() noexcept
+{
+    {
+        std::lock_guard lock(m_mainThreadMutex);
+
+        ++m_mainThreadEpoch;
+    }
+
+    m_mainThreadWakeup.notify_all();
+}
+
+/// \brief Wrapper function that invokes the enqueued tasks
+void ThreadPool::worker(threading::stop_token_t st, std::size_t index)
+{
+    SFA_PROFILE_THREAD_NAME("ThreadPool worker");
+
+    t_pool = this;
+    t_workerIndex = index;
+
+    std::size_t idleRounds{ 0 };
+    for(;;)
+    {
+        // NOTE:
+        // If pool is in draining mode, finish all jobs that are left
+        // If not in draining mode and stopped, exit immediately
+        if(st.stop_requested() && !m_draining.load(std::memory_order_acquire))
+            return;
+
+        if(auto* slot{ findJob(index) })
         {
-            job();
+            run(slot);
+            idleRounds = 0;
+
+            continue;
         }
-        catch(const std::exception& e)
+
+        if(st.stop_requested())
+            return;
+
+        // NOTE: Back off for a few rounds before parking, new work often arrives right after the last job finished
+        if(idleRounds < IDLE_ROUNDS)
         {
-            spdlog::error("ThreadPool worker caught exception: {}", e.what());
+            ++idleRounds;
+            std::this_thread::yield();
+
+            continue;
         }
-        catch(...)
+
+        const auto ticket{ m_signal.prepareWait() };
+        if(st.stop_requested() || m_pending.load(std::memory_order_acquire) > 0)
         {
-            spdlog::error("ThreadPool worker caught unknown exception");
+            m_signal.cancelWait();
+            continue;
         }
+
+        m_signal.wait(ticket);
+        idleRounds = 0;
     }
 }
 
 } // namespace sfa
-
@@ -1,17 +1,24 @@
 #ifndef SFA_SRC_ENGINE_UTILITY_THREAD_POOL_HPP
 #define SFA_SRC_ENGINE_UTILITY_THREAD_POOL_HPP
 
-#include "core/Utility.hpp"
+#include "utility/BlockingQueue.hpp"
+#include "utility/Job.hpp"
+#include "utility/JobCounter.hpp"
+#include "utility/details/JobSlotAllocator.hpp"
 #include "utility/details/Threading.hpp"
+#include "utility/details/WaitSignal.hpp"
+#include "utility/details/WorkStealingDeque.hpp"
 
-#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <cstddef>
-#include <functional>
+#include <cstdint>
 #include <future>
 #include <memory>
 #include <mutex>
-#include <queue>
+#include <thread>
 #include <tuple>
 #include <type_traits>
 #include <utility>
@@ -20,14 +27,46 @@
 namespace sfa
 {
 
-/// \brief A fixed size thread pool
+/// \brief Lane a job of the \ref ThreadPool is queued in, workers serve the lanes from top to bottom.
+enum class JobPriority : std::uint8_t
+{
+    Critical,
+    Normal,
+    Background
+};
+
+/// \brief Amount of \ref JobPriority lanes.
+inline constexpr std::size_t JOB_PRIORITY_COUNT{ 3 };
+
+/// \brief How the \ref ThreadPool schedules a job.
 ///
-/// Can be used to distribute workload onto a set amount of worker threads.
+/// \author Felix Hommel
+/// \date 3/17/2026
+struct JobOptions
+{
+    JobPriority priority{ JobPriority::Normal };
+    /// \brief A queued job is dropped once a stop was requested, a running job may poll the token itself.
+    threading::stop_token_t stopToken;
+};
+
+/// \brief A fixed size work-stealing thread pool
+///
+/// Can be used to distribute workload onto a set amount of worker threads. Every worker owns a Chase-Lev deque: jobs
+/// that are enqueued from inside a job land on the deque of the worker running it and stay on that core, unless an
+/// idle worker steals them. Jobs from other threads go through a shared injection queue. Workers that run out of work
+/// pick random victims to steal from, back off for a few rounds and then park until new work arrives. Jobs are stored
+/// inline in recycled slots, so \ref ThreadPool::submit doesn't allocate once the pool is warmed up.
+///
+/// Every \ref JobPriority has its own deques and injection queue. Workers look for critical jobs first and background
+/// jobs last, except for every \ref ThreadPool::STARVATION_INTERVAL -th pick, which walks the lanes the other way
+/// round so background jobs keep moving while the higher lanes are saturated. Jobs whose stop token was triggered
+/// before they started are dropped like cancelled jobs.
 ///
 /// \author Felix Hommel
 /// \date 2/7/2026
 ///
 /// \see https://dev.to/ish4n10/making-a-thread-pool-in-c-from-scratch-bnm
+/// \see https://fzn.fr/readings/ppopp13.pdf
 class ThreadPool
 {
 public:
@@ -44,6 +83,8 @@ public:
 
     /// \brief Enqueue a new task for the pool
     ///
+    /// When called from one of the workers of this pool, the task is pushed to that worker's own deque.
+    ///
     /// \tparam F function-like object
     /// \tparam Args argument types for F
     ///
@@ -66,43 +107,233 @@ public:
 
         auto future{ task->get_future() };
 
-        {
-            std::lock_guard lock(m_mutex);
+        schedule(Job{ [task]() { (*task)(); } }, nullptr);
 
-            SFA_ASSERT(
-                std::ranges::none_of(m_workers, [](const auto& w) { return w.get_stop_token().stop_requested(); }),
-                "Can't enqueue on a stopped thread pool"
-            );
+        return future;
+    }
 
-            m_queue.emplace([task]() { (*task)(); });
-        }
+    /// \brief Submit a fire-and-forget job to the pool.
+    ///
+    /// Unlike \ref ThreadPool::enqueue this doesn't allocate: the job is stored inline in a recycled slot. Exceptions
+    /// thrown by \p f are logged and swallowed.
+    ///
+    /// \tparam F function-like object that fits into a \ref Job
+    ///
+    /// \param f job that is submitted
+    template<typename F>
+        requires FitsInJob<F>
+    void submit(F&& f)
+    {
+        schedule(Job{ std::forward<F>(f) }, nullptr);
+    }
 
-        m_signal.notify_one();
+    /// \brief Submit a fire-and-forget job to the pool and track it with \p counter.
+    ///
+    /// \p counter is decremented once the job ran, or was cancelled by \ref ThreadPool::shutdown.
+    ///
+    /// \tparam F function-like object that fits into a \ref Job
+    ///
+    /// \param counter counter that has to outlive the job
+    /// \param f job that is submitted
+    template<typename F>
+        requires FitsInJob<F>
+    void submit(JobCounter& counter, F&& f)
+    {
+        counter.add();
+        schedule(Job{ std::forward<F>(f) }, &counter);
+    }
 
-        return future;
+    /// \brief Submit a fire-and-forget job to the pool with a priority and a stop token.
+    ///
+    /// \tparam F function-like object that fits into a \ref Job
+    ///
+    /// \param options lane and stop token of the job
+    /// \param f job that is submitted
+    template<typename F>
+        requires FitsInJob<F>
+    void submit(const JobOptions& options, F&& f)
+    {
+        schedule(Job{ std::forward<F>(f) }, nullptr, options);
+    }
+
+    /// \brief Submit a fire-and-forget job to the pool with a priority and a stop token and track it with \p counter.
+    ///
+    /// \p counter is decremented once the job ran or was dropped.
+    ///
+    /// \tparam F function-like object that fits into a \ref Job
+    ///
+    /// \param counter counter that has to outlive the job
+    /// \param options lane and stop token of the job
+    /// \param f job that is submitted
+    template<typename F>
+        requires FitsInJob<F>
+    void submit(JobCounter& counter, const JobOptions& options, F&& f)
+    {
+        counter.add();
+        schedule(Job{ std::forward<F>(f) }, &counter, options);
+    }
+
+    /// \brief Submit a fire-and-forget job that has to run on the main thread, e.g. because it talks to OpenGL.
+    ///
+    /// The main thread is the thread that created the pool. The job runs the next time it calls
+    /// \ref ThreadPool::runMainThreadJobs or waits in \ref ThreadPool::wait.
+    ///
+    /// \tparam F function-like object that fits into a \ref Job
+    ///
+    /// \param f job that is submitted
+    template<typename F>
+        requires FitsInJob<F>
+    void submitToMainThread(F&& f)
+    {
+        scheduleOnMainThread(Job{ std::forward<F>(f) }, nullptr);
     }
 
+    /// \brief Submit a fire-and-forget job that has to run on the main thread and track it with \p counter.
+    ///
+    /// \tparam F function-like object that fits into a \ref Job
+    ///
+    /// \param counter counter that has to outlive the job
+    /// \param f job that is submitted
+    template<typename F>
+        requires FitsInJob<F>
+    void submitToMainThread(JobCounter& counter, F&& f)
+    {
+        counter.add();
+        scheduleOnMainThread(Job{ std::forward<F>(f) }, &counter);
+    }
+
+    /// \brief Submit a fire-and-forget job that has to run on the main thread with a stop token.
+    ///
+    /// The main thread runs its jobs in submission order, the priority of \p options is ignored.
+    ///
+    /// \tparam F function-like object that fits into a \ref Job
+    ///
+    /// \param counter counter that has to outlive the job
+    /// \param options stop token of the job
+    /// \param f job that is submitted
+    template<typename F>
+        requires FitsInJob<F>
+    void submitToMainThread(JobCounter& counter, const JobOptions& options, F&& f)
+    {
+        counter.add();
+        scheduleOnMainThread(Job{ std::forward<F>(f) }, &counter, options.stopToken);
+    }
+
+    /// \brief Run the jobs that were submitted to the main thread. Must only be called by the main thread.
+    ///
+    /// \param maxJobs (optional) maximum number of jobs to run (0 := all that are queued)
+    ///
+    /// \returns how many jobs ran
+    std::size_t runMainThreadJobs(std::size_t maxJobs = 0);
+
+    /// \brief Block until every job tracked by \p counter is done.
+    ///
+    /// A worker of this pool keeps running other jobs while it waits and the main thread keeps running main-thread
+    /// jobs, so waiting never deadlocks on a job that could only run on the waiting thread.
+    ///
+    /// \param counter counter of the jobs to wait for
+    void wait(const JobCounter& counter) { waitUntil(counter, std::chrono::steady_clock::time_point::max()); }
+
+    /// \brief Like \ref ThreadPool::wait, but gives up after \p timeout.
+    ///
+    /// Lets the main thread keep a fixed frame rate while jobs stream in: it runs main-thread jobs as they arrive and
+    /// sleeps in between, until the counter finished or the time is up.
+    ///
+    /// \param counter counter of the jobs to wait for
+    /// \param timeout how long to wait at most
+    ///
+    /// \returns *true* if every job tracked by \p counter is done
+    bool waitFor(const JobCounter& counter, std::chrono::nanoseconds timeout)
+    {
+        return waitUntil(counter, std::chrono::steady_clock::now() + timeout);
+    }
+
+    /// \brief Like \ref ThreadPool::wait, but gives up once \p deadline passed.
+    ///
+    /// \param counter counter of the jobs to wait for
+    /// \param deadline point in time to wait until at most, *time_point::max()* waits without limit
+    ///
+    /// \returns *true* if every job tracked by \p counter is done
+    bool waitUntil(const JobCounter& counter, std::chrono::steady_clock::time_point deadline);
+
+    /// \brief Sleep until a main-thread job is queued, \p counter finished or \p deadline passed, without running
+    /// anything. Must only be called by the main thread.
+    ///
+    /// Lets the main thread interleave work of its own, like budgeted uploads, with the jobs it waits for.
+    ///
+    /// \param counter counter of the jobs to wait for
+    /// \param deadline point in time to wait until at most, *time_point::max()* waits without limit
+    ///
+    /// \returns *false* if \p deadline passed first
+    bool waitForMainThreadJobs(const JobCounter& counter, std::chrono::steady_clock::time_point deadline);
+
     /// \brief Shut down the thread pool
     ///
     /// \param drainQueue (optional) whether or not the queue should first drain the pending jobs or cancel them
     void shutdown(bool drainQueue = true) noexcept;
 
-    [[nodiscard]] std::size_t pendingTasks() const noexcept
-    {
-        std::lock_guard lock(m_mutex);
+    /// \brief Check if the calling thread is one of the workers of this pool.
+    [[nodiscard]] bool isWorkerThread() const noexcept;
 
-        return m_queue.size();
-    }
+    /// \brief Check if the calling thread is the thread that created the pool.
+    [[nodiscard]] bool isMainThread() const noexcept { return std::this_thread::get_id() == m_mainThread; }
+
+    [[nodiscard]] std::size_t pendingTasks() const noexcept { return m_pending.load(std::memory_order_acquire); }
+    [[nodiscard]] std::size_t pendingMainThreadJobs() const noexcept { return m_mainThreadQueue.size(); }
+
+    /// \brief Every how many picks a worker serves the lanes from the lowest priority up.
+    static constexpr std::uint32_t STARVATION_INTERVAL{ 8 };
 
 private:
+    using JobSlot = details::JobSlot;
+
+    static constexpr std::size_t CACHE_LINE{ 64 };
+
+    /// \brief State owned by a single worker, on its own cache line.
+    struct alignas(CACHE_LINE) WorkerQueue
+    {
+        std::array<details::WorkStealingDeque<JobSlot*>, JOB_PRIORITY_COUNT> deques;
+        std::uint64_t rng{ 0 };
+        std::uint32_t picks{ 0 };
+    };
+
+    /// \brief Intrusive list of the jobs of one lane that were submitted from outside the pool.
+    struct InjectLane
+    {
+        JobSlot* head{ nullptr };
+        JobSlot* tail{ nullptr };
+    };
+
+    std::vector<std::unique_ptr<WorkerQueue>> m_queues;
+    std::mutex m_injectMutex;
+    std::array<InjectLane, JOB_PRIORITY_COUNT> m_inject{};
+    std::array<std::atomic<std::size_t>, JOB_PRIORITY_COUNT> m_injected{};
+    details::WaitSignal m_signal;
+    std::atomic<std::size_t> m_pending{ 0 };
+    std::atomic<bool> m_draining{ false };
+    std::atomic<bool> m_stopped{ false };
     std::vector<threading::thread_t> m_workers;
-    mutable std::mutex m_mutex;
-    std::condition_variable m_signal;
-    std::condition_variable m_drainingComplete;
-    std::queue<std::function<void()>> m_queue;
-    bool m_draining{ false };
 
-    void worker(threading::stop_token_t stopToken);
+    std::thread::id m_mainThread{ std::this_thread::get_id() };
+    BlockingQueue<JobSlot*> m_mainThreadQueue;
+    std::vector<JobSlot*> m_mainThreadBatch;
+    /// \brief Bumped whenever the main thread may have something new to do, guarded by m_mainThreadMutex.
+    std::uint64_t m_mainThreadEpoch{ 0 };
+    std::mutex m_mainThreadMutex;
+    std::condition_variable m_mainThreadWakeup;
+
+    void schedule(Job&& job, JobCounter* counter, const JobOptions& options = {});
+    void scheduleOnMainThread(Job&& job, JobCounter* counter, threading::stop_token_t stopToken = {});
+    [[nodiscard]] JobSlot* findJob(std::size_t index);
+    [[nodiscard]] JobSlot* findJob(std::size_t index, std::size_t lane);
+    [[nodiscard]] JobSlot* takeInjected(std::size_t index, std::size_t lane);
+    [[nodiscard]] JobSlot* steal(std::size_t index, std::size_t lane);
+    void run(JobSlot* slot);
+    void cancel(JobSlot* slot) noexcept;
+    void complete(JobCounter* counter) noexcept;
+    void wakeMainThread() noexcept;
+
+    void worker(threading::stop_token_t stopToken, std::size_t index);
 };
 
 } // namespace sfa
@@ -0,0 +1,143 @@
+#include "JobSlotAllocator.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+
+namespace sfa::details
+{
+
+namespace
+{
+
+/// \brief Slots a thread keeps before it hands a batch back to the shared list.
+constexpr std::size_t LOCAL_CACHE_LIMIT{ 128 };
+/// \brief Slots moved between a thread's list and the shared list at once.
+constexpr std::size_t TRANSFER_BATCH{ 64 };
+/// \brief Slots allocated at once when the shared list ran dry.
+constexpr std::size_t CHUNK_SIZE{ 256 };
+
+} // namespace
+
+/// \brief Free list of the calling thread, handed back to the shared list when the thread exits.
+///
+/// \author Felix Hommel
+/// \date 3/15/2026
+struct LocalSlotCache
+{
+    LocalSlotCache() = default;
+    ~LocalSlotCache()
+    {
+        if(head != nullptr)
+            JobSlotAllocator::instance().giveBack(head, count);
+    }
+
+    LocalSlotCache(const LocalSlotCache&) = delete;
+    LocalSlotCache& operator=(const LocalSlotCache&) = delete;
+    LocalSlotCache(LocalSlotCache&&) = delete;
+    LocalSlotCache& operator=(LocalSlotCache&&) = delete;
+
+    JobSlot* head{ nullptr };
+    std::size_t count{ 0 };
+};
+
+namespace
+{
+
+thread_local LocalSlotCache t_cache;
+
+} // namespace
+
+JobSlotAllocator& JobSlotAllocator::instance()
+{
+    // NOTE: Never destroyed on purpose, workers of pools with static storage duration still release their slots while
+    // static objects are destroyed
+    static auto* allocator{ new JobSlotAllocator() };
+
+    return *allocator;
+}
+
+JobSlot* JobSlotAllocator::acquire()
+{
+    auto& cache{ t_cache };
+    if(cache.head == nullptr)
+        cache.count += refill(cache.head, TRANSFER_BATCH);
+
+    auto* slot{ cache.head };
+    cache.head = slot->next;
+    --cache.count;
+
+    slot->next = nullptr;
+
+    return slot;
+}
+
+void JobSlotAllocator::release(JobSlot* slot) noexcept
+{
+    slot->job.reset();
+    slot->counter = nullptr;
+    slot->stopToken = {};
+
+    auto& cache{ t_cache };
+    slot->next = cache.head;
+    cache.head = slot;
+    ++cache.count;
+
+    if(cache.count > LOCAL_CACHE_LIMIT)
+    {
+        auto* batch{ cache.head };
+        auto* last{ batch };
+        for(std::size_t i{ 1 }; i < TRANSFER_BATCH; ++i)
+            last = last->next;
+
+        cache.head = last->next;
+        cache.count -= TRANSFER_BATCH;
+        last->next = nullptr;
+
+        giveBack(batch, TRANSFER_BATCH);
+    }
+}
+
+std::size_t JobSlotAllocator::refill(JobSlot*& head, std::size_t count)
+{
+    std::lock_guard lock(m_mutex);
+
+    if(m_free == nullptr)
+    {
+        auto& chunk{ m_chunks.emplace_back(std::make_unique<JobSlot[]>(CHUNK_SIZE)) };
+        for(std::size_t i{ 0 }; i < CHUNK_SIZE; ++i)
+        {
+            chunk[i].next = m_free;
+            m_free = &chunk[i];
+        }
+
+        m_capacity.fetch_add(CHUNK_SIZE, std::memory_order_relaxed);
+    }
+
+    std::size_t taken{ 0 };
+    while(m_free != nullptr && taken < count)
+    {
+        auto* slot{ m_free };
+        m_free = slot->next;
+
+        slot->next = head;
+        head = slot;
+        ++taken;
+    }
+
+    return taken;
+}
+
+void JobSlotAllocator::giveBack(JobSlot* head, std::size_t count) noexcept
+{
+    auto* last{ head };
+    for(std::size_t i{ 1 }; i < count && last->next != nullptr; ++i)
+        last = last->next;
+
+    std::lock_guard lock(m_mutex);
+
+    last->next = m_free;
+    m_free = head;
+}
+
+} // namespace sfa::details
@@ -0,0 +1,78 @@
+#ifndef SFA_SRC_ENGINE_UTILITY_DETAILS_JOB_SLOT_ALLOCATOR_HPP
+#define SFA_SRC_ENGINE_UTILITY_DETAILS_JOB_SLOT_ALLOCATOR_HPP
+
+#include "utility/Job.hpp"
+#include "utility/JobCounter.hpp"
+#include "utility/details/Threading.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace sfa::details
+{
+
+/// \brief A queued job of the \ref ThreadPool together with its bookkeeping.
+///
+/// \author Felix Hommel
+/// \date 3/15/2026
+struct JobSlot
+{
+    Job job;
+    JobCounter* counter{ nullptr };
+    /// \brief The job is dropped instead of run once a stop was requested.
+    threading::stop_token_t stopToken;
+    JobSlot* next{ nullptr };
+};
+
+/// \brief Recycles \ref JobSlot objects so submitting a job doesn't allocate.
+///
+/// Every thread keeps a small free list of its own. Workers release the slots of the jobs they ran into their list,
+/// when a list grows too long half of it moves to a shared list under a lock, where submitting threads refill from.
+/// New slots are only allocated, in chunks, when the shared list is empty too, so in steady state the slots just
+/// circulate between the threads.
+///
+/// \author Felix Hommel
+/// \date 3/15/2026
+class JobSlotAllocator
+{
+public:
+    /// \brief Get the process wide allocator.
+    static JobSlotAllocator& instance();
+
+    ~JobSlotAllocator() = default;
+
+    JobSlotAllocator(const JobSlotAllocator&) = delete;
+    JobSlotAllocator& operator=(const JobSlotAllocator&) = delete;
+    JobSlotAllocator(JobSlotAllocator&&) = delete;
+    JobSlotAllocator& operator=(JobSlotAllocator&&) = delete;
+
+    /// \brief Take an empty slot, from the calling thread's free list if possible.
+    [[nodiscard]] JobSlot* acquire();
+    /// \brief Destroy the job of \p slot and put the slot on the calling thread's free list.
+    void release(JobSlot* slot) noexcept;
+
+    /// \brief Return how many slots were allocated in total.
+    [[nodiscard]] std::size_t capacity() const noexcept { return m_capacity.load(std::memory_order_relaxed); }
+
+private:
+    friend struct LocalSlotCache;
+
+    std::mutex m_mutex;
+    JobSlot* m_free{ nullptr };
+    std::vector<std::unique_ptr<JobSlot[]>> m_chunks;
+    std::atomic<std::size_t> m_capacity{ 0 };
+
+    JobSlotAllocator() = default;
+
+    /// \brief Move up to \p count slots from the shared list to \p head, allocating a chunk if it is empty.
+    std::size_t refill(JobSlot*& head, std::size_t count);
+    /// \brief Move the list of \p count slots starting at \p head to the shared list.
+    void giveBack(JobSlot* head, std::size_t count) noexcept;
+};
+
+} // namespace sfa::details
+
+#endif // !SFA_SRC_ENGINE_UTILITY_DETAILS_JOB_SLOT_ALLOCATOR_HPP
@@ -0,0 +1,89 @@
+#ifndef SFA_SRC_ENGINE_UTILITY_DETAILS_WAIT_SIGNAL_HPP
+#define SFA_SRC_ENGINE_UTILITY_DETAILS_WAIT_SIGNAL_HPP
+
+#include <atomic>
+#include <cstdint>
+
+namespace sfa::details
+{
+
+/// \brief Lets consumers of a lock-free queue sleep until a producer signals, built on std::atomic::wait.
+///
+/// A consumer announces itself with \ref WaitSignal::prepareWait, checks its condition once more and only then calls
+/// \ref WaitSignal::wait. Producers publish first and signal afterwards, so either the producer sees the waiter or
+/// the waiter sees the published element. While nobody waits, signalling is a single load and never touches shared
+/// state that producers would contend on.
+///
+/// \author Felix Hommel
+/// \date 3/13/2026
+class WaitSignal
+{
+public:
+    WaitSignal() = default;
+    ~WaitSignal() = default;
+
+    WaitSignal(const WaitSignal&) = delete;
+    WaitSignal& operator=(const WaitSignal&) = delete;
+    WaitSignal(WaitSignal&&) = delete;
+    WaitSignal& operator=(WaitSignal&&) = delete;
+
+    /// \brief Announce that the calling thread is about to wait.
+    ///
+    /// The condition has to be checked again afterwards, followed by either \ref WaitSignal::wait or
+    /// \ref WaitSignal::cancelWait.
+    ///
+    /// \returns the ticket to pass to \ref WaitSignal::wait
+    [[nodiscard]] std::uint32_t prepareWait() noexcept
+    {
+        m_waiters.fetch_add(1);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        return m_epoch.load();
+    }
+
+    /// \brief Block until a signal was sent after \ref WaitSignal::prepareWait returned \p ticket.
+    void wait(std::uint32_t ticket) noexcept
+    {
+        m_epoch.wait(ticket);
+        m_waiters.fetch_sub(1);
+    }
+
+    /// \brief Withdraw a \ref WaitSignal::prepareWait because the condition became true.
+    void cancelWait() noexcept { m_waiters.fetch_sub(1); }
+
+    /// \brief Wake up a single waiter. Has to be called after the change that is signalled was published.
+    void notifyOne() noexcept
+    {
+        if(hasWaiters())
+        {
+            m_epoch.fetch_add(1);
+            m_epoch.notify_one();
+        }
+    }
+
+    /// \brief Wake up all waiters. Has to be called after the change that is signalled was published.
+    void notifyAll() noexcept
+    {
+        if(hasWaiters())
+        {
+            m_epoch.fetch_add(1);
+            m_epoch.notify_all();
+        }
+    }
+
+private:
+    std::atomic<std::uint32_t> m_epoch{ 0 };
+    std::atomic<std::uint32_t> m_waiters{ 0 };
+
+    [[nodiscard]] bool hasWaiters() const noexcept
+    {
+        // NOTE: Pairs with the fence in prepareWait, orders the published change before the load of the waiters
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        return m_waiters.load(std::memory_order_relaxed) > 0;
+    }
+};
+
+} // namespace sfa::details
+
+#endif // !SFA_SRC_ENGINE_UTILITY_DETAILS_WAIT_SIGNAL_HPP
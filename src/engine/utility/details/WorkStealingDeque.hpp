@@ -0,0 +1,180 @@
+#ifndef SFA_SRC_ENGINE_UTILITY_DETAILS_WORK_STEALING_DEQUE_HPP
+#define SFA_SRC_ENGINE_UTILITY_DETAILS_WORK_STEALING_DEQUE_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <vector>
+
+namespace sfa::details
+{
+
+/// \brief Chase-Lev work-stealing deque.
+///
+/// The owning thread pushes and pops at the bottom like a stack, so the work it spawned last is still hot in its
+/// cache. Any other thread may steal from the top, the oldest end. Owner operations only need a CAS when they race a
+/// thief for the very last element. The ring grows when it is full, retired rings are kept alive until the deque is
+/// destroyed because a thief might still read from them.
+///
+/// \tparam T element type, has to be trivially copyable (e.g. a pointer to the job)
+///
+/// \author Felix Hommel
+/// \date 3/14/2026
+///
+/// \see https://fzn.fr/readings/ppopp13.pdf
+template<typename T>
+    requires std::is_trivially_copyable_v<T>
+class WorkStealingDeque
+{
+public:
+    /// \brief Create a new \ref WorkStealingDeque
+    ///
+    /// \param capacity initial capacity, rounded up to the next power of two
+    explicit WorkStealingDeque(std::size_t capacity = DEFAULT_CAPACITY)
+    {
+        m_rings.push_back(std::make_unique<Ring>(std::bit_ceil(std::max<std::size_t>(capacity, 2))));
+        m_ring.store(m_rings.back().get(), std::memory_order_relaxed);
+    }
+    ~WorkStealingDeque() = default;
+
+    WorkStealingDeque(const WorkStealingDeque&) = delete;
+    WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+    WorkStealingDeque(WorkStealingDeque&&) = delete;
+    WorkStealingDeque& operator=(WorkStealingDeque&&) = delete;
+
+    /// \brief Push an element to the bottom. Must only be called by the owner.
+    ///
+    /// \param value the new element
+    void push(T value)
+    {
+        const auto bottom{ m_bottom.load(std::memory_order_relaxed) };
+        const auto top{ m_top.load(std::memory_order_acquire) };
+        auto* ring{ m_ring.load(std::memory_order_relaxed) };
+
+        if(bottom - top > static_cast<std::int64_t>(ring->mask))
+            ring = grow(ring, top, bottom);
+
+        ring->store(bottom, value);
+        m_bottom.store(bottom + 1, std::memory_order_release);
+    }
+
+    /// \brief Pop the most recently pushed element. Must only be called by the owner.
+    ///
+    /// \returns the element, empty optional if the deque is empty or a thief took the last element
+    [[nodiscard]] std::optional<T> pop()
+    {
+        const auto bottom{ m_bottom.load(std::memory_order_relaxed) - 1 };
+        auto* ring{ m_ring.load(std::memory_order_relaxed) };
+        m_bottom.store(bottom, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        auto top{ m_top.load(std::memory_order_relaxed) };
+
+        if(top > bottom)
+        {
+            m_bottom.store(bottom + 1, std::memory_order_relaxed);
+            return std::nullopt;
+        }
+
+        const auto value{ ring->load(bottom) };
+        if(top == bottom)
+        {
+            // NOTE: Last element, race the thieves for it
+            const auto won{
+                m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)
+            };
+            m_bottom.store(bottom + 1, std::memory_order_relaxed);
+
+            if(!won)
+                return std::nullopt;
+        }
+
+        return value;
+    }
+
+    /// \brief Steal the oldest element. Can be called by any thread.
+    ///
+    /// \returns the element, empty optional if the deque is empty or another thread was faster
+    [[nodiscard]] std::optional<T> steal()
+    {
+        auto top{ m_top.load(std::memory_order_acquire) };
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        const auto bottom{ m_bottom.load(std::memory_order_acquire) };
+
+        if(top >= bottom)
+            return std::nullopt;
+
+        const auto value{ m_ring.load(std::memory_order_acquire)->load(top) };
+        if(!m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+            return std::nullopt;
+
+        return value;
+    }
+
+    /// \brief Return the amount of elements in the deque.
+    ///
+    /// \note Returned value is a point-in-time snapshot
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        const auto top{ m_top.load(std::memory_order_acquire) };
+        const auto bottom{ m_bottom.load(std::memory_order_acquire) };
+
+        return bottom > top ? static_cast<std::size_t>(bottom - top) : 0;
+    }
+
+    /// \brief Check if the deque is empty.
+    ///
+    /// \note Returned value is a point-in-time snapshot
+    [[nodiscard]] bool empty() const noexcept { return size() == 0; }
+
+private:
+    static constexpr std::size_t DEFAULT_CAPACITY{ 256 };
+    static constexpr std::size_t CACHE_LINE{ 64 };
+
+    /// \brief Circular buffer holding the elements, indexed by the unbounded top and bottom positions.
+    struct Ring
+    {
+        explicit Ring(std::size_t capacity)
+            : mask{ capacity - 1 }
+            , slots{ std::make_unique<std::atomic<T>[]>(capacity) }
+        {}
+
+        std::size_t mask;
+        std::unique_ptr<std::atomic<T>[]> slots;
+
+        [[nodiscard]] T load(std::int64_t position) const noexcept
+        {
+            return slots[static_cast<std::size_t>(position) & mask].load(std::memory_order_relaxed);
+        }
+        void store(std::int64_t position, T value) noexcept
+        {
+            slots[static_cast<std::size_t>(position) & mask].store(value, std::memory_order_relaxed);
+        }
+    };
+
+    alignas(CACHE_LINE) std::atomic<std::int64_t> m_top{ 0 };
+    alignas(CACHE_LINE) std::atomic<std::int64_t> m_bottom{ 0 };
+    std::atomic<Ring*> m_ring{ nullptr };
+    std::vector<std::unique_ptr<Ring>> m_rings;
+
+    /// \brief Copy the live elements into a ring twice the size and publish it.
+    Ring* grow(Ring* ring, std::int64_t top, std::int64_t bottom)
+    {
+        auto bigger{ std::make_unique<Ring>((ring->mask + 1) * 2) };
+        for(auto i{ top }; i < bottom; ++i)
+            bigger->store(i, ring->load(i));
+
+        m_rings.push_back(std::move(bigger));
+        m_ring.store(m_rings.back().get(), std::memory_order_release);
+
+        return m_rings.back().get();
+    }
+};
+
+} // namespace sfa::details
+
+#endif // !SFA_SRC_ENGINE_UTILITY_DETAILS_WORK_STEALING_DEQUE_HPP
@@ -0,0 +1,30 @@
+#ifndef SFA_SRC_ENGINE_UTILITY_EXCEPTIONS_INPUT_RECORDING_EXCEPTION_HPP
+#define SFA_SRC_ENGINE_UTILITY_EXCEPTIONS_INPUT_RECORDING_EXCEPTION_HPP
+
+#include "utility/exceptions/Exception.hpp"
+
+#include <source_location>
+#include <string>
+#include <utility>
+
+namespace sfa
+{
+
+/// \brief Exception to be used when an input recording can't be read or written.
+///
+/// \author Felix Hommel
+/// \date 3/10/2026
+class InputRecordingException : public Exception
+{
+public:
+    explicit InputRecordingException(
+        std::string message, std::source_location location = std::source_location::current()
+    )
+        : Exception(std::move(message), std::move(location))
+    {}
+};
+
+} // namespace sfa
+
+#endif // !SFA_SRC_ENGINE_UTILITY_EXCEPTIONS_INPUT_RECORDING_EXCEPTION_HPP
+
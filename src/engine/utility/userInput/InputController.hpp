@@ -6,6 +6,7 @@
 #include <glm/glm.hpp>
 
 #include <cstddef>
+#include <functional>
 #include <queue>
 #include <unordered_map>
 #include <utility>
@@ -28,10 +29,22 @@ public:
     InputController(InputController&&) noexcept = delete;
     InputController& operator=(InputController&&) noexcept = delete;
 
+    using EventObserver = std::function<void(const InputEvent&)>;
+
     /// \brief Register the occurrence of a new \ref InputEvent.
     ///
     /// \param event the new \ref InputEvent
-    void registerEvent(InputEvent event) { m_inputs.push(std::move(event)); }
+    void registerEvent(InputEvent event)
+    {
+        if(m_observer)
+            m_observer(event);
+
+        m_inputs.push(std::move(event));
+    }
+    /// \brief Observe every event that is registered, e.g. to record a session into an \ref InputRecording.
+    ///
+    /// \param observer callable that is invoked with every registered event, an empty function removes the observer
+    void setEventObserver(EventObserver observer) { m_observer = std::move(observer); }
     /// \brief Process the queued inputs.
     void processEventQueue();
 
@@ -59,6 +72,7 @@ private:
     std::unordered_map<MouseButton, InputAction> m_mouseStates;
     double m_mousePosX{ 0 };
     double m_mousePosY{ 0 };
+    EventObserver m_observer;
 
     void processEvent(const KeyboardInputEvent& event);
     void processEvent(const MouseInputEvent& event);
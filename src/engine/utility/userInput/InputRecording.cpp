@@ -0,0 +1,235 @@
+#include "InputRecording.hpp"
+
+#include "core/Utility.hpp"
+#include "utility/exceptions/InputRecordingException.hpp"
+#include "utility/userInput/InputController.hpp"
+#include "utility/userInput/InputEvent.hpp"
+
+#include <fmt/format.h>
+
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <istream>
+#include <optional>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+namespace
+{
+
+/// \brief Parse a single numeric token of a recording line.
+///
+/// \throws InputRecordingException if \p token isn't a complete number of type \p T
+template<typename T>
+T parseNumber(std::string_view token, std::size_t line, int base = 10)
+{
+    T value{};
+    std::from_chars_result result{};
+
+    if constexpr(std::is_floating_point_v<T>)
+        result = std::from_chars(token.data(), token.data() + token.size(), value);
+    else
+        result = std::from_chars(token.data(), token.data() + token.size(), value, base);
+
+    if(result.ec != std::errc{} || result.ptr != token.data() + token.size())
+        throw sfa::InputRecordingException(fmt::format("Invalid number '{}' in line {}", token, line));
+
+    return value;
+}
+
+/// \brief Parse an enumerator that was stored as its underlying value.
+///
+/// \throws InputRecordingException if the value is out of range of \p E
+template<typename E>
+E parseEnum(std::string_view token, std::size_t line, E unknown)
+{
+    const auto value{ parseNumber<std::underlying_type_t<E>>(token, line) };
+    if(value > std::to_underlying(unknown))
+        throw sfa::InputRecordingException(fmt::format("Invalid enumerator '{}' in line {}", token, line));
+
+    return static_cast<E>(value);
+}
+
+} // namespace
+
+namespace sfa
+{
+
+void InputRecording::record(std::uint64_t frame, const InputEvent& event)
+{
+    SFA_ASSERT(m_events.empty() || m_events.back().frame <= frame, "Input events have to be recorded in frame order");
+
+    m_events.push_back({ .frame = frame, .event = event });
+}
+
+void InputRecording::write(std::ostream& stream) const
+{
+    stream << FORMAT_HEADER << '\n';
+
+    for(const auto& [frame, event] : m_events)
+    {
+        std::visit(
+            [&stream, frame](const auto& e) {
+                using T = std::decay_t<decltype(e)>;
+
+                if constexpr(std::is_same_v<T, KeyboardInputEvent>)
+                    stream << fmt::format(
+                        "K {} {} {}\n", frame, std::to_underlying(e.key), std::to_underlying(e.action)
+                    );
+                else if constexpr(std::is_same_v<T, MouseInputEvent>)
+                    stream << fmt::format(
+                        "B {} {} {}\n", frame, std::to_underlying(e.button), std::to_underlying(e.action)
+                    );
+                else
+                    // NOTE: fmt prints the shortest representation that round-trips, so positions are stored exactly
+                    stream << fmt::format("M {} {} {}\n", frame, e.posX, e.posY);
+            },
+            event
+        );
+    }
+
+    for(std::uint64_t frame{ 0 }; frame < m_frameSteps.size(); ++frame)
+        stream << fmt::format("S {} {}\n", frame, m_frameSteps[frame]);
+
+    for(std::uint64_t frame{ 0 }; frame < m_stateHashes.size(); ++frame)
+        stream << fmt::format("H {} {:016x}\n", frame, m_stateHashes[frame]);
+}
+
+InputRecording InputRecording::read(std::istream& stream)
+{
+    std::string lineContent;
+    if(!std::getline(stream, lineContent) || lineContent != FORMAT_HEADER)
+        throw InputRecordingException("Missing or unsupported input recording header");
+
+    InputRecording recording;
+    std::size_t line{ 1 };
+
+    while(std::getline(stream, lineContent))
+    {
+        ++line;
+        if(lineContent.empty())
+            continue;
+
+        std::istringstream tokens{ lineContent };
+        std::string tag;
+        std::string frameToken;
+        std::string first;
+        std::string second;
+        std::string trailing;
+        tokens >> tag >> frameToken >> first;
+
+        const auto perFrame{ tag == "H" || tag == "S" };
+        if(!perFrame)
+            tokens >> second;
+
+        if(first.empty() || (!perFrame && second.empty()) || (tokens >> trailing))
+            throw InputRecordingException(fmt::format("Malformed input recording line {}", line));
+
+        const auto frame{ ::parseNumber<std::uint64_t>(frameToken, line) };
+        if(!perFrame && !recording.m_events.empty() && recording.m_events.back().frame > frame)
+            throw InputRecordingException(fmt::format("Input event out of order in line {}", line));
+
+        if(tag == "K")
+            recording.record(
+                frame,
+                KeyboardInputEvent{ .key = ::parseEnum(first, line, Key::Unknown),
+                                    .action = ::parseEnum(second, line, InputAction::Unknown) }
+            );
+        else if(tag == "B")
+            recording.record(
+                frame,
+                MouseInputEvent{ .button = ::parseEnum(first, line, MouseButton::Unknown),
+                                 .action = ::parseEnum(second, line, InputAction::Unknown) }
+            );
+        else if(tag == "M")
+            recording.record(
+                frame,
+                MouseMoveEvent{ .posX = ::parseNumber<double>(first, line),
+                                .posY = ::parseNumber<double>(second, line) }
+            );
+        else if(tag == "S")
+        {
+            if(frame != recording.m_frameSteps.size())
+                throw InputRecordingException(fmt::format("Step count out of order in line {}", line));
+
+            recording.recordSteps(::parseNumber<std::uint64_t>(first, line));
+        }
+        else if(tag == "H")
+        {
+            if(frame != recording.m_stateHashes.size())
+                throw InputRecordingException(fmt::format("State hash out of order in line {}", line));
+
+            // NOLINTNEXTLINE(readability-magic-numbers): hashes are stored as hexadecimal
+            recording.recordStateHash(::parseNumber<std::uint64_t>(first, line, 16));
+        }
+        else
+            throw InputRecordingException(fmt::format("Unknown record '{}' in line {}", tag, line));
+    }
+
+    return recording;
+}
+
+void InputRecording::save(const std::filesystem::path& filepath) const
+{
+    std::ofstream file{ filepath };
+    if(!file.is_open())
+        throw InputRecordingException("Failed to open input recording for writing: " + filepath.string());
+
+    write(file);
+}
+
+InputRecording InputRecording::load(const std::filesystem::path& filepath)
+{
+    std::ifstream file{ filepath };
+    if(!file.is_open())
+        throw InputRecordingException("Failed to open input recording: " + filepath.string());
+
+    return read(file);
+}
+
+InputReplay::InputReplay(InputRecording recording)
+    : m_recording{ std::move(recording) }
+{}
+
+void InputReplay::feed(std::uint64_t frame, InputController& controller)
+{
+    const auto events{ m_recording.events() };
+
+    while(m_cursor < events.size() && events[m_cursor].frame <= frame)
+    {
+        controller.registerEvent(events[m_cursor].event);
+        ++m_cursor;
+    }
+}
+
+std::optional<std::uint64_t> InputReplay::steps(std::uint64_t frame) const noexcept
+{
+    const auto steps{ m_recording.frameSteps() };
+    if(frame >= steps.size())
+        return std::nullopt;
+
+    return steps[frame];
+}
+
+bool InputReplay::verify(std::uint64_t frame, std::uint64_t hash)
+{
+    const auto hashes{ m_recording.stateHashes() };
+    if(frame >= hashes.size() || hashes[frame] == hash)
+        return true;
+
+    if(!m_firstDivergence.has_value())
+        m_firstDivergence = frame;
+
+    return false;
+}
+
+} // namespace sfa
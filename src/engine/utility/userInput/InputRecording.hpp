@@ -0,0 +1,149 @@
+#ifndef SFA_SRC_ENGINE_UTILITY_USER_INPUT_INPUT_RECORDING_HPP
+#define SFA_SRC_ENGINE_UTILITY_USER_INPUT_INPUT_RECORDING_HPP
+
+#include "utility/userInput/InputController.hpp"
+#include "utility/userInput/InputEvent.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <istream>
+#include <optional>
+#include <ostream>
+#include <span>
+#include <vector>
+
+namespace sfa
+{
+
+/// \brief A single input event together with the frame that processes it.
+///
+/// \author Felix Hommel
+/// \date 3/10/2026
+struct RecordedInputEvent
+{
+    std::uint64_t frame;
+    InputEvent event;
+};
+
+/// \brief A recorded session of input events, and the fixed step counts and simulation state hashes of every frame.
+///
+/// Events are stored with the index of the frame that processes them, which is the amount of frames presented when the
+/// event arrived. How many fixed simulation steps each frame ran depends on the wall clock, so it is recorded as well
+/// and drives the \ref GameLoop during a replay. The text format is line based and stores every value exactly, so a
+/// saved recording replays bit-for-bit:
+///
+///     SFA-INPUT 2
+///     K <frame> <key> <action>
+///     B <frame> <button> <action>
+///     M <frame> <x> <y>
+///     S <frame> <steps>
+///     H <frame> <hash>
+///
+/// \author Felix Hommel
+/// \date 3/10/2026
+class InputRecording
+{
+public:
+    InputRecording() = default;
+
+    /// \brief Record an input event.
+    ///
+    /// \param frame the frame that processes \p event, has to be >= the frame of the previously recorded event
+    /// \param event the recorded \ref InputEvent
+    void record(std::uint64_t frame, const InputEvent& event);
+    /// \brief Record the simulation state hash at the end of the next frame.
+    ///
+    /// \param hash the hash of the simulation state
+    void recordStateHash(std::uint64_t hash) { m_stateHashes.push_back(hash); }
+    /// \brief Record how many fixed simulation steps the next frame ran.
+    ///
+    /// \param steps \ref FrameStats::steps of the frame
+    void recordSteps(std::uint64_t steps) { m_frameSteps.push_back(steps); }
+
+    [[nodiscard]] std::span<const RecordedInputEvent> events() const noexcept { return m_events; }
+    /// \brief Get the recorded state hashes, indexed by frame.
+    [[nodiscard]] std::span<const std::uint64_t> stateHashes() const noexcept { return m_stateHashes; }
+    /// \brief Get the recorded fixed step counts, indexed by frame.
+    [[nodiscard]] std::span<const std::uint64_t> frameSteps() const noexcept { return m_frameSteps; }
+
+    /// \brief Write the recording in its text format.
+    ///
+    /// \param stream the stream the recording is written to
+    void write(std::ostream& stream) const;
+    /// \brief Read a recording from its text format.
+    ///
+    /// \throws InputRecordingException if the stream doesn't contain a valid recording
+    ///
+    /// \param stream the stream the recording is read from
+    ///
+    /// \returns the parsed \ref InputRecording
+    [[nodiscard]] static InputRecording read(std::istream& stream);
+
+    /// \brief Save the recording to a file.
+    ///
+    /// \throws InputRecordingException if the file can't be written
+    void save(const std::filesystem::path& filepath) const;
+    /// \brief Load a recording from a file.
+    ///
+    /// \throws InputRecordingException if the file can't be opened or doesn't contain a valid recording
+    [[nodiscard]] static InputRecording load(const std::filesystem::path& filepath);
+
+private:
+    static constexpr auto FORMAT_HEADER{ "SFA-INPUT 2" };
+
+    std::vector<RecordedInputEvent> m_events;
+    std::vector<std::uint64_t> m_stateHashes;
+    std::vector<std::uint64_t> m_frameSteps;
+};
+
+/// \brief Play back an \ref InputRecording and compare the simulation against it.
+///
+/// \author Felix Hommel
+/// \date 3/10/2026
+class InputReplay
+{
+public:
+    explicit InputReplay(InputRecording recording);
+
+    /// \brief Register all recorded events up to and including \p frame with \p controller.
+    ///
+    /// \param frame the current frame
+    /// \param controller the \ref InputController that receives the events through \ref InputController::registerEvent
+    void feed(std::uint64_t frame, InputController& controller);
+
+    /// \brief Get how many fixed simulation steps \p frame ran while it was recorded.
+    ///
+    /// The replayed frame has to run exactly this many steps, e.g. through \ref GameLoop::runHeadless, instead of
+    /// measuring its own frame time.
+    ///
+    /// \param frame the current frame
+    ///
+    /// \returns the recorded step count, *std::nullopt* if \p frame wasn't recorded
+    [[nodiscard]] std::optional<std::uint64_t> steps(std::uint64_t frame) const noexcept;
+
+    /// \brief Compare the simulation state hash of \p frame against the recorded one.
+    ///
+    /// Frames without a recorded hash always match.
+    ///
+    /// \param frame the frame \p hash belongs to
+    /// \param hash the hash of the current simulation state
+    ///
+    /// \returns *true* if the hashes match, *false* otherwise
+    bool verify(std::uint64_t frame, std::uint64_t hash);
+
+    /// \brief Get the first frame whose state hash didn't match the recording, if any.
+    [[nodiscard]] std::optional<std::uint64_t> firstDivergence() const noexcept { return m_firstDivergence; }
+    /// \brief Check whether all recorded events have been fed.
+    [[nodiscard]] bool finished() const noexcept { return m_cursor == m_recording.events().size(); }
+    [[nodiscard]] const InputRecording& recording() const noexcept { return m_recording; }
+
+private:
+    InputRecording m_recording;
+    std::size_t m_cursor{ 0 };
+    std::optional<std::uint64_t> m_firstDivergence{ std::nullopt };
+};
+
+} // namespace sfa
+
+#endif // !SFA_SRC_ENGINE_UTILITY_USER_INPUT_INPUT_RECORDING_HPP
@@ -0,0 +1,125 @@
+#include "core/GameLoop.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace
+{
+
+constexpr auto SIMULATION_RATE{ 120.0 };
+constexpr std::size_t MAX_STEPS_PER_FRAME{ 4 };
+constexpr auto STEP{ 1.0 / SIMULATION_RATE };
+constexpr auto EPSILON{ 1e-4 };
+
+} // namespace
+
+namespace sfa::testing
+{
+
+/// \brief Test the features of the \ref GameLoop.
+///
+/// \author Felix Hommel
+/// \date 3/9/2026
+class GameLoopTest : public ::testing::Test
+{
+public:
+    GameLoopTest() = default;
+    ~GameLoopTest() override = default;
+
+    GameLoopTest(const GameLoopTest&) = delete;
+    GameLoopTest& operator=(const GameLoopTest&) = delete;
+    GameLoopTest(GameLoopTest&&) = delete;
+    GameLoopTest& operator=(GameLoopTest&&) = delete;
+
+protected:
+    GameLoop m_loop{
+        { .simulationRate = ::SIMULATION_RATE, .maxStepsPerFrame = ::MAX_STEPS_PER_FRAME }
+    };
+    std::size_t m_steps{ 0 };
+    float m_lastDt{ 0.f };
+
+    GameLoop::StepFunction counter()
+    {
+        return [this](float dt) {
+            ++m_steps;
+            m_lastDt = dt;
+        };
+    }
+};
+
+/// \brief Test advancing the loop by a frame that isn't a multiple of the fixed step.
+///
+/// Only whole steps are run with the fixed delta time, the rest of the frame is reported as the interpolation factor.
+TEST_F(GameLoopTest, RunsWholeStepsAndReportsRemainder)
+{
+    const auto stats{ m_loop.advance(GameLoop::Duration{ 2.5 * ::STEP }, counter()) };
+
+    EXPECT_EQ(stats.steps, 2);
+    EXPECT_EQ(m_steps, 2);
+    EXPECT_NEAR(stats.alpha, 0.5, ::EPSILON);
+    EXPECT_NEAR(m_lastDt, ::STEP, ::EPSILON);
+    EXPECT_FALSE(stats.clamped);
+}
+
+/// \brief Test that the time left over from a frame is used in the next one.
+///
+/// Two frames that are shorter than a step each add up to one step.
+TEST_F(GameLoopTest, RemainderCarriesOverToNextFrame)
+{
+    const auto first{ m_loop.advance(GameLoop::Duration{ 0.6 * ::STEP }, counter()) };
+    const auto second{ m_loop.advance(GameLoop::Duration{ 0.6 * ::STEP }, counter()) };
+
+    EXPECT_EQ(first.steps, 0);
+    EXPECT_EQ(second.steps, 1);
+    EXPECT_NEAR(second.alpha, 0.2, ::EPSILON);
+    EXPECT_EQ(m_loop.totalSteps(), 1);
+}
+
+/// \brief Test a frame that took longer than the loop may catch up with.
+///
+/// At most \ref GameLoopConfig::maxStepsPerFrame steps are run and the rest of the time is dropped, the next frame is
+/// back to normal.
+TEST_F(GameLoopTest, LongFrameIsClamped)
+{
+    constexpr auto STALL{ 1.0 };
+
+    const auto stats{ m_loop.advance(GameLoop::Duration{ STALL }, counter()) };
+
+    EXPECT_TRUE(stats.clamped);
+    EXPECT_EQ(stats.steps, ::MAX_STEPS_PER_FRAME);
+    EXPECT_NEAR(m_loop.droppedTime().count(), STALL - (::STEP * ::MAX_STEPS_PER_FRAME), ::EPSILON);
+
+    const auto next{ m_loop.advance(GameLoop::Duration{ ::STEP }, counter()) };
+
+    EXPECT_FALSE(next.clamped);
+    EXPECT_EQ(next.steps, 1);
+}
+
+/// \brief Test the first tick of the loop.
+///
+/// There is no previous frame to measure against, so no step is run.
+TEST_F(GameLoopTest, FirstTickOnlyStartsTheClock)
+{
+    const auto stats{ m_loop.tick(counter()) };
+
+    EXPECT_EQ(stats.steps, 0);
+    EXPECT_EQ(m_steps, 0);
+}
+
+/// \brief Test running the loop without a window.
+///
+/// Exactly the requested amount of steps is run, each with the fixed delta time.
+TEST_F(GameLoopTest, HeadlessRunsExactStepCount)
+{
+    constexpr std::uint64_t STEPS{ 1000 };
+
+    m_loop.runHeadless(STEPS, counter());
+
+    EXPECT_EQ(m_steps, STEPS);
+    EXPECT_EQ(m_loop.totalSteps(), STEPS);
+    EXPECT_NEAR(m_lastDt, ::STEP, ::EPSILON);
+}
+
+} // namespace sfa::testing
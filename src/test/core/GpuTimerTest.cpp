@@ -0,0 +1,201 @@
+#include "core/GpuTimer.hpp"
+#include "core/IGpuTimerQueries.hpp"
+#include "core/NullRenderer.hpp"
+#include "ecs/ComponentRegistry.hpp"
+#include "ecs/ECSUtility.hpp"
+#include "ecs/components/SpriteComponent.hpp"
+#include "ecs/components/TransformComponent.hpp"
+#include "ecs/systems/SpriteRenderSystem.hpp"
+
+#include <glm/glm.hpp>
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+namespace
+{
+
+constexpr auto PASS{ "GpuTimerTest::pass" };
+constexpr std::uint64_t ELAPSED_NS{ 1'500'000 };
+constexpr auto ELAPSED_MS{ 1.5 };
+
+} // namespace
+
+namespace sfa::testing
+{
+
+/// \brief \ref IGpuTimerQueries whose results only become available when the test says so.
+///
+/// \author Felix Hommel
+/// \date 3/12/2026
+class FakeTimerQueries : public IGpuTimerQueries
+{
+public:
+    struct State
+    {
+        std::unordered_map<std::uint32_t, bool> available;
+        std::uint32_t nextQuery{ 1 };
+        std::size_t begun{ 0 };
+        std::size_t blockingReads{ 0 };
+        bool gpuFinishes{ true };
+    };
+
+    explicit FakeTimerQueries(std::shared_ptr<State> state)
+        : m_state{ std::move(state) }
+    {}
+    ~FakeTimerQueries() override = default;
+
+    FakeTimerQueries(const FakeTimerQueries&) = delete;
+    FakeTimerQueries& operator=(const FakeTimerQueries&) = delete;
+    FakeTimerQueries(FakeTimerQueries&&) = delete;
+    FakeTimerQueries& operator=(FakeTimerQueries&&) = delete;
+
+    [[nodiscard]] std::uint32_t create() override { return m_state->nextQuery++; }
+    void destroy(std::uint32_t query) override { m_state->available.erase(query); }
+
+    void begin(std::uint32_t query) override
+    {
+        ++m_state->begun;
+        m_state->available[query] = false;
+    }
+    void end(std::uint32_t query) override { m_state->available[query] = m_state->gpuFinishes; }
+
+    [[nodiscard]] bool available(std::uint32_t query) override { return m_state->available[query]; }
+    [[nodiscard]] std::uint64_t elapsedNs(std::uint32_t query) override
+    {
+        if(!m_state->available[query])
+            ++m_state->blockingReads;
+
+        return ::ELAPSED_NS;
+    }
+
+private:
+    std::shared_ptr<State> m_state;
+};
+
+/// \brief Test the features of the \ref GpuTimer.
+///
+/// \author Felix Hommel
+/// \date 3/12/2026
+class GpuTimerTest : public ::testing::Test
+{
+public:
+    GpuTimerTest() = default;
+    ~GpuTimerTest() override = default;
+
+    GpuTimerTest(const GpuTimerTest&) = delete;
+    GpuTimerTest& operator=(const GpuTimerTest&) = delete;
+    GpuTimerTest(GpuTimerTest&&) = delete;
+    GpuTimerTest& operator=(GpuTimerTest&&) = delete;
+
+protected:
+    std::shared_ptr<FakeTimerQueries::State> m_state{ std::make_shared<FakeTimerQueries::State>() };
+
+    [[nodiscard]] std::unique_ptr<GpuTimer> makeTimer(std::size_t history = GpuTimer::DEFAULT_HISTORY)
+    {
+        return std::make_unique<GpuTimer>(std::make_unique<FakeTimerQueries>(m_state), history);
+    }
+};
+
+/// \brief Test that a finished pass is collected on the next frame.
+TEST_F(GpuTimerTest, CollectsFinishedPasses)
+{
+    auto timer{ makeTimer() };
+
+    timer->beginFrame();
+    {
+        const ScopedGpuZone zone{ timer.get(), ::PASS };
+    }
+    EXPECT_FALSE(timer->latest(::PASS).has_value());
+
+    timer->beginFrame();
+
+    const auto timing{ timer->latest(::PASS) };
+    ASSERT_TRUE(timing.has_value());
+    EXPECT_EQ(timing->frame, 1);
+    EXPECT_DOUBLE_EQ(timing->milliseconds(), ::ELAPSED_MS);
+}
+
+/// \brief Test that queries still in flight skip the measurement instead of waiting for the GPU.
+TEST_F(GpuTimerTest, NeverWaitsForTheGpu)
+{
+    auto timer{ makeTimer() };
+    m_state->gpuFinishes = false;
+
+    for(std::size_t frame{ 0 }; frame < GpuTimer::FRAMES_IN_FLIGHT * 2; ++frame)
+    {
+        timer->beginFrame();
+        const ScopedGpuZone zone{ timer.get(), ::PASS };
+    }
+
+    EXPECT_EQ(m_state->blockingReads, 0);
+    EXPECT_EQ(m_state->begun, GpuTimer::FRAMES_IN_FLIGHT);
+    EXPECT_EQ(timer->skipped(), GpuTimer::FRAMES_IN_FLIGHT);
+    EXPECT_TRUE(timer->results().empty());
+}
+
+/// \brief Test that only the configured amount of timings is retained.
+TEST_F(GpuTimerTest, HistoryIsBounded)
+{
+    constexpr std::size_t HISTORY{ 3 };
+    constexpr std::size_t FRAMES{ 10 };
+
+    auto timer{ makeTimer(HISTORY) };
+    for(std::size_t frame{ 0 }; frame < FRAMES; ++frame)
+    {
+        timer->beginFrame();
+        const ScopedGpuZone zone{ timer.get(), ::PASS };
+    }
+    timer->beginFrame();
+
+    const auto results{ timer->results() };
+    ASSERT_EQ(results.size(), HISTORY);
+    EXPECT_EQ(results.back().frame, FRAMES);
+}
+
+/// \brief Test that the timings are written as CSV.
+TEST_F(GpuTimerTest, WritesCsv)
+{
+    auto timer{ makeTimer() };
+    timer->beginFrame();
+    {
+        const ScopedGpuZone zone{ timer.get(), ::PASS };
+    }
+    timer->beginFrame();
+
+    std::stringstream stream;
+    timer->writeCsv(stream);
+
+    EXPECT_EQ(stream.str(), std::string{ "frame,pass,gpu_ms\n1," } + ::PASS + ",1.500000\n");
+}
+
+/// \brief Test that the render systems measure their pass once a timer is attached.
+TEST_F(GpuTimerTest, RenderSystemMeasuresPass)
+{
+    constexpr EntityID ENTITY{ 1 };
+
+    ComponentRegistry registry;
+    registry.addComponent<TransformComponent>(ENTITY, {});
+    registry.addComponent<SpriteComponent>(ENTITY, { .texture = nullptr });
+
+    std::shared_ptr<GpuTimer> timer{ makeTimer() };
+    SpriteRenderSystem system{ std::make_unique<NullSpriteRenderer>() };
+
+    system.render(registry, glm::mat4(1.f));
+    EXPECT_EQ(m_state->begun, 0);
+
+    system.setGpuTimer(timer);
+    timer->beginFrame();
+    system.render(registry, glm::mat4(1.f));
+    timer->beginFrame();
+
+    EXPECT_TRUE(timer->latest("SpriteRenderSystem::render").has_value());
+}
+
+} // namespace sfa::testing
@@ -0,0 +1,77 @@
+#include "core/Mipmaps.hpp"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstddef>
+
+namespace sfa::testing
+{
+
+/// \brief Test building mip chains on the CPU.
+///
+/// \author Felix Hommel
+/// \date 3/23/2026
+class MipmapsTest : public ::testing::Test
+{
+public:
+    MipmapsTest() = default;
+    ~MipmapsTest() override = default;
+
+    MipmapsTest(const MipmapsTest&) = delete;
+    MipmapsTest& operator=(const MipmapsTest&) = delete;
+    MipmapsTest(MipmapsTest&&) = delete;
+    MipmapsTest& operator=(MipmapsTest&&) = delete;
+};
+
+/// \brief Count the levels of full mip chains.
+///
+/// The chain halves the larger side of the texture until it is a single texel, the smaller side stays at 1 texel.
+TEST_F(MipmapsTest, LevelCountAndChainSize)
+{
+    EXPECT_EQ(1, mipLevelCount(1, 1));
+    EXPECT_EQ(3, mipLevelCount(4, 2));
+    EXPECT_EQ(4, mipLevelCount(5, 8));
+    EXPECT_EQ(0, mipLevelCount(0, 0));
+
+    EXPECT_EQ((4 * 2) + (2 * 1) + (1 * 1), mipChainSize(4, 2, 1, 3));
+    EXPECT_EQ(4 * 2 * 3, mipChainSize(4, 2, 3, 1));
+}
+
+/// \brief Build the mip chain of a texture with an odd width.
+///
+/// The odd last column is folded into the texel before it, every channel is filtered on its own.
+TEST_F(MipmapsTest, BuildMipChainWithOddWidth)
+{
+    // NOTE: 3x2 texels with two channels, the second channel is the first one plus 100
+    constexpr std::array LEVEL{ std::byte(0),  std::byte(100), std::byte(4),  std::byte(104),
+                                std::byte(8),  std::byte(108), std::byte(12), std::byte(112),
+                                std::byte(16), std::byte(116), std::byte(20), std::byte(120) };
+
+    const auto chain{ buildMipChain(LEVEL, 3, 2, 2) };
+    ASSERT_EQ(mipChainSize(3, 2, 2, 2), chain.size());
+
+    // NOTE: Level 1 is a single texel averaging the first two columns (0 4 / 12 16), the third column is dropped
+    EXPECT_EQ(std::byte(8), chain.bytes()[LEVEL.size()]);
+    EXPECT_EQ(std::byte(108), chain.bytes()[LEVEL.size() + 1]);
+}
+
+/// \brief Filter the levels of a chain in place.
+///
+/// Every level is filtered from the previous one, not from the full resolution level.
+TEST_F(MipmapsTest, BoxFilterFillsEveryLevel)
+{
+    constexpr int SIZE{ 4 };
+
+    std::array<std::byte, (4 * 4) + (2 * 2) + (1 * 1)> chain{};
+    for(std::size_t i{ 0 }; i < SIZE * SIZE; ++i)
+        chain[i] = static_cast<std::byte>(i < 8 ? 0 : 255);
+
+    boxFilterMips(chain, SIZE, SIZE, 1, mipLevelCount(SIZE, SIZE));
+
+    EXPECT_EQ(std::byte(0), chain[16]);
+    EXPECT_EQ(std::byte(255), chain[18]);
+    EXPECT_EQ(std::byte(128), chain[20]);
+}
+
+} // namespace sfa::testing
@@ -0,0 +1,86 @@
+#include "core/PixelBuffer.hpp"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdlib>
+#include <type_traits>
+#include <utility>
+
+namespace
+{
+
+int g_frees{ 0 };
+
+/// \brief Free function of a \ref sfa::PixelBuffer that counts how often it ran.
+void countingFree(void* data)
+{
+    ++g_frees;
+    std::free(data); // NOLINT(cppcoreguidelines-no-malloc): pairs with the std::malloc of the tests
+}
+
+} // namespace
+
+namespace sfa::testing
+{
+
+/// \brief Test the features of the \ref PixelBuffer.
+///
+/// \author Felix Hommel
+/// \date 3/19/2026
+class PixelBufferTest : public ::testing::Test
+{
+public:
+    PixelBufferTest() = default;
+    ~PixelBufferTest() override = default;
+
+    PixelBufferTest(const PixelBufferTest&) = delete;
+    PixelBufferTest& operator=(const PixelBufferTest&) = delete;
+    PixelBufferTest(PixelBufferTest&&) = delete;
+    PixelBufferTest& operator=(PixelBufferTest&&) = delete;
+
+protected:
+    static constexpr std::size_t BUFFER_SIZE{ 64 };
+
+    void SetUp() override { ::g_frees = 0; }
+};
+
+/// \brief Move adopted memory through multiple buffers.
+///
+/// The memory keeps its address while it is moved around and is freed exactly once, by the last owner.
+TEST_F(PixelBufferTest, MovesWithoutCopying)
+{
+    void* memory{ std::malloc(BUFFER_SIZE) }; // NOLINT(cppcoreguidelines-no-malloc): freed by the buffer
+    {
+        PixelBuffer first{ memory, BUFFER_SIZE, &::countingFree };
+        PixelBuffer second{ std::move(first) };
+        PixelBuffer third;
+        third = std::move(second);
+
+        EXPECT_EQ(memory, third.data());
+        EXPECT_EQ(BUFFER_SIZE, third.size());
+        EXPECT_EQ(0, ::g_frees);
+    }
+
+    EXPECT_EQ(1, ::g_frees);
+    EXPECT_FALSE(std::is_copy_constructible_v<PixelBuffer>);
+    EXPECT_FALSE(std::is_copy_assignable_v<PixelBuffer>);
+}
+
+/// \brief Copy pixels into a new buffer.
+///
+/// A buffer created from existing pixels owns a copy of them.
+TEST_F(PixelBufferTest, CopyOfOwnsCopy)
+{
+    constexpr std::array PIXELS{ std::byte(1), std::byte(2), std::byte(3), std::byte(4) };
+
+    const auto buffer{ PixelBuffer::copyOf(PIXELS) };
+
+    ASSERT_EQ(PIXELS.size(), buffer.size());
+    EXPECT_NE(PIXELS.data(), buffer.data());
+    for(std::size_t i{ 0 }; i < PIXELS.size(); ++i)
+        EXPECT_EQ(PIXELS[i], buffer.bytes()[i]);
+}
+
+} // namespace sfa::testing
@@ -0,0 +1,164 @@
+#include "core/Profiler.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <set>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace
+{
+
+constexpr auto ZONE_NAME{ "ProfilerTest::zone" };
+constexpr std::size_t THREAD_COUNT{ 4 };
+constexpr std::size_t OVERFLOW_EVENTS{ 10 };
+
+} // namespace
+
+namespace sfa::testing
+{
+
+/// \brief Test the features of the \ref profiling::Profiler.
+///
+/// \author Felix Hommel
+/// \date 3/11/2026
+class ProfilerTest : public ::testing::Test
+{
+public:
+    ProfilerTest() = default;
+    ~ProfilerTest() override = default;
+
+    ProfilerTest(const ProfilerTest&) = delete;
+    ProfilerTest& operator=(const ProfilerTest&) = delete;
+    ProfilerTest(ProfilerTest&&) = delete;
+    ProfilerTest& operator=(ProfilerTest&&) = delete;
+
+protected:
+    profiling::Profiler& m_profiler{ profiling::Profiler::instance() };
+
+    void SetUp() override { m_profiler.clear(); }
+
+    /// \brief Get all collected events with the name \p name.
+    [[nodiscard]] std::vector<profiling::CollectedEvent> eventsNamed(std::string_view name)
+    {
+        m_profiler.collect();
+
+        auto events{ m_profiler.events() };
+        std::erase_if(events, [name](const profiling::CollectedEvent& event) { return event.zone.name != name; });
+
+        return events;
+    }
+};
+
+/// \brief Test that a scoped zone records its name and a valid time span.
+TEST_F(ProfilerTest, ScopedZoneRecordsEvent)
+{
+    {
+        const profiling::ScopedZone zone{ ::ZONE_NAME };
+    }
+
+    const auto events{ eventsNamed(::ZONE_NAME) };
+
+    ASSERT_EQ(events.size(), 1);
+    EXPECT_LE(events[0].zone.startNs, events[0].zone.endNs);
+}
+
+/// \brief Test that zones of different threads are captured with distinct thread ids.
+TEST_F(ProfilerTest, CapturesZonesOfAllThreads)
+{
+    std::vector<std::thread> threads;
+    for(std::size_t i{ 0 }; i < ::THREAD_COUNT; ++i)
+        threads.emplace_back([] { const profiling::ScopedZone zone{ ::ZONE_NAME }; });
+
+    for(auto& thread : threads)
+        thread.join();
+
+    const auto events{ eventsNamed(::ZONE_NAME) };
+    std::set<std::uint32_t> threadIds;
+    for(const auto& event : events)
+        threadIds.insert(event.threadId);
+
+    EXPECT_EQ(events.size(), ::THREAD_COUNT);
+    EXPECT_EQ(threadIds.size(), ::THREAD_COUNT);
+}
+
+/// \brief Test that the exported trace contains the zones and the thread names.
+TEST_F(ProfilerTest, WritesChromeTrace)
+{
+    std::thread worker{ [] {
+        profiling::Profiler::instance().setThreadName("Profiler \"worker\"");
+        const profiling::ScopedZone zone{ ::ZONE_NAME };
+    } };
+    worker.join();
+
+    std::stringstream stream;
+    m_profiler.writeChromeTrace(stream);
+    const auto trace{ stream.str() };
+
+    EXPECT_NE(trace.find(R"("traceEvents":[)"), std::string::npos);
+    EXPECT_NE(trace.find(R"("ph":"X")"), std::string::npos);
+    EXPECT_NE(trace.find(::ZONE_NAME), std::string::npos);
+    EXPECT_NE(trace.find(R"(Profiler \"worker\")"), std::string::npos);
+}
+
+/// \brief Test that threads started one after another reuse the buffer of the exited thread and keep their events.
+TEST_F(ProfilerTest, RecyclesBuffersOfExitedThreads)
+{
+    const auto recordOnNewThread{ [] {
+        std::thread worker{ [] { const profiling::ScopedZone zone{ ::ZONE_NAME }; } };
+        worker.join();
+    } };
+
+    recordOnNewThread();
+    const auto buffers{ m_profiler.bufferCount() };
+
+    for(std::size_t i{ 0 }; i < ::THREAD_COUNT; ++i)
+        recordOnNewThread();
+
+    const auto events{ eventsNamed(::ZONE_NAME) };
+    std::set<std::uint32_t> threadIds;
+    for(const auto& event : events)
+        threadIds.insert(event.threadId);
+
+    EXPECT_EQ(m_profiler.bufferCount(), buffers);
+    EXPECT_EQ(events.size(), ::THREAD_COUNT + 1);
+    EXPECT_EQ(threadIds.size(), ::THREAD_COUNT + 1);
+}
+
+/// \brief Test that a full thread buffer drops and counts new events instead of blocking.
+TEST_F(ProfilerTest, FullBufferDropsEvents)
+{
+    const auto droppedBefore{ m_profiler.droppedEvents() };
+
+    std::thread worker{ [] {
+        auto& profiler{ profiling::Profiler::instance() };
+        for(std::size_t i{ 0 }; i < profiling::ThreadBuffer::CAPACITY + ::OVERFLOW_EVENTS; ++i)
+            profiler.record({ .name = ::ZONE_NAME, .startNs = 0, .endNs = 0 });
+    } };
+    worker.join();
+
+    EXPECT_EQ(m_profiler.droppedEvents() - droppedBefore, ::OVERFLOW_EVENTS);
+    EXPECT_EQ(eventsNamed(::ZONE_NAME).size(), profiling::ThreadBuffer::CAPACITY);
+}
+
+/// \brief Test that the macros only record zones when profiling is enabled.
+TEST_F(ProfilerTest, MacroFollowsBuildFlag)
+{
+    {
+        SFA_PROFILE_SCOPE(::ZONE_NAME);
+    }
+
+#if SFA_ENABLE_PROFILING
+    EXPECT_EQ(eventsNamed(::ZONE_NAME).size(), 1);
+#else
+    EXPECT_TRUE(eventsNamed(::ZONE_NAME).empty());
+#endif
+}
+
+} // namespace sfa::testing
@@ -0,0 +1,110 @@
+#include "core/Sampler.hpp"
+
+#include "fixtures/OpenGLTestFixture.hpp"
+
+#include <glad/gl.h>
+
+#include <gtest/gtest.h>
+
+#include <memory>
+
+namespace sfa::testing
+{
+
+/// \brief Test the features of the \ref Sampler and the \ref SamplerCache.
+///
+/// \author Felix Hommel
+/// \date 3/23/2026
+class SamplerTest : public ::testing::Test
+{
+public:
+    SamplerTest() = default;
+    ~SamplerTest() override = default;
+
+    SamplerTest(const SamplerTest&) = delete;
+    SamplerTest(SamplerTest&&) = delete;
+    SamplerTest& operator=(const SamplerTest&) = delete;
+    SamplerTest& operator=(SamplerTest&&) = delete;
+
+    void SetUp() override
+    {
+        if(!m_context->setup())
+            GTEST_SKIP() << m_context->getSkipReason();
+    }
+
+    void TearDown() override { m_context->teardown(); }
+
+protected:
+    static constexpr SamplerState MIPMAPPED{ .wrapS = GL_CLAMP_TO_EDGE,
+                                             .wrapT = GL_CLAMP_TO_EDGE,
+                                             .minFilter = GL_LINEAR_MIPMAP_LINEAR,
+                                             .magFilter = GL_NEAREST };
+
+private:
+    std::unique_ptr<OpenGLTestFixture> m_context{ std::make_unique<OpenGLTestFixture>() };
+};
+
+/// \brief Test the \ref Sampler RAII behavior.
+///
+/// The constructor should create a sampler with the parameters of its state and the destructor should delete it.
+TEST_F(SamplerTest, SamplerRAII)
+{
+    unsigned int samplerID{};
+    {
+        const Sampler sampler{ MIPMAPPED };
+        samplerID = sampler.getID();
+
+        ASSERT_EQ(GL_TRUE, glIsSampler(samplerID));
+
+        int minFilter{ 0 };
+        int wrapS{ 0 };
+        glGetSamplerParameteriv(samplerID, GL_TEXTURE_MIN_FILTER, &minFilter);
+        glGetSamplerParameteriv(samplerID, GL_TEXTURE_WRAP_S, &wrapS);
+        EXPECT_EQ(GL_LINEAR_MIPMAP_LINEAR, minFilter);
+        EXPECT_EQ(GL_CLAMP_TO_EDGE, wrapS);
+    }
+
+    EXPECT_EQ(GL_FALSE, glIsSampler(samplerID));
+}
+
+/// \brief Bind a sampler to a texture unit.
+///
+/// The sampler is bound to the given unit until it is unbound again.
+TEST_F(SamplerTest, BindSamplerToTextureUnit)
+{
+    const Sampler sampler{ MIPMAPPED };
+    sampler.bind(1);
+
+    int boundSampler{ 0 };
+    glActiveTexture(GL_TEXTURE1);
+    glGetIntegerv(GL_SAMPLER_BINDING, &boundSampler);
+    EXPECT_EQ(sampler.getID(), static_cast<unsigned int>(boundSampler));
+
+    Sampler::unbind(1);
+    glGetIntegerv(GL_SAMPLER_BINDING, &boundSampler);
+    EXPECT_EQ(0, boundSampler);
+    glActiveTexture(GL_TEXTURE0);
+}
+
+/// \brief Request samplers from a \ref SamplerCache.
+///
+/// Requests for the same state share a single sampler, a different state gets a sampler of its own.
+TEST_F(SamplerTest, CacheDeduplicatesSamplers)
+{
+    SamplerCache cache;
+
+    const auto linear{ cache.get(SamplerState{}) };
+    const auto mipmapped{ cache.get(MIPMAPPED) };
+
+    EXPECT_EQ(linear, cache.get(SamplerState{}));
+    EXPECT_EQ(mipmapped, cache.get(MIPMAPPED));
+    EXPECT_NE(linear, mipmapped);
+    EXPECT_EQ(2, cache.size());
+    EXPECT_EQ(MIPMAPPED, mipmapped->state());
+
+    cache.clear();
+    EXPECT_EQ(0, cache.size());
+    EXPECT_EQ(GL_TRUE, glIsSampler(mipmapped->getID()));
+}
+
+} // namespace sfa::testing
@@ -0,0 +1,154 @@
+#include "core/TextureCompression.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+namespace
+{
+
+constexpr std::size_t RGBA_CHANNELS{ 4 };
+
+using Texel = std::array<std::uint8_t, RGBA_CHANNELS>;
+
+/// \brief A BC1 color block with the given end points and 2 bit indices.
+std::array<std::byte, 8> bc1Block(std::uint16_t color0, std::uint16_t color1, std::uint32_t indices)
+{
+    return { static_cast<std::byte>(color0 & 0xffu),          static_cast<std::byte>(color0 >> 8u),
+             static_cast<std::byte>(color1 & 0xffu),          static_cast<std::byte>(color1 >> 8u),
+             static_cast<std::byte>(indices & 0xffu),         static_cast<std::byte>((indices >> 8u) & 0xffu),
+             static_cast<std::byte>((indices >> 16u) & 0xffu), static_cast<std::byte>(indices >> 24u) };
+}
+
+Texel texelAt(std::span<const std::byte> pixels, std::size_t width, std::size_t x, std::size_t y)
+{
+    const auto* texel{ pixels.data() + (y * width + x) * RGBA_CHANNELS };
+
+    return { static_cast<std::uint8_t>(texel[0]),
+             static_cast<std::uint8_t>(texel[1]),
+             static_cast<std::uint8_t>(texel[2]),
+             static_cast<std::uint8_t>(texel[3]) };
+}
+
+/// \brief Pure red and pure blue in RGB565.
+constexpr std::uint16_t RED{ 0xf800 };
+constexpr std::uint16_t BLUE{ 0x001f };
+/// \brief Every row of a block uses the indices 0, 1, 2, 3 from left to right.
+constexpr std::uint32_t COLUMN_INDICES{ 0xe4e4e4e4 };
+
+} // namespace
+
+namespace sfa::testing
+{
+
+/// \brief Test decoding block compressed textures on the CPU.
+///
+/// \author Felix Hommel
+/// \date 3/22/2026
+class TextureCompressionTest : public ::testing::Test
+{
+public:
+    TextureCompressionTest() = default;
+    ~TextureCompressionTest() override = default;
+
+    TextureCompressionTest(const TextureCompressionTest&) = delete;
+    TextureCompressionTest& operator=(const TextureCompressionTest&) = delete;
+    TextureCompressionTest(TextureCompressionTest&&) = delete;
+    TextureCompressionTest& operator=(TextureCompressionTest&&) = delete;
+};
+
+/// \brief Decode a BC1 block whose first end point is the larger one.
+///
+/// The block interpolates two additional colors at a third and two thirds between its end points.
+TEST_F(TextureCompressionTest, DecompressBc1FourColors)
+{
+    const auto block{ ::bc1Block(RED, BLUE, COLUMN_INDICES) };
+
+    const auto pixels{ decompress(TextureCompression::Bc1Rgb, 4, 4, block) };
+    ASSERT_EQ(4 * 4 * RGBA_CHANNELS, pixels.size());
+
+    EXPECT_EQ((::Texel{ 255, 0, 0, 255 }), ::texelAt(pixels.bytes(), 4, 0, 0));
+    EXPECT_EQ((::Texel{ 0, 0, 255, 255 }), ::texelAt(pixels.bytes(), 4, 1, 1));
+    EXPECT_EQ((::Texel{ 170, 0, 85, 255 }), ::texelAt(pixels.bytes(), 4, 2, 2));
+    EXPECT_EQ((::Texel{ 85, 0, 170, 255 }), ::texelAt(pixels.bytes(), 4, 3, 3));
+}
+
+/// \brief Decode a BC1 block whose first end point is the smaller one.
+///
+/// The block interpolates a single color halfway between its end points, its fourth color is black, which is
+/// transparent if the texture has alpha.
+TEST_F(TextureCompressionTest, DecompressBc1ThreeColors)
+{
+    const auto block{ ::bc1Block(BLUE, RED, COLUMN_INDICES) };
+
+    const auto opaque{ decompress(TextureCompression::Bc1Rgb, 4, 4, block) };
+    const auto transparent{ decompress(TextureCompression::Bc1Rgba, 4, 4, block) };
+
+    EXPECT_EQ((::Texel{ 127, 0, 127, 255 }), ::texelAt(opaque.bytes(), 4, 2, 0));
+    EXPECT_EQ((::Texel{ 0, 0, 0, 255 }), ::texelAt(opaque.bytes(), 4, 3, 0));
+    EXPECT_EQ((::Texel{ 0, 0, 0, 0 }), ::texelAt(transparent.bytes(), 4, 3, 0));
+}
+
+/// \brief Decode a BC3 block.
+///
+/// The alpha of every texel is interpolated between the alpha end points, independent of its color.
+TEST_F(TextureCompressionTest, DecompressBc3)
+{
+    // NOTE: Every texel uses alpha index 2, which lies a seventh from the first end point
+    std::uint64_t alphaIndices{ 0 };
+    for(std::size_t i{ 0 }; i < 16; ++i)
+        alphaIndices |= std::uint64_t{ 2 } << (3 * i);
+
+    std::array<std::byte, 16> block{ std::byte(255), std::byte(0) };
+    for(std::size_t i{ 0 }; i < 6; ++i)
+        block[2 + i] = static_cast<std::byte>((alphaIndices >> (8 * i)) & 0xffu);
+
+    const auto color{ ::bc1Block(BLUE, RED, COLUMN_INDICES) };
+    std::ranges::copy(color, block.begin() + 8);
+
+    const auto pixels{ decompress(TextureCompression::Bc3Rgba, 4, 4, block) };
+    ASSERT_EQ(4 * 4 * RGBA_CHANNELS, pixels.size());
+
+    // NOTE: BC3 color blocks always use four colors, even if the first end point is the smaller one
+    EXPECT_EQ((::Texel{ 0, 0, 255, 218 }), ::texelAt(pixels.bytes(), 4, 0, 0));
+    EXPECT_EQ((::Texel{ 85, 0, 170, 218 }), ::texelAt(pixels.bytes(), 4, 2, 1));
+}
+
+/// \brief Decode a texture whose size isn't a multiple of the block size.
+///
+/// The texels of the edge blocks that lie outside of the texture are dropped.
+TEST_F(TextureCompressionTest, DecompressPartialBlocks)
+{
+    constexpr int WIDTH{ 5 };
+    constexpr int HEIGHT{ 3 };
+
+    std::array<std::byte, 16> blocks{};
+    std::ranges::copy(::bc1Block(RED, BLUE, 0), blocks.begin());
+    std::ranges::copy(::bc1Block(RED, BLUE, 0x55555555), blocks.begin() + 8);
+
+    ASSERT_EQ(blocks.size(), compressedSize(TextureCompression::Bc1Rgb, WIDTH, HEIGHT));
+
+    const auto pixels{ decompress(TextureCompression::Bc1Rgb, WIDTH, HEIGHT, blocks) };
+    ASSERT_EQ(WIDTH * HEIGHT * RGBA_CHANNELS, pixels.size());
+
+    EXPECT_EQ((::Texel{ 255, 0, 0, 255 }), ::texelAt(pixels.bytes(), WIDTH, 3, 2));
+    EXPECT_EQ((::Texel{ 0, 0, 255, 255 }), ::texelAt(pixels.bytes(), WIDTH, 4, 2));
+}
+
+/// \brief Decode data that can't be decoded.
+///
+/// Too few blocks and formats without a CPU decoder result in an empty buffer.
+TEST_F(TextureCompressionTest, DecompressUnsupported)
+{
+    const auto block{ ::bc1Block(RED, BLUE, 0) };
+
+    EXPECT_TRUE(decompress(TextureCompression::Bc1Rgb, 8, 4, block).empty());
+    EXPECT_TRUE(decompress(TextureCompression::Etc2Rgb, 4, 4, block).empty());
+    EXPECT_FALSE(canDecompress(TextureCompression::Etc2Rgba));
+}
+
+} // namespace sfa::testing
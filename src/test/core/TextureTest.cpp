@@ -1,4 +1,7 @@
 #include "core/Texture.hpp"
+
+#include "core/Mipmaps.hpp"
+#include "core/TextureCompression.hpp"
 #include "fixtures/OpenGLTestFixture.hpp"
 
 #include <glad/gl.h>
@@ -107,5 +110,79 @@ TEST_F(TextureTest, TextureBindActivatesTheTexture)
     EXPECT_EQ(boundTexture, texture.getID());
 }
 
-} // namespace sfa::testing
+/// \brief Create a texture from BC1 blocks.
+///
+/// The driver decodes the blocks to the same texels as the CPU fallback, up to the rounding of interpolated colors.
+TEST_F(TextureTest, CompressedTextureMatchesSoftwareDecode)
+{
+    if(!Texture2D::supports(TextureCompression::Bc1Rgb))
+        GTEST_SKIP() << "The driver doesn't support BC1 textures";
+
+    // NOTE: Red and blue end points, every row of the block uses all four of its colors
+    constexpr std::array BLOCK{ std::byte(0x00), std::byte(0xf8), std::byte(0x1f), std::byte(0x00),
+                                std::byte(0xe4), std::byte(0xe4), std::byte(0xe4), std::byte(0xe4) };
+    constexpr int BLOCK_TEXELS{ 4 };
+    constexpr int MAX_ROUNDING_ERROR{ 2 };
+
+    const Texture2D texture(BLOCK_TEXELS, BLOCK_TEXELS, TextureCompression::Bc1Rgb, BLOCK);
+    EXPECT_EQ(TextureCompression::Bc1Rgb, texture.compression());
+
+    std::array<std::byte, static_cast<std::size_t>(BLOCK_TEXELS * BLOCK_TEXELS * 4)> hardware{};
+    texture.bind();
+    glGetTexImage(GL_TEXTURE_2D, 0, GL_RGBA, GL_UNSIGNED_BYTE, hardware.data());
+
+    const auto software{ decompress(TextureCompression::Bc1Rgb, BLOCK_TEXELS, BLOCK_TEXELS, BLOCK) };
+    ASSERT_EQ(hardware.size(), software.size());
+    for(std::size_t i{ 0 }; i < hardware.size(); ++i)
+        EXPECT_NEAR(static_cast<int>(hardware[i]), static_cast<int>(software.bytes()[i]), MAX_ROUNDING_ERROR);
+}
+
+/// \brief Create a texture together with its mip chain.
+///
+/// Every level is uploaded as it is and the texture is limited to the levels it holds.
+TEST_F(TextureTest, TextureWithMipChain)
+{
+    constexpr int SIZE{ 4 };
+    constexpr int CHANNELS{ 4 };
+
+    std::array<std::byte, SIZE * SIZE * CHANNELS> pixels{};
+    pixels.fill(std::byte(200));
+    const auto chain{ buildMipChain(pixels, SIZE, SIZE, CHANNELS) };
+
+    const Texture2D texture(SIZE, SIZE, CHANNELS, chain, mipLevelCount(SIZE, SIZE));
+    EXPECT_EQ(3, texture.mipLevels());
 
+    texture.bind();
+    int maxLevel{ 0 };
+    glGetTexParameteriv(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, &maxLevel);
+    EXPECT_EQ(2, maxLevel);
+
+    std::array<std::byte, CHANNELS> smallest{};
+    glGetTexImage(GL_TEXTURE_2D, 2, GL_RGBA, GL_UNSIGNED_BYTE, smallest.data());
+    EXPECT_EQ(std::byte(200), smallest[0]);
+}
+
+/// \brief Let the driver generate the mip chain of a texture.
+///
+/// A texture starts out with only its full resolution level, generating mip levels extends it to the full chain.
+TEST_F(TextureTest, GenerateMipmaps)
+{
+    constexpr int SIZE{ 8 };
+    constexpr int CHANNELS{ 4 };
+
+    std::array<std::byte, SIZE * SIZE * CHANNELS> pixels{};
+    pixels.fill(std::byte(100));
+
+    Texture2D texture(SIZE, SIZE, CHANNELS, pixels);
+    EXPECT_EQ(1, texture.mipLevels());
+
+    texture.generateMipmaps();
+    EXPECT_EQ(4, texture.mipLevels());
+
+    texture.bind();
+    std::array<std::byte, CHANNELS> smallest{};
+    glGetTexImage(GL_TEXTURE_2D, 3, GL_RGBA, GL_UNSIGNED_BYTE, smallest.data());
+    EXPECT_EQ(std::byte(100), smallest[0]);
+}
+
+} // namespace sfa::testing
@@ -0,0 +1,119 @@
+#include "core/TextureUploader.hpp"
+
+#include "core/Texture.hpp"
+#include "fixtures/OpenGLTestFixture.hpp"
+
+#include <glad/gl.h>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <span>
+#include <vector>
+
+namespace sfa::testing
+{
+
+/// \brief Test the features of the \ref TextureUploader.
+///
+/// \author Felix Hommel
+/// \date 3/18/2026
+class TextureUploaderTest : public ::testing::Test
+{
+public:
+    TextureUploaderTest() = default;
+    ~TextureUploaderTest() override = default;
+
+    TextureUploaderTest(const TextureUploaderTest&) = delete;
+    TextureUploaderTest(TextureUploaderTest&&) = delete;
+    TextureUploaderTest& operator=(const TextureUploaderTest&) = delete;
+    TextureUploaderTest& operator=(TextureUploaderTest&&) = delete;
+
+    void SetUp() override
+    {
+        if(!m_context->setup())
+            GTEST_SKIP() << m_context->getSkipReason();
+    }
+
+    void TearDown() override { m_context->teardown(); }
+
+protected:
+    static constexpr auto TEST_IMAGE_WIDTH{ 3 };
+    static constexpr auto TEST_IMAGE_HEIGHT{ 8 };
+    static constexpr auto TEST_IMAGE_CHANNELS{ 3 };
+
+    /// \brief Create tightly packed RGB pixels where every byte is unique within a row.
+    static std::vector<std::byte> createPixels()
+    {
+        std::vector<std::byte> pixels(TEST_IMAGE_WIDTH * TEST_IMAGE_HEIGHT * TEST_IMAGE_CHANNELS);
+        for(std::size_t i{ 0 }; i < pixels.size(); ++i)
+            pixels[i] = static_cast<std::byte>(i);
+
+        return pixels;
+    }
+
+    /// \brief Read back the pixels of \p texture, tightly packed.
+    static std::vector<std::byte> readPixels(const Texture2D& texture)
+    {
+        std::vector<std::byte> pixels(texture.rowSize() * static_cast<std::size_t>(texture.height()));
+
+        texture.bind();
+        glPixelStorei(GL_PACK_ALIGNMENT, 1);
+        glGetTexImage(GL_TEXTURE_2D, 0, GL_RGB, GL_UNSIGNED_BYTE, pixels.data());
+        glPixelStorei(GL_PACK_ALIGNMENT, 4);
+
+        return pixels;
+    }
+
+private:
+    std::unique_ptr<OpenGLTestFixture> m_context{ std::make_unique<OpenGLTestFixture>() };
+};
+
+/// \brief Stream a texture in chunks of rows.
+///
+/// Uploading the rows of a texture chunk by chunk through the pixel buffers yields the same texture as uploading it at
+/// once, also when the chunks don't end on a 4 byte boundary.
+TEST_F(TextureUploaderTest, ChunkedUploadMatchesSource)
+{
+    constexpr int CHUNK_ROWS{ 3 };
+
+    const auto pixels{ createPixels() };
+    Texture2D texture(TEST_IMAGE_WIDTH, TEST_IMAGE_HEIGHT, TEST_IMAGE_CHANNELS, std::span<const std::byte>{});
+    TextureUploader uploader;
+
+    const auto rowSize{ texture.rowSize() };
+    for(int row{ 0 }; row < TEST_IMAGE_HEIGHT; row += CHUNK_ROWS)
+    {
+        const auto rows{ std::min(CHUNK_ROWS, TEST_IMAGE_HEIGHT - row) };
+        const auto chunk{ std::span{ pixels }.subspan(
+            static_cast<std::size_t>(row) * rowSize, static_cast<std::size_t>(rows) * rowSize
+        ) };
+        uploader.upload(texture, row, rows, chunk);
+    }
+
+    EXPECT_EQ(GL_NO_ERROR, glGetError());
+    EXPECT_EQ(pixels, readPixels(texture));
+}
+
+/// \brief Upload a chunk that is larger than a pixel buffer.
+///
+/// Chunks that don't fit into a pixel buffer are uploaded straight from client memory.
+TEST_F(TextureUploaderTest, OversizedChunkUploadsDirectly)
+{
+    const auto pixels{ createPixels() };
+    Texture2D texture(TEST_IMAGE_WIDTH, TEST_IMAGE_HEIGHT, TEST_IMAGE_CHANNELS, std::span<const std::byte>{});
+    TextureUploader uploader{ texture.rowSize() };
+
+    uploader.upload(texture, 0, TEST_IMAGE_HEIGHT, pixels);
+
+    int boundBuffer{ -1 };
+    glGetIntegerv(GL_PIXEL_UNPACK_BUFFER_BINDING, &boundBuffer);
+
+    EXPECT_EQ(0, boundBuffer);
+    EXPECT_EQ(GL_NO_ERROR, glGetError());
+    EXPECT_EQ(pixels, readPixels(texture));
+}
+
+} // namespace sfa::testing
@@ -0,0 +1,241 @@
+#include "core/resourceManagement/AssetPackLoader.hpp"
+
+#include "core/PixelBuffer.hpp"
+#include "core/TextureCompression.hpp"
+#include "core/resourceManagement/AssetPackWriter.hpp"
+#include "core/resourceManagement/IntermediateResourceData.hpp"
+#include "core/resourceManagement/ResourceError.hpp"
+#include "testUtility/AllocationCounter.hpp"
+#include "testUtility/ResourceGenerator.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <span>
+#include <string_view>
+#include <variant>
+#include <vector>
+
+namespace sfa::testing
+{
+
+/// \brief Test writing asset packs with the \ref AssetPackWriter and reading them with the \ref AssetPackLoader.
+///
+/// \author Felix Hommel
+/// \date 3/20/2026
+class AssetPackTest : public ::testing::Test
+{
+public:
+    AssetPackTest() = default;
+    ~AssetPackTest() override = default;
+
+    AssetPackTest(const AssetPackTest&) = delete;
+    AssetPackTest& operator=(const AssetPackTest&) = delete;
+    AssetPackTest(AssetPackTest&&) noexcept = delete;
+    AssetPackTest& operator=(AssetPackTest&&) noexcept = delete;
+
+protected:
+    static constexpr std::string_view SHADER_SOURCE{ "#version 330 core\nvoid main() {}\n" };
+
+    std::unique_ptr<ResourceGenerator> m_generator{
+        std::make_unique<ResourceGenerator>(::testing::UnitTest::GetInstance()->current_test_info())
+    };
+
+    [[nodiscard]] std::filesystem::path packPath() const { return m_generator->resourcePath() / "test.sfapack"; }
+
+    /// \brief Create a texture whose pixels count up from 0.
+    static TextureRawData createTexture(int width, int height, int channels)
+    {
+        const auto size{ static_cast<std::size_t>(width * height * channels) };
+        auto pixels{ PixelBuffer::allocate(size) };
+        for(std::size_t i{ 0 }; i < size; ++i)
+            pixels.bytes()[i] = static_cast<std::byte>(i);
+
+        return { .width = width, .height = height, .channels = channels, .pixels = std::move(pixels) };
+    }
+
+    /// \brief Open the pack with the directory of the generator as its root.
+    [[nodiscard]] std::unique_ptr<AssetPackLoader> openPack() const
+    {
+        auto loader{ AssetPackLoader::open(packPath(), m_generator->resourcePath()) };
+        EXPECT_TRUE(loader.has_value());
+
+        return loader ? std::move(*loader) : nullptr;
+    }
+};
+
+/// \brief Load packed textures and shaders.
+///
+/// Resources are looked up by the paths of the files they were packed from, the loaded data matches the packed data.
+TEST_F(AssetPackTest, LoadPackedResources)
+{
+    constexpr int TEXTURE_SIZE{ 4 };
+    constexpr int TEXTURE_CHANNELS{ 3 };
+
+    const auto texture{ createTexture(TEXTURE_SIZE, TEXTURE_SIZE, TEXTURE_CHANNELS) };
+    const auto source{ std::as_bytes(std::span{ SHADER_SOURCE }) };
+
+    AssetPackWriter writer;
+    writer.addTexture("textures/ship.png", texture);
+    writer.addData("test.vert", source);
+    writer.addData("test.frag", source);
+    ASSERT_TRUE(writer.write(packPath()).has_value());
+
+    auto loader{ openPack() };
+    ASSERT_NE(nullptr, loader);
+    EXPECT_EQ(3, loader->size());
+
+    const auto textureResult{ loader->loadTexture(m_generator->resourcePath() / "textures" / "ship.png") };
+    ASSERT_TRUE(textureResult.has_value());
+    const auto& loadedTexture{ std::get<TextureRawData>(*textureResult) };
+    EXPECT_EQ(TEXTURE_SIZE, loadedTexture.width);
+    EXPECT_EQ(TEXTURE_SIZE, loadedTexture.height);
+    EXPECT_EQ(TEXTURE_CHANNELS, loadedTexture.channels);
+    ASSERT_EQ(texture.pixels.size(), loadedTexture.pixels.size());
+    EXPECT_TRUE(std::ranges::equal(texture.pixels.bytes(), loadedTexture.pixels.bytes()));
+
+    const auto shaderResult{ loader->loadShader(m_generator->vertPath(), m_generator->fragPath()) };
+    ASSERT_TRUE(shaderResult.has_value());
+    EXPECT_EQ(SHADER_SOURCE, std::get<ShaderSourceData>(*shaderResult).vertexSource);
+    EXPECT_EQ(SHADER_SOURCE, std::get<ShaderSourceData>(*shaderResult).fragmentSource);
+}
+
+/// \brief Load a packed texture without copying it.
+///
+/// The pixels of a packed texture are borrowed from the mapped pack, loading it allocates far less than its size.
+TEST_F(AssetPackTest, LoadTextureDoesNotCopyPixels)
+{
+    constexpr int TEXTURE_SIZE{ 64 };
+    constexpr int TEXTURE_CHANNELS{ 4 };
+
+    AssetPackWriter writer;
+    writer.addTexture("ship.png", createTexture(TEXTURE_SIZE, TEXTURE_SIZE, TEXTURE_CHANNELS));
+    ASSERT_TRUE(writer.write(packPath()).has_value());
+
+    auto loader{ openPack() };
+    ASSERT_NE(nullptr, loader);
+
+    std::size_t allocatedBytes{ 0 };
+    std::size_t textureSize{ 0 };
+    {
+        const AllocationCounter allocationCounter;
+
+        const auto result{ loader->loadTexture("ship.png") };
+        ASSERT_TRUE(result.has_value());
+        textureSize = std::get<TextureRawData>(*result).pixels.size();
+
+        allocatedBytes = allocationCounter.bytes();
+    }
+
+    EXPECT_EQ(static_cast<std::size_t>(TEXTURE_SIZE * TEXTURE_SIZE * TEXTURE_CHANNELS), textureSize);
+    EXPECT_LT(allocatedBytes, textureSize);
+}
+
+/// \brief Pack a texture together with its mip levels.
+///
+/// Every mip level is a box filtered half of the previous one, down to a single texel. Loading the texture hands out
+/// every level.
+TEST_F(AssetPackTest, PackTextureWithMips)
+{
+    constexpr int TEXTURE_WIDTH{ 4 };
+    constexpr int TEXTURE_HEIGHT{ 2 };
+    constexpr std::size_t PACKED_SIZE{ (4 * 2) + (2 * 1) + (1 * 1) };
+
+    AssetPackWriter writer;
+    writer.addTexture("ship.png", createTexture(TEXTURE_WIDTH, TEXTURE_HEIGHT, 1), true);
+    ASSERT_TRUE(writer.write(packPath()).has_value());
+
+    auto loader{ openPack() };
+    ASSERT_NE(nullptr, loader);
+
+    const auto data{ loader->loadData("ship.png") };
+    ASSERT_TRUE(data.has_value());
+    ASSERT_EQ(PACKED_SIZE, data->size());
+
+    // NOTE: Level 0 is 0 1 2 3 / 4 5 6 7, so level 1 is (0+1+4+5)/4 and (2+3+6+7)/4 rounded, level 2 their average
+    EXPECT_EQ(std::byte(3), (*data)[8]);
+    EXPECT_EQ(std::byte(5), (*data)[9]);
+    EXPECT_EQ(std::byte(4), (*data)[10]);
+
+    const auto texture{ loader->loadTexture("ship.png") };
+    ASSERT_TRUE(texture.has_value());
+    EXPECT_EQ(3, std::get<TextureRawData>(*texture).mipLevels);
+    EXPECT_EQ(PACKED_SIZE, std::get<TextureRawData>(*texture).pixels.size());
+}
+
+/// \brief Pack a block compressed texture.
+///
+/// Compressed blocks are packed as they are, without mip levels, and loaded together with their compression.
+TEST_F(AssetPackTest, PackCompressedTexture)
+{
+    constexpr int TEXTURE_SIZE{ 8 };
+
+    auto texture{ createTexture(TEXTURE_SIZE, TEXTURE_SIZE / 4, 4) };
+    texture.width = TEXTURE_SIZE;
+    texture.height = TEXTURE_SIZE;
+    texture.compression = TextureCompression::Bc3Rgba;
+    ASSERT_EQ(texture.pixels.size(), compressedSize(texture.compression, TEXTURE_SIZE, TEXTURE_SIZE));
+
+    AssetPackWriter writer;
+    writer.addTexture("ship.ktx2", texture, true);
+    ASSERT_TRUE(writer.write(packPath()).has_value());
+
+    auto loader{ openPack() };
+    ASSERT_NE(nullptr, loader);
+
+    const auto result{ loader->loadTexture("ship.ktx2") };
+    ASSERT_TRUE(result.has_value());
+    const auto& loadedTexture{ std::get<TextureRawData>(*result) };
+    EXPECT_EQ(TextureCompression::Bc3Rgba, loadedTexture.compression);
+    EXPECT_EQ(TEXTURE_SIZE, loadedTexture.width);
+    EXPECT_TRUE(std::ranges::equal(texture.pixels.bytes(), loadedTexture.pixels.bytes()));
+    EXPECT_EQ(texture.pixels.size(), loader->loadData("ship.ktx2")->size());
+}
+
+/// \brief Request a resource that isn't packed.
+///
+/// When a path isn't part of the pack, loading it results in a std::unexpected value.
+TEST_F(AssetPackTest, LoadMissingEntry)
+{
+    AssetPackWriter writer;
+    writer.addData("test.vert", std::as_bytes(std::span{ SHADER_SOURCE }));
+    ASSERT_TRUE(writer.write(packPath()).has_value());
+
+    auto loader{ openPack() };
+    ASSERT_NE(nullptr, loader);
+
+    const auto result{ loader->loadTexture("missing.png") };
+    ASSERT_FALSE(result.has_value());
+    EXPECT_EQ(ResourceError::Type::FileNotFound, result.error().type);
+}
+
+/// \brief Open a file that isn't an asset pack.
+///
+/// When the file doesn't start with a valid pack header, opening it results in a std::unexpected value.
+TEST_F(AssetPackTest, OpenInvalidPack)
+{
+    std::ofstream(packPath(), std::ios::binary) << "definitely not an asset pack, but long enough for a header";
+
+    const auto loader{ AssetPackLoader::open(packPath(), m_generator->resourcePath()) };
+    ASSERT_FALSE(loader.has_value());
+    EXPECT_EQ(ResourceError::Type::InvalidFormat, loader.error().type);
+}
+
+/// \brief Write a pack with two entries of the same name.
+///
+/// Names have to be unique, otherwise writing the pack results in a std::unexpected value.
+TEST_F(AssetPackTest, WriteDuplicateEntries)
+{
+    AssetPackWriter writer;
+    writer.addData("test.vert", std::as_bytes(std::span{ SHADER_SOURCE }));
+    writer.addData("test.vert", std::as_bytes(std::span{ SHADER_SOURCE }));
+
+    EXPECT_FALSE(writer.write(packPath()).has_value());
+}
+
+} // namespace sfa::testing
@@ -0,0 +1,159 @@
+#include "core/resourceManagement/CachingResourceLoader.hpp"
+
+#include "core/PixelBuffer.hpp"
+#include "core/resourceManagement/DecodedTextureCache.hpp"
+#include "core/resourceManagement/IntermediateResourceData.hpp"
+#include "mocks/MockResourceLoader.hpp"
+#include "testUtility/ResourceGenerator.hpp"
+
+#include "gmock/gmock.h"
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <utility>
+#include <variant>
+
+namespace
+{
+
+constexpr int TEXTURE_SIZE{ 16 };
+constexpr int TEXTURE_CHANNELS{ 4 };
+
+/// \brief Create a texture whose pixels count up from 0, standing in for a decoded image.
+sfa::LoadResult decodeTexture(const std::filesystem::path& /*filepath*/)
+{
+    const auto size{ static_cast<std::size_t>(TEXTURE_SIZE * TEXTURE_SIZE * TEXTURE_CHANNELS) };
+    auto pixels{ sfa::PixelBuffer::allocate(size) };
+    for(std::size_t i{ 0 }; i < size; ++i)
+        pixels.bytes()[i] = static_cast<std::byte>(i);
+
+    return sfa::ResourceData{ sfa::TextureRawData{
+        .width = TEXTURE_SIZE, .height = TEXTURE_SIZE, .channels = TEXTURE_CHANNELS, .pixels = std::move(pixels) } };
+}
+
+} // namespace
+
+namespace sfa::testing
+{
+
+/// \brief Test caching decoded textures on the disk with the \ref CachingResourceLoader.
+///
+/// \author Felix Hommel
+/// \date 3/21/2026
+class CachingResourceLoaderTest : public ::testing::Test
+{
+public:
+    CachingResourceLoaderTest() = default;
+    ~CachingResourceLoaderTest() override = default;
+
+    CachingResourceLoaderTest(const CachingResourceLoaderTest&) = delete;
+    CachingResourceLoaderTest& operator=(const CachingResourceLoaderTest&) = delete;
+    CachingResourceLoaderTest(CachingResourceLoaderTest&&) noexcept = delete;
+    CachingResourceLoaderTest& operator=(CachingResourceLoaderTest&&) noexcept = delete;
+
+protected:
+    std::unique_ptr<ResourceGenerator> m_generator{
+        std::make_unique<ResourceGenerator>(::testing::UnitTest::GetInstance()->current_test_info())
+    };
+
+    [[nodiscard]] std::filesystem::path cachePath() const { return m_generator->resourcePath() / "cache"; }
+
+    /// \brief Create a loader whose wrapped mock is expected to decode \p decodes textures.
+    [[nodiscard]] std::unique_ptr<CachingResourceLoader> createLoader(
+        int decodes, std::uintmax_t maxCacheSize = DecodedTextureCache::DEFAULT_MAX_SIZE
+    ) const
+    {
+        auto mock{ std::make_unique<MockResourceLoader>() };
+        if(decodes == 0)
+            EXPECT_CALL(*mock, loadTexture(::testing::_)).Times(0);
+        else
+            EXPECT_CALL(*mock, loadTexture(::testing::_)).Times(decodes).WillRepeatedly(&::decodeTexture);
+
+        return std::make_unique<CachingResourceLoader>(std::move(mock), cachePath(), maxCacheSize);
+    }
+};
+
+/// \brief Load the same texture twice.
+///
+/// The texture is only decoded once, the second load is served from the cache and yields the same pixels.
+TEST_F(CachingResourceLoaderTest, SecondLoadIsCached)
+{
+    const auto loader{ createLoader(1) };
+
+    const auto decoded{ loader->loadTexture(m_generator->texPath()) };
+    const auto cached{ loader->loadTexture(m_generator->texPath()) };
+    ASSERT_TRUE(decoded.has_value());
+    ASSERT_TRUE(cached.has_value());
+
+    const auto& decodedTexture{ std::get<TextureRawData>(*decoded) };
+    const auto& cachedTexture{ std::get<TextureRawData>(*cached) };
+    EXPECT_EQ(decodedTexture.width, cachedTexture.width);
+    EXPECT_EQ(decodedTexture.height, cachedTexture.height);
+    EXPECT_EQ(decodedTexture.channels, cachedTexture.channels);
+    EXPECT_TRUE(std::ranges::equal(decodedTexture.pixels.bytes(), cachedTexture.pixels.bytes()));
+
+    const auto stats{ loader->cache().stats() };
+    EXPECT_EQ(1, stats.hits);
+    EXPECT_EQ(1, stats.misses);
+    EXPECT_EQ(1, stats.stores);
+}
+
+/// \brief Load a texture with a new loader using the same cache directory.
+///
+/// The cache persists on the disk, a texture decoded by one loader isn't decoded again by the next one.
+TEST_F(CachingResourceLoaderTest, CachePersists)
+{
+    ASSERT_TRUE(createLoader(1)->loadTexture(m_generator->texPath()).has_value());
+
+    const auto loader{ createLoader(0) };
+    ASSERT_TRUE(loader->loadTexture(m_generator->texPath()).has_value());
+    EXPECT_EQ(1, loader->cache().stats().hits);
+}
+
+/// \brief Change the content of a texture after it has been cached.
+///
+/// The content is part of the key, so the changed texture is decoded again instead of using the outdated entry.
+TEST_F(CachingResourceLoaderTest, ChangedFileIsDecodedAgain)
+{
+    const auto loader{ createLoader(2) };
+    ASSERT_TRUE(loader->loadTexture(m_generator->texPath()).has_value());
+
+    const auto modified{ std::filesystem::last_write_time(m_generator->texPath()) };
+    std::ofstream(m_generator->texPath(), std::ios::binary | std::ios::app) << "changed";
+    std::filesystem::last_write_time(m_generator->texPath(), modified);
+
+    ASSERT_TRUE(loader->loadTexture(m_generator->texPath()).has_value());
+    EXPECT_EQ(2, loader->cache().stats().misses);
+}
+
+/// \brief Cache more textures than fit into the size limit.
+///
+/// The least recently used entry is evicted, the cache stays below its size limit.
+TEST_F(CachingResourceLoaderTest, EvictsLeastRecentlyUsed)
+{
+    const auto second{ m_generator->resourcePath() / "second.png" };
+    std::filesystem::copy_file(m_generator->texPath(), second);
+    std::ofstream(second, std::ios::binary | std::ios::app) << "second";
+
+    // NOTE: Room for a single entry, which is a bit larger than its pixels
+    constexpr auto TEXTURE_BYTES{ static_cast<std::uintmax_t>(TEXTURE_SIZE * TEXTURE_SIZE * TEXTURE_CHANNELS) };
+    constexpr auto MAX_CACHE_SIZE{ TEXTURE_BYTES * 3 / 2 };
+    const auto loader{ createLoader(3, MAX_CACHE_SIZE) };
+
+    ASSERT_TRUE(loader->loadTexture(m_generator->texPath()).has_value());
+    ASSERT_TRUE(loader->loadTexture(second).has_value());
+    ASSERT_TRUE(loader->loadTexture(second).has_value());
+    ASSERT_TRUE(loader->loadTexture(m_generator->texPath()).has_value());
+
+    const auto stats{ loader->cache().stats() };
+    EXPECT_EQ(1, stats.hits);
+    EXPECT_EQ(2, stats.evictions);
+    EXPECT_LE(stats.size, MAX_CACHE_SIZE);
+}
+
+} // namespace sfa::testing
@@ -0,0 +1,114 @@
+#include "core/resourceManagement/FileWatcher.hpp"
+
+#include "testUtility/ResourceGenerator.hpp"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace sfa::testing
+{
+
+/// \brief Test noticing changed files with the \ref FileWatcher.
+///
+/// \author Felix Hommel
+/// \date 3/25/2026
+class FileWatcherTest : public ::testing::Test
+{
+public:
+    FileWatcherTest() = default;
+    ~FileWatcherTest() override = default;
+
+    FileWatcherTest(const FileWatcherTest&) = delete;
+    FileWatcherTest& operator=(const FileWatcherTest&) = delete;
+    FileWatcherTest(FileWatcherTest&&) noexcept = delete;
+    FileWatcherTest& operator=(FileWatcherTest&&) noexcept = delete;
+
+protected:
+    static constexpr auto DEBOUNCE{ std::chrono::milliseconds(50) };
+    static constexpr auto TIMEOUT{ std::chrono::milliseconds(2000) };
+    /// \brief Coarse file systems only store the write time in seconds.
+    static constexpr auto WRITE_TIME_RESOLUTION{ std::chrono::milliseconds(1100) };
+
+    std::unique_ptr<ResourceGenerator> m_generator{
+        std::make_unique<ResourceGenerator>(::testing::UnitTest::GetInstance()->current_test_info())
+    };
+
+    /// \brief Poll \p watcher until it reports a change or \ref FileWatcherTest::TIMEOUT passed.
+    static std::vector<FileWatcher::Change> waitForChanges(FileWatcher& watcher)
+    {
+        const auto deadline{ std::chrono::steady_clock::now() + TIMEOUT };
+        for(;;)
+        {
+            auto changes{ watcher.poll() };
+            if(!changes.empty() || std::chrono::steady_clock::now() >= deadline)
+                return changes;
+
+            std::this_thread::sleep_for(DEBOUNCE / 5);
+        }
+    }
+
+    static void touch(const std::filesystem::path& filepath, int value) { std::ofstream(filepath) << value; }
+};
+
+/// \brief Change a watched file.
+///
+/// When a watched file is written to, the watcher reports it once the debounce interval passed.
+TEST_F(FileWatcherTest, ReportChangedFile)
+{
+    FileWatcher watcher{ DEBOUNCE };
+    watcher.watch(m_generator->fragPath());
+    if(!watcher.notified())
+        std::this_thread::sleep_for(WRITE_TIME_RESOLUTION);
+
+    EXPECT_TRUE(watcher.poll().empty());
+
+    touch(m_generator->fragPath(), 1);
+    const auto changes{ waitForChanges(watcher) };
+
+    ASSERT_EQ(1, changes.size());
+    EXPECT_EQ(FileWatcher::normalize(m_generator->fragPath()), changes.front().filepath);
+    EXPECT_LE(changes.front().changedAt, std::chrono::steady_clock::now());
+}
+
+/// \brief Change a file several times in a burst.
+///
+/// When a watched file is written to repeatedly within the debounce interval, it is only reported once.
+TEST_F(FileWatcherTest, DebounceBurstOfChanges)
+{
+    FileWatcher watcher{ DEBOUNCE };
+    watcher.watch(m_generator->fragPath());
+    if(!watcher.notified())
+        std::this_thread::sleep_for(WRITE_TIME_RESOLUTION);
+
+    for(int i{ 0 }; i < 5; ++i)
+        touch(m_generator->fragPath(), i);
+
+    EXPECT_EQ(1, waitForChanges(watcher).size());
+
+    std::this_thread::sleep_for(DEBOUNCE * 2);
+    EXPECT_TRUE(watcher.poll().empty());
+}
+
+/// \brief Change a file that isn't watched.
+///
+/// When a file next to a watched file changes, it isn't reported.
+TEST_F(FileWatcherTest, IgnoreUnwatchedFile)
+{
+    FileWatcher watcher{ DEBOUNCE };
+    watcher.watch(m_generator->fragPath());
+    watcher.watch(m_generator->fragPath());
+
+    touch(m_generator->vertPath(), 1);
+    std::this_thread::sleep_for(DEBOUNCE * 2);
+
+    EXPECT_EQ(1, watcher.watchedFiles());
+    EXPECT_TRUE(watcher.poll().empty());
+}
+
+} // namespace sfa::testing
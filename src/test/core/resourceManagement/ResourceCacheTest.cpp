@@ -1,9 +1,14 @@
 #include "core/resourceManagement/ResourceCache.hpp"
+
+#include "core/resourceManagement/ResourceKey.hpp"
 #include "utility/exceptions/ResourceUnavailableException.hpp"
 
 #include <gtest/gtest.h>
 
+#include <cstddef>
 #include <memory>
+#include <string>
+#include <string_view>
 
 namespace sfa::testing
 {
@@ -63,6 +68,21 @@ TEST_F(ResourceCacheTest, OverrideResource)
     EXPECT_TRUE(m_cache->contains(K));
 }
 
+/// \brief Test replacing a resource that somebody already holds.
+///
+/// When a resource is replaced, the new value is moved into the stored resource, so earlier holders see it too.
+TEST_F(ResourceCacheTest, ReplaceResourceInPlace)
+{
+    m_cache->store(K, std::make_shared<TestResource>(DATA));
+    const auto holder{ m_cache->get(K) };
+
+    m_cache->replace(K, std::make_shared<TestResource>(DATA + 1));
+
+    EXPECT_EQ(1, m_cache->size());
+    EXPECT_EQ(holder, m_cache->get(K));
+    EXPECT_EQ(DATA + 1, holder->data);
+}
+
 /// \brief Test getting a resource that was previously inserted into the cache.
 ///
 /// When the resource was stored previously, it should be accessible via the get method.
@@ -109,6 +129,112 @@ TEST_F(ResourceCacheTest, ConstGetNonExistingResource)
     EXPECT_THROW({ const auto x{ constCache.get(K) }; }, ResourceUnavailableException);
 }
 
+/// \brief Test resolving the handle of a resource.
+///
+/// When the handle of a stored resource is looked up once, it resolves to the resource without the key.
+TEST_F(ResourceCacheTest, ResolveHandle)
+{
+    const auto stored{ m_cache->store(K, std::make_shared<TestResource>(DATA)) };
+    const auto handle{ m_cache->handle(K) };
+
+    EXPECT_TRUE(handle.valid());
+    EXPECT_EQ(stored, handle);
+    ASSERT_NE(nullptr, m_cache->resolve(handle));
+    EXPECT_EQ(DATA, m_cache->resolve(handle)->data);
+    EXPECT_FALSE(m_cache->handle("missing").valid());
+    EXPECT_EQ(nullptr, m_cache->resolve(ResourceCache<TestResource>::Handle{}));
+}
+
+/// \brief Test resolving a handle after its resource was removed.
+///
+/// When the cache is cleared, the handles handed out before don't resolve anymore, even once their slot is reused.
+TEST_F(ResourceCacheTest, StaleHandleDoesNotResolve)
+{
+    const auto handle{ m_cache->store(K, std::make_shared<TestResource>(DATA)) };
+    m_cache->clear();
+    const auto reused{ m_cache->store(K, std::make_shared<TestResource>(DATA + 1)) };
+
+    EXPECT_EQ(handle.index(), reused.index());
+    EXPECT_EQ(nullptr, m_cache->resolve(handle));
+    EXPECT_EQ(nullptr, m_cache->get(handle));
+    EXPECT_EQ(DATA + 1, m_cache->resolve(reused)->data);
+}
+
+/// \brief Test looking up a resource without a std::string.
+///
+/// When a resource is looked up by a string view or a \ref ResourceKey, it is found like by its name.
+TEST_F(ResourceCacheTest, LookUpWithoutString)
+{
+    using namespace sfa::literals;
+    static_assert(ResourceKey::hash("key") == "key"_key.hash());
+
+    const auto handle{ m_cache->store(K, std::make_shared<TestResource>(DATA)) };
+
+    EXPECT_EQ(handle, m_cache->handle(std::string_view{ K }));
+    EXPECT_EQ(handle, m_cache->handle("key"_key));
+    EXPECT_EQ(DATA, m_cache->get("key"_key)->data);
+    EXPECT_TRUE(m_cache->contains(ResourceKey::intern(std::string{ K })));
+    EXPECT_FALSE(m_cache->contains("missing"_key));
+    EXPECT_THROW({ const auto x{ m_cache->get("missing"_key) }; }, ResourceUnavailableException);
+}
+
+/// \brief Test interning a key whose name is a temporary.
+///
+/// When the same name is interned twice, both keys view the same name that outlives the temporary.
+TEST_F(ResourceCacheTest, InternKey)
+{
+    const auto first{ ResourceKey::intern(std::string{ "interned" }) };
+    const auto second{ ResourceKey::intern(std::string{ "interned" }) };
+
+    EXPECT_EQ(first, second);
+    EXPECT_EQ(first.name().data(), second.name().data());
+    EXPECT_EQ("interned", first.name());
+}
+
+/// \brief Test storing more than the budget allows.
+///
+/// When the stored resources outgrow the budget, the least recently used one is evicted.
+TEST_F(ResourceCacheTest, EvictLeastRecentlyUsed)
+{
+    constexpr std::size_t SIZE{ 100 };
+    m_cache->setBudget(2 * SIZE);
+
+    const auto first{ m_cache->store("first", std::make_shared<TestResource>(DATA), SIZE) };
+    const auto second{ m_cache->store("second", std::make_shared<TestResource>(DATA), SIZE) };
+    EXPECT_NE(nullptr, m_cache->resolve(first));
+
+    m_cache->store("third", std::make_shared<TestResource>(DATA), SIZE);
+
+    EXPECT_EQ(2, m_cache->size());
+    EXPECT_EQ(2 * SIZE, m_cache->usedSize());
+    EXPECT_TRUE(m_cache->contains("first"));
+    EXPECT_FALSE(m_cache->contains("second"));
+    EXPECT_EQ(nullptr, m_cache->resolve(second));
+}
+
+/// \brief Test exceeding the budget with resources somebody holds.
+///
+/// When every resource over the budget is still held outside of the cache, none of them is evicted until they are
+/// released.
+TEST_F(ResourceCacheTest, KeepHeldResourcesOverBudget)
+{
+    constexpr std::size_t SIZE{ 100 };
+    m_cache->setBudget(SIZE);
+
+    auto held{ std::make_shared<TestResource>(DATA) };
+    m_cache->store("held", held, SIZE);
+    m_cache->store("new", std::make_shared<TestResource>(DATA), SIZE);
+
+    EXPECT_EQ(2, m_cache->size());
+    EXPECT_TRUE(m_cache->overBudget());
+
+    held.reset();
+
+    EXPECT_EQ(SIZE, m_cache->trim());
+    EXPECT_FALSE(m_cache->contains("held"));
+    EXPECT_FALSE(m_cache->overBudget());
+}
+
 /// \brief Test clearing the cache.
 ///
 /// When the cache is cleared, there shouldn't be any values left in it.
@@ -1,20 +1,45 @@
 #include "core/resourceManagement/ResourceContext.hpp"
 
+#include "core/Mipmaps.hpp"
+#include "core/PixelBuffer.hpp"
 #include "core/resourceManagement/IntermediateResourceData.hpp"
 #include "fixtures/OpenGLTestFixture.hpp"
 #include "mocks/MockResourceLoader.hpp"
+#include "testUtility/AllocationCounter.hpp"
 #include "testUtility/ResourceGenerator.hpp"
+#include "utility/ThreadPool.hpp"
+#include "utility/exceptions/ResourceUnavailableException.hpp"
 
 #include "gmock/gmock.h"
 #include <gtest/gtest.h>
+#include <stb_image_write.h>
 
+#include <array>
+#include <atomic>
 #include <chrono>
 #include <cstddef>
+#include <cstdlib>
 #include <filesystem>
+#include <fstream>
 #include <memory>
+#include <string>
 #include <thread>
 #include <utility>
 
+namespace
+{
+
+std::atomic<int> g_pixelBufferFrees{ 0 };
+
+/// \brief Free function of a \ref sfa::PixelBuffer that counts how often it ran.
+void countingFree(void* data)
+{
+    g_pixelBufferFrees.fetch_add(1, std::memory_order_relaxed);
+    std::free(data); // NOLINT(cppcoreguidelines-no-malloc): pairs with the std::malloc of the test
+}
+
+} // namespace
+
 namespace sfa::testing
 {
 
@@ -35,6 +60,7 @@ public:
 
 protected:
     static constexpr auto UPLOAD_DELAY{ std::chrono::milliseconds(1000) };
+    static constexpr std::array TEST_PIXELS{ std::byte(255), std::byte(255), std::byte(255), std::byte(255) };
 
     std::unique_ptr<ResourceGenerator> m_generator{
         std::make_unique<ResourceGenerator>(::testing::UnitTest::GetInstance()->current_test_info())
@@ -62,11 +88,12 @@ TEST_F(ResourceContextTest, LoadShaderSuccess)
     MockResourceLoader* pMock{ mock.get() };
     ResourceContext context{ std::move(mock) };
 
-    const ShaderSourceData expectedData{ .vertexSource = "vertex shader source code",
-                                         .fragmentSource = "fragment shader source code" };
+    ShaderSourceData expectedData{ .vertexSource = "vertex shader source code",
+                                   .fragmentSource = "fragment shader source code" };
 
     const std::filesystem::path p("");
-    EXPECT_CALL(*pMock, loadShader(p, p, p)).WillOnce(::testing::Return(LoadResult{ expectedData }));
+    EXPECT_CALL(*pMock, loadShader(p, p, p))
+        .WillOnce(::testing::Return(::testing::ByMove(LoadResult{ std::move(expectedData) })));
 
     context.requestResource(ResourceContext::ShaderLoadRequest{ .name = "shader", .vert = "", .frag = "", .geom = "" });
     std::this_thread::sleep_for(UPLOAD_DELAY);
@@ -85,15 +112,16 @@ TEST_F(ResourceContextTest, LoadTextureSuccess)
     MockResourceLoader* pMock{ mock.get() };
     ResourceContext context{ std::move(mock) };
 
-    const TextureRawData expectedData{
+    TextureRawData expectedData{
         .width = 1,
         .height = 1,
         .channels = 4,
-        .pixels = { std::byte(255), std::byte(255), std::byte(255), std::byte(255) }
+        .pixels = PixelBuffer::copyOf(TEST_PIXELS)
     };
 
     const std::filesystem::path p("");
-    EXPECT_CALL(*pMock, loadTexture(p)).WillOnce(::testing::Return(LoadResult{ expectedData }));
+    EXPECT_CALL(*pMock, loadTexture(p))
+        .WillOnce(::testing::Return(::testing::ByMove(LoadResult{ std::move(expectedData) })));
 
     context.requestResource(ResourceContext::TextureLoadRequest{ .name = "texture", .filepath = "" });
     std::this_thread::sleep_for(UPLOAD_DELAY);
@@ -102,6 +130,163 @@ TEST_F(ResourceContextTest, LoadTextureSuccess)
     EXPECT_EQ(1, context.pendingUploadTasks());
 }
 
+/// \brief Cancel a requested resource before it is uploaded.
+///
+/// When a request is cancelled while its upload is still queued, the upload is dropped and the resource never reaches
+/// the cache.
+TEST_F(ResourceContextTest, CancelRequestSkipsUpload)
+{
+    auto mock{ std::make_unique<MockResourceLoader>() };
+    MockResourceLoader* pMock{ mock.get() };
+    ResourceContext context{ std::move(mock) };
+
+    TextureRawData expectedData{
+        .width = 1,
+        .height = 1,
+        .channels = 4,
+        .pixels = PixelBuffer::copyOf(TEST_PIXELS)
+    };
+
+    const std::filesystem::path p("");
+    EXPECT_CALL(*pMock, loadTexture(p))
+        .WillOnce(::testing::Return(::testing::ByMove(LoadResult{ std::move(expectedData) })));
+
+    auto handle{ context.requestResource(
+        ResourceContext::TextureLoadRequest{ .name = "texture", .filepath = "" }, JobPriority::Background
+    ) };
+    std::this_thread::sleep_for(UPLOAD_DELAY);
+
+    ASSERT_TRUE(context.hasPendingUploads());
+
+    handle.cancel();
+    context.waitForAllUploads();
+
+    EXPECT_TRUE(handle.cancelled());
+    EXPECT_FALSE(context.hasPendingUploads());
+    EXPECT_EQ(0, context.totalResources());
+}
+
+/// \brief Upload a texture within a byte budget.
+///
+/// When a texture doesn't fit into the upload budget of a frame, its rows are uploaded over multiple frames and the
+/// texture only becomes available once all of them are uploaded.
+TEST_F(ResourceContextTest, BudgetedUploadSplitsTexture)
+{
+    constexpr int TEXTURE_WIDTH{ 4 };
+    constexpr int TEXTURE_HEIGHT{ 64 };
+    constexpr int TEXTURE_CHANNELS{ 4 };
+    constexpr std::size_t ROW_SIZE{ TEXTURE_WIDTH * TEXTURE_CHANNELS };
+    constexpr std::size_t BYTES_PER_FRAME{ 16 * ROW_SIZE };
+
+    auto mock{ std::make_unique<MockResourceLoader>() };
+    MockResourceLoader* pMock{ mock.get() };
+    ResourceContext context{ std::move(mock) };
+
+    TextureRawData expectedData{ .width = TEXTURE_WIDTH,
+                                 .height = TEXTURE_HEIGHT,
+                                 .channels = TEXTURE_CHANNELS,
+                                 .pixels = PixelBuffer::allocate(ROW_SIZE * TEXTURE_HEIGHT) };
+
+    const std::filesystem::path p("");
+    EXPECT_CALL(*pMock, loadTexture(p))
+        .WillOnce(::testing::Return(::testing::ByMove(LoadResult{ std::move(expectedData) })));
+
+    context.requestResource(ResourceContext::TextureLoadRequest{ .name = "texture", .filepath = "" });
+    std::this_thread::sleep_for(UPLOAD_DELAY);
+
+    const auto stats{ context.processUploadQueue(ResourceContext::UploadBudget{ .maxBytes = BYTES_PER_FRAME }) };
+
+    EXPECT_EQ(0, stats.uploads);
+    EXPECT_EQ(BYTES_PER_FRAME, stats.bytes);
+    EXPECT_EQ(1, stats.deferred);
+    EXPECT_THROW(static_cast<void>(context.getTexture("texture")), ResourceUnavailableException);
+
+    std::size_t frames{ 1 };
+    while(context.hasPendingUploads())
+    {
+        context.processUploadQueue(ResourceContext::UploadBudget{ .maxBytes = BYTES_PER_FRAME });
+        ++frames;
+    }
+
+    EXPECT_EQ(ROW_SIZE * TEXTURE_HEIGHT / BYTES_PER_FRAME, frames);
+    EXPECT_EQ(1, context.lastUploadStats().uploads);
+    EXPECT_NE(nullptr, context.getTexture("texture"));
+}
+
+/// \brief Request a texture together with its mip chain.
+///
+/// The mip chain is either box filtered on the worker or generated by the driver, either way the uploaded texture
+/// holds every level.
+TEST_F(ResourceContextTest, LoadTextureWithMips)
+{
+    constexpr int TEXTURE_SIZE{ 16 };
+    constexpr int TEXTURE_CHANNELS{ 4 };
+    constexpr int MIP_LEVELS{ 5 };
+
+    auto mock{ std::make_unique<MockResourceLoader>() };
+    MockResourceLoader* pMock{ mock.get() };
+    ResourceContext context{ std::move(mock) };
+
+    const std::filesystem::path p("");
+    EXPECT_CALL(*pMock, loadTexture(p)).Times(2).WillRepeatedly(::testing::InvokeWithoutArgs([]() {
+        return LoadResult{ TextureRawData{
+            .width = TEXTURE_SIZE,
+            .height = TEXTURE_SIZE,
+            .channels = TEXTURE_CHANNELS,
+            .pixels = PixelBuffer::allocate(TEXTURE_SIZE * TEXTURE_SIZE * TEXTURE_CHANNELS) } };
+    }));
+
+    context.requestResource(
+        ResourceContext::TextureLoadRequest{ .name = "cpu", .filepath = "", .mips = MipmapMode::Cpu }
+    );
+    context.requestResource(
+        ResourceContext::TextureLoadRequest{ .name = "gpu", .filepath = "", .mips = MipmapMode::Gpu }
+    );
+    context.waitForAllUploads();
+
+    EXPECT_EQ(MIP_LEVELS, context.getTexture("cpu")->mipLevels());
+    EXPECT_EQ(MIP_LEVELS, context.getTexture("gpu")->mipLevels());
+}
+
+/// \brief Upload a texture without copying its pixels.
+///
+/// The decoded pixels are moved from the loader to the GPU upload, so the whole request doesn't allocate anywhere near
+/// the size of the image and the buffer of the loader is freed exactly once.
+TEST_F(ResourceContextTest, TextureUploadDoesNotCopyPixels)
+{
+    constexpr int TEXTURE_SIZE{ 256 };
+    constexpr int TEXTURE_CHANNELS{ 4 };
+    constexpr std::size_t IMAGE_SIZE{ TEXTURE_SIZE * TEXTURE_SIZE * TEXTURE_CHANNELS };
+
+    auto mock{ std::make_unique<MockResourceLoader>() };
+    MockResourceLoader* pMock{ mock.get() };
+    ResourceContext context{ std::move(mock) };
+
+    ::g_pixelBufferFrees.store(0, std::memory_order_relaxed);
+    TextureRawData expectedData{ .width = TEXTURE_SIZE,
+                                 .height = TEXTURE_SIZE,
+                                 .channels = TEXTURE_CHANNELS,
+                                 .pixels = PixelBuffer{ std::malloc(IMAGE_SIZE), IMAGE_SIZE, &::countingFree } };
+
+    const std::filesystem::path p("");
+    EXPECT_CALL(*pMock, loadTexture(p))
+        .WillOnce(::testing::Return(::testing::ByMove(LoadResult{ std::move(expectedData) })));
+
+    std::size_t allocatedBytes{ 0 };
+    {
+        const AllocationCounter allocationCounter;
+
+        context.requestResource(ResourceContext::TextureLoadRequest{ .name = "texture", .filepath = "" });
+        context.waitForAllUploads();
+
+        allocatedBytes = allocationCounter.bytes();
+    }
+
+    EXPECT_LT(allocatedBytes, IMAGE_SIZE);
+    EXPECT_EQ(1, ::g_pixelBufferFrees.load(std::memory_order_relaxed));
+    EXPECT_EQ(1, context.totalResources());
+}
+
 /// \brief Load multiple resources at the same time.
 ///
 /// When multiple resources are requested at the same time, the thread pool responsible for processing the initial
@@ -123,6 +308,263 @@ TEST_F(ResourceContextTest, LoadMultipleResourcesConcurrently)
     EXPECT_FALSE(context.hasPendingUploads());
 }
 
+/// \brief Load a batch of textures through the pipeline.
+///
+/// Every texture is read, decoded and uploaded exactly once, even though there are more textures than fit into the
+/// pipeline at a time. Each stage reports what went through it.
+TEST_F(ResourceContextTest, LoadTexturesThroughPipeline)
+{
+    constexpr std::size_t TEXTURE_COUNT{ 64 };
+
+    ResourceContext context{};
+
+    for(std::size_t i{ 0 }; i < TEXTURE_COUNT; ++i)
+    {
+        context.requestResource(
+            ResourceContext::TextureLoadRequest{ .name = std::to_string(i), .filepath = m_generator->texPath() }
+        );
+    }
+    context.waitForAllUploads();
+
+    EXPECT_EQ(TEXTURE_COUNT, context.totalResources());
+
+    const auto stats{ context.pipelineStats() };
+    EXPECT_EQ(TEXTURE_COUNT, stats.read.items);
+    EXPECT_EQ(TEXTURE_COUNT * std::filesystem::file_size(m_generator->texPath()), stats.read.bytes);
+    EXPECT_EQ(TEXTURE_COUNT, stats.decode.items);
+    EXPECT_EQ(TEXTURE_COUNT, stats.upload.items);
+    EXPECT_EQ(stats.decode.bytes, stats.upload.bytes);
+    EXPECT_GT(stats.decode.busy.count(), 0);
+    EXPECT_GE(stats.upload.averageLatency(), std::chrono::nanoseconds{ 0 });
+}
+
+/// \brief Wait for the uploads with a timeout.
+///
+/// When the main thread waits with a timeout, it uploads the resources as they arrive and reports once all of them are
+/// uploaded.
+TEST_F(ResourceContextTest, WaitForUploadsWithTimeout)
+{
+    ResourceContext context{};
+
+    context.requestResource(
+        ResourceContext::ShaderLoadRequest{
+            .name = "shader", .vert = m_generator->vertPath(), .frag = m_generator->fragPath() }
+    );
+    context.requestResource(
+        ResourceContext::TextureLoadRequest{ .name = "texture", .filepath = m_generator->texPath() }
+    );
+
+    EXPECT_TRUE(context.waitFor(UPLOAD_DELAY));
+    EXPECT_EQ(2, context.totalResources());
+    EXPECT_FALSE(context.hasPendingUploads());
+}
+
+/// \brief Limit the video memory of the textures.
+///
+/// When the uploaded textures take up more than the budget, the ones nobody holds are evicted until the rest fits. A
+/// texture survives the call that uploaded it, so it can be taken before the next call evicts it.
+TEST_F(ResourceContextTest, EvictTexturesOverMemoryBudget)
+{
+    ResourceContext context{};
+
+    context.requestResource(ResourceContext::TextureLoadRequest{ .name = "held", .filepath = m_generator->texPath() });
+    context.waitForAllUploads();
+
+    const auto held{ context.getTexture("held") };
+    const auto handle{ context.textureHandle("held") };
+    EXPECT_EQ(held.get(), context.resolve(handle));
+    EXPECT_EQ(held->gpuSize(), context.textureMemory());
+
+    context.setTextureMemoryBudget(held->gpuSize());
+    context.requestResource(ResourceContext::TextureLoadRequest{ .name = "other", .filepath = m_generator->texPath() });
+    context.waitForAllUploads();
+
+    EXPECT_EQ(2, context.totalResources());
+    EXPECT_EQ(2 * held->gpuSize(), context.textureMemory());
+
+    const auto other{ context.textureHandle("other") };
+    EXPECT_NE(nullptr, context.resolve(other));
+    context.processUploadQueue();
+
+    EXPECT_EQ(1, context.totalResources());
+    EXPECT_EQ(held.get(), context.resolve(handle));
+    EXPECT_EQ(nullptr, context.resolve(other));
+    EXPECT_EQ(held->gpuSize(), context.textureMemory());
+}
+
+/// \brief Hot reload a texture whose file changed.
+///
+/// When the file of a requested texture is overwritten, the texture is loaded again and replaced in place, so a holder
+/// of the texture sees the new version without asking the context again.
+TEST_F(ResourceContextTest, HotReloadChangedTexture)
+{
+    constexpr auto DEBOUNCE{ std::chrono::milliseconds(20) };
+    constexpr std::array<unsigned char, 16> PIXELS{};
+
+    ResourceContext context{};
+    context.requestResource(
+        ResourceContext::TextureLoadRequest{ .name = "texture", .filepath = m_generator->texPath() }
+    );
+    context.waitForAllUploads();
+    context.enableHotReload(DEBOUNCE);
+
+    const auto texture{ context.getTexture("texture") };
+    ASSERT_EQ(1, texture->width());
+
+    const auto path{ m_generator->texPath().string() };
+    ASSERT_NE(0, stbi_write_png(path.c_str(), 2, 2, 4, PIXELS.data(), 2 * 4));
+
+    const auto deadline{ std::chrono::steady_clock::now() + UPLOAD_DELAY };
+    while(context.hotReloadStats().reloads == 0 && std::chrono::steady_clock::now() < deadline)
+    {
+        context.processUploadQueue();
+        std::this_thread::sleep_for(DEBOUNCE / 4);
+    }
+
+    EXPECT_EQ(1, context.hotReloadStats().reloads);
+    EXPECT_GT(context.hotReloadStats().lastLatency.count(), 0);
+    EXPECT_EQ(texture, context.getTexture("texture"));
+    EXPECT_EQ(2, texture->width());
+    EXPECT_EQ(2, texture->height());
+}
+
+/// \brief Hot reload a texture whose file became invalid.
+///
+/// When the changed file of a texture can't be loaded, the previous version of the texture is kept.
+TEST_F(ResourceContextTest, HotReloadKeepsTextureOnFailure)
+{
+    constexpr auto DEBOUNCE{ std::chrono::milliseconds(20) };
+
+    ResourceContext context{};
+    context.requestResource(
+        ResourceContext::TextureLoadRequest{ .name = "texture", .filepath = m_generator->texPath() }
+    );
+    context.waitForAllUploads();
+    context.enableHotReload(DEBOUNCE);
+
+    const auto texture{ context.getTexture("texture") };
+    const auto id{ texture->getID() };
+
+    std::ofstream(m_generator->texPath(), std::ios::binary | std::ios::trunc) << "not an image";
+
+    const auto deadline{ std::chrono::steady_clock::now() + UPLOAD_DELAY };
+    while(context.hotReloadStats().failures == 0 && std::chrono::steady_clock::now() < deadline)
+    {
+        context.processUploadQueue();
+        std::this_thread::sleep_for(DEBOUNCE / 4);
+    }
+
+    EXPECT_EQ(1, context.hotReloadStats().failures);
+    EXPECT_EQ(0, context.hotReloadStats().reloads);
+    EXPECT_EQ(id, texture->getID());
+}
+
+/// \brief Follow a texture request through its future.
+///
+/// The future stays pending until the texture is uploaded, becomes ready afterwards and runs its callbacks once.
+/// Callbacks registered after the upload run right away.
+TEST_F(ResourceContextTest, FutureReadyAfterUpload)
+{
+    ResourceContext context{};
+    int calls{ 0 };
+
+    const auto future{ context.requestTexture(
+        ResourceContext::TextureLoadRequest{ .name = "texture", .filepath = m_generator->texPath() }
+    ) };
+    future.then([&calls](const auto& f) {
+        EXPECT_TRUE(f.ready());
+        ++calls;
+    });
+
+    EXPECT_TRUE(future.pending());
+    EXPECT_EQ(nullptr, future.get());
+
+    context.waitForAllUploads();
+
+    EXPECT_TRUE(future.ready());
+    EXPECT_EQ(1, calls);
+    EXPECT_EQ(nullptr, future.error());
+    EXPECT_EQ(context.findTexture("texture"), future.get());
+    EXPECT_EQ(future.get(), future.getOr(context.placeholderTexture()));
+
+    future.then([&calls](const auto&) { ++calls; });
+    EXPECT_EQ(2, calls);
+}
+
+/// \brief Fail the future of a texture whose file doesn't exist.
+///
+/// The error of the load is reported through the future, lookups return nothing or the placeholder instead of
+/// throwing.
+TEST_F(ResourceContextTest, FutureFailsWithError)
+{
+    ResourceContext context{};
+    bool called{ false };
+
+    const auto future{ context.requestTexture(
+        ResourceContext::TextureLoadRequest{ .name = "missing", .filepath = "does/not/exist.png" }
+    ) };
+    future.then([&called](const auto&) { called = true; });
+    context.waitForAllUploads();
+
+    ASSERT_TRUE(future.failed());
+    EXPECT_TRUE(called);
+    ASSERT_NE(nullptr, future.error());
+    EXPECT_EQ(ResourceError::Type::FileNotFound, future.error()->type);
+    EXPECT_EQ(context.placeholderTexture(), future.getOr(context.placeholderTexture()));
+
+    EXPECT_NO_THROW({
+        EXPECT_EQ(nullptr, context.findTexture("missing"));
+        EXPECT_EQ(context.placeholderTexture(), context.textureOrPlaceholder(ResourceKey{ "missing" }));
+    });
+}
+
+/// \brief Cancel a request through its future.
+///
+/// The future fails right away and the texture is never uploaded. Its callbacks don't run on the cancelling thread,
+/// but during the next upload of the context.
+TEST_F(ResourceContextTest, CancelFuture)
+{
+    ResourceContext context{};
+    bool called{ false };
+
+    const auto future{ context.requestTexture(
+        ResourceContext::TextureLoadRequest{ .name = "texture", .filepath = m_generator->texPath() }
+    ) };
+    future.then([&called](const auto&) { called = true; });
+    future.cancel();
+
+    ASSERT_TRUE(future.failed());
+    ASSERT_NE(nullptr, future.error());
+    EXPECT_FALSE(called);
+
+    context.waitForAllUploads();
+
+    EXPECT_TRUE(called);
+    EXPECT_TRUE(future.failed());
+    EXPECT_EQ(nullptr, context.findTexture("texture"));
+}
+
+/// \brief Evict a texture that is only referred to by a future.
+///
+/// A future doesn't hold on to its resource, so it doesn't keep the texture from being evicted once the context is over
+/// its memory budget. Afterwards the future hands out the placeholder.
+TEST_F(ResourceContextTest, FutureDoesNotPreventEviction)
+{
+    ResourceContext context{};
+    context.setTextureMemoryBudget(1);
+
+    const auto future{ context.requestTexture(
+        ResourceContext::TextureLoadRequest{ .name = "texture", .filepath = m_generator->texPath() }
+    ) };
+    context.waitForAllUploads();
+    context.processUploadQueue();
+
+    EXPECT_TRUE(future.ready());
+    EXPECT_EQ(0, context.totalResources());
+    EXPECT_EQ(nullptr, future.get());
+    EXPECT_EQ(context.placeholderTexture(), future.getOr(context.placeholderTexture()));
+}
+
 /// \brief Clear the resource cache.
 ///
 /// When the resource cache is cleared, all currently stored resources are destroyed.
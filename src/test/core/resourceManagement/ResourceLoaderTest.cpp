@@ -1,11 +1,70 @@
 #include "core/resourceManagement/ResourceLoader.hpp"
 
+#include "core/TextureCompression.hpp"
+#include "core/resourceManagement/IntermediateResourceData.hpp"
+#include "core/resourceManagement/ResourceError.hpp"
 #include "testUtility/ResourceGenerator.hpp"
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
 #include <filesystem>
+#include <fstream>
 #include <memory>
+#include <span>
+#include <utility>
+#include <variant>
+
+namespace
+{
+
+/// \brief VkFormat of BC1 blocks with 1 bit alpha.
+constexpr std::uint32_t VK_FORMAT_BC1_RGBA_UNORM_BLOCK{ 133 };
+
+template<typename T>
+void writeValue(std::ofstream& file, T value)
+{
+    file.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+/// \brief Write a KTX2 container holding a single level of \p data.
+void writeKtx2(
+    const std::filesystem::path& path,
+    std::uint32_t vkFormat,
+    std::uint32_t width,
+    std::uint32_t height,
+    std::span<const std::byte> data,
+    std::uint32_t supercompressionScheme = 0
+)
+{
+    constexpr std::array<unsigned char, 12> IDENTIFIER{
+        0xab, 'K', 'T', 'X', ' ', '2', '0', 0xbb, '\r', '\n', 0x1a, '\n'
+    };
+    constexpr std::uint64_t LEVEL_OFFSET{ 80 + 24 };
+
+    std::ofstream file{ path, std::ios::binary };
+    file.write(reinterpret_cast<const char*>(IDENTIFIER.data()), IDENTIFIER.size());
+
+    // NOTE: vkFormat, typeSize, width, height, depth, layers, faces, levels, supercompression
+    for(const std::uint32_t value : { vkFormat, 1u, width, height, 0u, 0u, 1u, 1u, supercompressionScheme })
+        writeValue(file, value);
+
+    // NOTE: Empty data format descriptor, key/value data and supercompression global data
+    for(int i{ 0 }; i < 4; ++i)
+        writeValue(file, std::uint32_t{ 0 });
+    writeValue(file, std::uint64_t{ 0 });
+    writeValue(file, std::uint64_t{ 0 });
+
+    writeValue(file, LEVEL_OFFSET);
+    writeValue<std::uint64_t>(file, data.size());
+    writeValue<std::uint64_t>(file, data.size());
+    file.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size()));
+}
+
+} // namespace
 
 namespace sfa::testing
 {
@@ -104,5 +163,68 @@ TEST_F(ResourceLoaderTest, LoadTextureFromNonExistingFile)
     EXPECT_FALSE(r.has_value());
 }
 
-} // namespace sfa::testing
+/// \brief Load a block compressed texture from a KTX2 container.
+///
+/// The blocks are read as they are, without decoding them.
+TEST_F(ResourceLoaderTest, LoadKtx2Texture)
+{
+    constexpr std::uint32_t TEXTURE_SIZE{ 8 };
+
+    std::array<std::byte, 4 * 8> blocks{};
+    for(std::size_t i{ 0 }; i < blocks.size(); ++i)
+        blocks[i] = static_cast<std::byte>(i);
+
+    const auto path{ m_generator->resourcePath() / "test.ktx2" };
+    ::writeKtx2(path, ::VK_FORMAT_BC1_RGBA_UNORM_BLOCK, TEXTURE_SIZE, TEXTURE_SIZE, blocks);
+
+    const auto r{ m_loader->loadTexture(path) };
+    ASSERT_TRUE(r.has_value());
+
+    const auto& texture{ std::get<TextureRawData>(*r) };
+    EXPECT_EQ(TEXTURE_SIZE, texture.width);
+    EXPECT_EQ(TEXTURE_SIZE, texture.height);
+    EXPECT_EQ(TextureCompression::Bc1Rgba, texture.compression);
+    EXPECT_TRUE(std::ranges::equal(blocks, texture.pixels.bytes()));
+}
+
+/// \brief Try loading a supercompressed KTX2 container.
+///
+/// Supercompressed containers would need to be transcoded first, loading them results in a std::unexpected value.
+TEST_F(ResourceLoaderTest, LoadSupercompressedKtx2Texture)
+{
+    constexpr std::uint32_t ZSTANDARD{ 2 };
 
+    const std::array<std::byte, 8> blocks{};
+    const auto path{ m_generator->resourcePath() / "test.ktx2" };
+    ::writeKtx2(path, ::VK_FORMAT_BC1_RGBA_UNORM_BLOCK, 4, 4, blocks, ZSTANDARD);
+
+    const auto r{ m_loader->loadTexture(path) };
+    ASSERT_FALSE(r.has_value());
+    EXPECT_EQ(ResourceError::Type::InvalidFormat, r.error().type);
+}
+
+/// \brief Read a batch of textures and decode them afterwards.
+///
+/// Every file of the batch is read as it is, a missing file only fails its own entry. Decoding a read file results in
+/// the same texture as loading it in one go.
+TEST_F(ResourceLoaderTest, ReadAndDecodeTextureBatch)
+{
+    const std::array<std::filesystem::path, 2> paths{ m_generator->texPath(), "non-existing-texture" };
+
+    auto files{ m_loader->readTextures(paths) };
+    ASSERT_EQ(paths.size(), files.size());
+    ASSERT_TRUE(files[0].has_value());
+    EXPECT_EQ(std::filesystem::file_size(m_generator->texPath()), files[0]->bytes.size());
+    ASSERT_FALSE(files[1].has_value());
+    EXPECT_EQ(ResourceError::Type::FileNotFound, files[1].error().type);
+
+    const auto decoded{ m_loader->decodeTexture(std::move(*files[0])) };
+    const auto loaded{ m_loader->loadTexture(m_generator->texPath()) };
+    ASSERT_TRUE(decoded.has_value());
+    ASSERT_TRUE(loaded.has_value());
+    EXPECT_TRUE(std::ranges::equal(
+        std::get<TextureRawData>(*decoded).pixels.bytes(), std::get<TextureRawData>(*loaded).pixels.bytes()
+    ));
+}
+
+} // namespace sfa::testing
@@ -0,0 +1,179 @@
+#include "ecs/systems/CollisionSystem.hpp"
+#include "ecs/CollisionLayers.hpp"
+#include "ecs/ComponentRegistry.hpp"
+#include "ecs/ECSUtility.hpp"
+#include "ecs/components/BoxColliderComponent.hpp"
+#include "ecs/components/CircleColliderComponent.hpp"
+#include "ecs/components/TransformComponent.hpp"
+
+#include <glm/glm.hpp>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+
+constexpr sfa::EntityID ENTITY_A{ 1 };
+constexpr sfa::EntityID ENTITY_B{ 2 };
+
+constexpr glm::vec2 BOX_SIZE{ 10.f };
+constexpr glm::vec2 OVERLAPPING_POSITION{ 5.f, 5.f };
+constexpr glm::vec2 SEPARATED_POSITION{ 50.f, 50.f };
+constexpr glm::vec2 CIRCLE_POSITION{ 7.f, 0.f };
+/// \brief Only overlaps the box at the origin if the circle is placed by its top-left corner.
+constexpr glm::vec2 BOX_BELOW_CIRCLE{ 8.f, 8.f };
+constexpr auto CIRCLE_RADIUS{ 5.f };
+
+constexpr sfa::CollisionMask PLAYER_SHIP{ sfa::collisionLayer(1) };
+constexpr sfa::CollisionMask PLAYER_BULLET{ sfa::collisionLayer(2) };
+constexpr sfa::CollisionMask ENEMY{ sfa::collisionLayer(3) };
+
+} // namespace
+
+namespace sfa::testing
+{
+
+/// \brief Test the features of the \ref CollisionSystem.
+///
+/// \author Felix Hommel
+/// \date 3/7/2026
+class CollisionSystemTest : public ::testing::Test
+{
+public:
+    CollisionSystemTest() = default;
+    ~CollisionSystemTest() override = default;
+
+    CollisionSystemTest(const CollisionSystemTest&) = delete;
+    CollisionSystemTest& operator=(const CollisionSystemTest&) = delete;
+    CollisionSystemTest(CollisionSystemTest&&) = delete;
+    CollisionSystemTest& operator=(CollisionSystemTest&&) = delete;
+
+protected:
+    ComponentRegistry m_registry;
+    CollisionSystem m_system;
+
+    void SetUp() override
+    {
+        m_registry.registerComponent<TransformComponent>();
+        m_registry.registerComponent<BoxColliderComponent>();
+        m_registry.registerComponent<CircleColliderComponent>();
+    }
+
+    void addBox(EntityID entity, const glm::vec2& position, CollisionMask category, CollisionMask mask)
+    {
+        m_registry.addComponent<TransformComponent>(entity, { .position = position });
+        m_registry.addComponent<BoxColliderComponent>(
+            entity, { .size = ::BOX_SIZE, .category = category, .mask = mask }
+        );
+    }
+};
+
+/// \brief Test two overlapping boxes on the default layer.
+///
+/// Colliders that don't specify any filtering data should collide with each other.
+TEST_F(CollisionSystemTest, OverlappingBoxesOnDefaultLayerCollide)
+{
+    addBox(::ENTITY_A, glm::vec2(0.f), COLLISION_LAYER_DEFAULT, COLLISION_MASK_ALL);
+    addBox(::ENTITY_B, ::OVERLAPPING_POSITION, COLLISION_LAYER_DEFAULT, COLLISION_MASK_ALL);
+
+    m_system.update(m_registry);
+
+    ASSERT_EQ(1, m_system.contacts().size());
+    EXPECT_EQ(::ENTITY_A, m_system.contacts().front().a);
+    EXPECT_EQ(::ENTITY_B, m_system.contacts().front().b);
+}
+
+/// \brief Test two boxes that do not overlap.
+///
+/// When the colliders are apart, the narrow phase should run but not produce a contact.
+TEST_F(CollisionSystemTest, SeparatedBoxesDoNotCollide)
+{
+    addBox(::ENTITY_A, glm::vec2(0.f), COLLISION_LAYER_DEFAULT, COLLISION_MASK_ALL);
+    addBox(::ENTITY_B, ::SEPARATED_POSITION, COLLISION_LAYER_DEFAULT, COLLISION_MASK_ALL);
+
+    m_system.update(m_registry);
+
+    EXPECT_TRUE(m_system.contacts().empty());
+    EXPECT_EQ(1, m_system.narrowPhaseTests());
+}
+
+/// \brief Test two overlapping colliders whose layers reject each other.
+///
+/// A player bullet should never be tested against a player ship, so the pair should be rejected before the narrow
+/// phase.
+TEST_F(CollisionSystemTest, RejectedLayerPairSkipsNarrowPhase)
+{
+    addBox(::ENTITY_A, glm::vec2(0.f), ::PLAYER_SHIP, ::ENEMY);
+    addBox(::ENTITY_B, ::OVERLAPPING_POSITION, ::PLAYER_BULLET, ::ENEMY);
+
+    m_system.update(m_registry);
+
+    EXPECT_TRUE(m_system.contacts().empty());
+    EXPECT_EQ(0, m_system.narrowPhaseTests());
+}
+
+/// \brief Test two overlapping colliders where only one of them accepts the other.
+///
+/// Filtering has to be symmetric, so that a single sided mask does not produce a contact.
+TEST_F(CollisionSystemTest, OneSidedMaskDoesNotCollide)
+{
+    addBox(::ENTITY_A, glm::vec2(0.f), ::PLAYER_BULLET, ::ENEMY);
+    addBox(::ENTITY_B, ::OVERLAPPING_POSITION, ::ENEMY, ::PLAYER_SHIP);
+
+    m_system.update(m_registry);
+
+    EXPECT_TRUE(m_system.contacts().empty());
+}
+
+/// \brief Test an overlapping box and circle on layers that accept each other.
+///
+/// Colliders of different shapes on different layers should still be detected when their masks match.
+TEST_F(CollisionSystemTest, BoxAndCircleOnAcceptingLayersCollide)
+{
+    addBox(::ENTITY_A, glm::vec2(0.f), ::PLAYER_BULLET, ::ENEMY);
+
+    m_registry.addComponent<TransformComponent>(::ENTITY_B, { .position = ::CIRCLE_POSITION });
+    m_registry.addComponent<CircleColliderComponent>(
+        ::ENTITY_B, { .radius = ::CIRCLE_RADIUS, .category = ::ENEMY, .mask = ::PLAYER_BULLET }
+    );
+
+    m_system.update(m_registry);
+
+    EXPECT_EQ(1, m_system.contacts().size());
+}
+
+/// \brief Test that a circle is placed by the top-left corner of its bounding square, like a box.
+///
+/// A circle at the origin covers the square from the origin to twice its radius, so it reaches a box inside that square
+/// which it wouldn't if it was centered on its position.
+TEST_F(CollisionSystemTest, CircleIsPlacedByTopLeftCorner)
+{
+    addBox(::ENTITY_A, ::BOX_BELOW_CIRCLE, ::PLAYER_BULLET, ::ENEMY);
+
+    m_registry.addComponent<TransformComponent>(::ENTITY_B, { .position = glm::vec2(0.f) });
+    m_registry.addComponent<CircleColliderComponent>(
+        ::ENTITY_B, { .radius = ::CIRCLE_RADIUS, .category = ::ENEMY, .mask = ::PLAYER_BULLET }
+    );
+
+    m_system.update(m_registry);
+
+    EXPECT_EQ(1, m_system.contacts().size());
+}
+
+/// \brief Test that the colliders of a single entity don't collide with each other.
+///
+/// An entity with both a box and a circle collider on accepting layers must not report a contact with itself.
+TEST_F(CollisionSystemTest, CollidersOfOneEntityDoNotCollide)
+{
+    addBox(::ENTITY_A, glm::vec2(0.f), COLLISION_LAYER_DEFAULT, COLLISION_MASK_ALL);
+    m_registry.addComponent<CircleColliderComponent>(
+        ::ENTITY_A, { .radius = ::CIRCLE_RADIUS, .category = COLLISION_LAYER_DEFAULT, .mask = COLLISION_MASK_ALL }
+    );
+
+    m_system.update(m_registry);
+
+    EXPECT_TRUE(m_system.contacts().empty());
+    EXPECT_EQ(0, m_system.narrowPhaseTests());
+}
+
+} // namespace sfa::testing
@@ -0,0 +1,123 @@
+#include "ecs/systems/DamageSystem.hpp"
+#include "ecs/ComponentRegistry.hpp"
+#include "ecs/ECSUtility.hpp"
+#include "ecs/EntityManager.hpp"
+#include "ecs/components/DamageComponent.hpp"
+#include "ecs/components/HealthComponent.hpp"
+#include "ecs/systems/CollisionSystem.hpp"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <memory>
+
+namespace
+{
+
+constexpr auto BULLET_DAMAGE{ 10 };
+constexpr auto SHIP_HEALTH{ 25 };
+
+} // namespace
+
+namespace sfa::testing
+{
+
+/// \brief Test the features of the \ref DamageSystem.
+///
+/// \author Felix Hommel
+/// \date 3/8/2026
+class DamageSystemTest : public ::testing::Test
+{
+public:
+    DamageSystemTest() = default;
+    ~DamageSystemTest() override = default;
+
+    DamageSystemTest(const DamageSystemTest&) = delete;
+    DamageSystemTest& operator=(const DamageSystemTest&) = delete;
+    DamageSystemTest(DamageSystemTest&&) = delete;
+    DamageSystemTest& operator=(DamageSystemTest&&) = delete;
+
+protected:
+    std::unique_ptr<EntityManager> m_entities{ std::make_unique<EntityManager>() };
+    ComponentRegistry m_registry;
+    DamageSystem m_system;
+
+    void SetUp() override
+    {
+        m_registry.registerComponent<DamageComponent>();
+        m_registry.registerComponent<HealthComponent>();
+    }
+
+    EntityID createBullet()
+    {
+        const auto entity{ m_entities->createEntity() };
+        m_registry.addComponent<DamageComponent>(entity, { .amount = ::BULLET_DAMAGE });
+
+        return entity;
+    }
+
+    EntityID createShip()
+    {
+        const auto entity{ m_entities->createEntity() };
+        m_registry.addComponent<HealthComponent>(entity, { .current = ::SHIP_HEALTH, .max = ::SHIP_HEALTH });
+
+        return entity;
+    }
+};
+
+/// \brief Test that the damage of all hits on the same target in one frame is summed up.
+///
+/// Regardless of the order of the entities within a contact, every bullet should damage the ship exactly once.
+TEST_F(DamageSystemTest, AccumulatesDamageOfMultipleHits)
+{
+    const auto ship{ createShip() };
+    const auto bulletA{ createBullet() };
+    const auto bulletB{ createBullet() };
+
+    const std::array contacts{ Contact{ .a = bulletA, .b = ship }, Contact{ .a = ship, .b = bulletB } };
+    m_system.update(m_registry, contacts);
+
+    EXPECT_EQ(::SHIP_HEALTH - (2 * ::BULLET_DAMAGE), m_registry.getComponent<HealthComponent>(ship).current);
+    EXPECT_TRUE(m_system.pendingDestroy().empty());
+}
+
+/// \brief Test that damage does not carry over into the next frame.
+///
+/// When there are no contacts in a frame, the health of the entities should not change.
+TEST_F(DamageSystemTest, DamageIsResetBetweenFrames)
+{
+    const auto ship{ createShip() };
+    const auto bullet{ createBullet() };
+
+    const std::array contacts{ Contact{ .a = bullet, .b = ship } };
+    m_system.update(m_registry, contacts);
+    m_system.update(m_registry, {});
+
+    EXPECT_EQ(::SHIP_HEALTH - ::BULLET_DAMAGE, m_registry.getComponent<HealthComponent>(ship).current);
+}
+
+/// \brief Test that an entity whose health drops to zero is queued for destruction exactly once.
+///
+/// When the destroy queue is flushed, the entity should be destroyed and lose all of its components.
+TEST_F(DamageSystemTest, DeadEntitiesAreDestroyedInBatch)
+{
+    const auto ship{ createShip() };
+    const auto bullet{ createBullet() };
+
+    const std::array contacts{ Contact{ .a = bullet, .b = ship },
+                               Contact{ .a = bullet, .b = ship },
+                               Contact{ .a = bullet, .b = ship } };
+    m_system.update(m_registry, contacts);
+    m_system.update(m_registry, contacts);
+
+    ASSERT_EQ(1, m_system.pendingDestroy().size());
+    EXPECT_EQ(ship, m_system.pendingDestroy().front());
+
+    m_system.flushDestroyed(*m_entities, m_registry);
+
+    EXPECT_TRUE(m_system.pendingDestroy().empty());
+    EXPECT_FALSE(m_registry.contains<HealthComponent>(ship));
+    EXPECT_EQ(1, m_entities->livingEntityCount());
+}
+
+} // namespace sfa::testing
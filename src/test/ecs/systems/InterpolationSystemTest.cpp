@@ -0,0 +1,80 @@
+#include "ecs/systems/InterpolationSystem.hpp"
+#include "ecs/ComponentRegistry.hpp"
+#include "ecs/ECSUtility.hpp"
+#include "ecs/components/TransformComponent.hpp"
+
+#include <gtest/gtest.h>
+
+namespace
+{
+
+constexpr sfa::EntityID ENTITY{ 1 };
+constexpr auto EPSILON{ 1e-5f };
+
+} // namespace
+
+namespace sfa::testing
+{
+
+/// \brief Test blending between the snapshot and the state after a step.
+///
+/// The render state lies at the interpolation factor between the snapshot and the current state.
+TEST(InterpolationSystemTest, BlendsBetweenSnapshotAndCurrentState)
+{
+    ComponentRegistry registry;
+    registry.registerComponent<TransformComponent>();
+    registry.addComponent<TransformComponent>(::ENTITY, { .position = { 10.f, 0.f }, .rotation = 1.f });
+
+    InterpolationSystem::snapshot(registry);
+
+    auto& transform{ registry.getComponent<TransformComponent>(::ENTITY) };
+    transform.position = { 20.f, 10.f };
+    transform.rotation = 3.f;
+
+    const auto position{ InterpolationSystem::position(transform, 0.5f) };
+
+    EXPECT_NEAR(position.x, 15.f, ::EPSILON);
+    EXPECT_NEAR(position.y, 5.f, ::EPSILON);
+    EXPECT_NEAR(InterpolationSystem::rotation(transform, 0.5f), 2.f, ::EPSILON);
+    EXPECT_NEAR(InterpolationSystem::position(transform, 1.f).x, 20.f, ::EPSILON);
+}
+
+/// \brief Test rendering an entity that spawned after the last snapshot.
+///
+/// Without a snapshot there is nothing to blend from, so the entity is rendered at its current state.
+TEST(InterpolationSystemTest, SpawnedEntityIsNotBlendedFromOrigin)
+{
+    ComponentRegistry registry;
+    registry.registerComponent<TransformComponent>();
+    InterpolationSystem::snapshot(registry);
+
+    registry.addComponent<TransformComponent>(::ENTITY, { .position = { 10.f, 20.f }, .rotation = 1.f });
+    const auto& transform{ registry.getComponent<TransformComponent>(::ENTITY) };
+
+    const auto position{ InterpolationSystem::position(transform, 0.f) };
+
+    EXPECT_NEAR(position.x, 10.f, ::EPSILON);
+    EXPECT_NEAR(position.y, 20.f, ::EPSILON);
+    EXPECT_NEAR(InterpolationSystem::rotation(transform, 0.f), 1.f, ::EPSILON);
+}
+
+/// \brief Test teleporting an entity between two snapshots.
+///
+/// A teleported entity is rendered at its new position right away instead of sliding there.
+TEST(InterpolationSystemTest, TeleportSkipsBlending)
+{
+    ComponentRegistry registry;
+    registry.registerComponent<TransformComponent>();
+    registry.addComponent<TransformComponent>(::ENTITY, { .position = { 10.f, 0.f } });
+    InterpolationSystem::snapshot(registry);
+
+    auto& transform{ registry.getComponent<TransformComponent>(::ENTITY) };
+    InterpolationSystem::teleport(transform, { 100.f, 50.f });
+
+    const auto position{ InterpolationSystem::position(transform, 0.f) };
+
+    EXPECT_NEAR(position.x, 100.f, ::EPSILON);
+    EXPECT_NEAR(position.y, 50.f, ::EPSILON);
+}
+
+} // namespace sfa::testing
@@ -2,8 +2,24 @@
 set_tests_properties(
     ResourceContextTest.LoadShaderSuccess
     ResourceContextTest.LoadTextureSuccess
+    ResourceContextTest.CancelRequestSkipsUpload
+    ResourceContextTest.BudgetedUploadSplitsTexture
+    ResourceContextTest.LoadTextureWithMips
+    ResourceContextTest.TextureUploadDoesNotCopyPixels
     ResourceContextTest.LoadMultipleResourcesConcurrently
+    ResourceContextTest.LoadTexturesThroughPipeline
+    ResourceContextTest.WaitForUploadsWithTimeout
+    ResourceContextTest.EvictTexturesOverMemoryBudget
+    ResourceContextTest.HotReloadChangedTexture
+    ResourceContextTest.HotReloadKeepsTextureOnFailure
+    ResourceContextTest.FutureReadyAfterUpload
+    ResourceContextTest.FutureFailsWithError
+    ResourceContextTest.CancelFuture
+    ResourceContextTest.FutureDoesNotPreventEviction
     ResourceContextTest.ClearResourceContext
+    SamplerTest.SamplerRAII
+    SamplerTest.BindSamplerToTextureUnit
+    SamplerTest.CacheDeduplicatesSamplers
     ShaderTest.SetFourSingleFloatValuesWithUse
     ShaderTest.SetFloatVector4ValueWithUse
     ShaderTest.SetFloatVector3ValueWithUse
@@ -21,5 +37,10 @@ set_tests_properties(
     TextureTest.TextureRAII
     TextureTest.TextureMoveConstructor
     TextureTest.TextureMoveAssignment
+    TextureTest.CompressedTextureMatchesSoftwareDecode
+    TextureTest.TextureWithMipChain
+    TextureTest.GenerateMipmaps
+    TextureUploaderTest.ChunkedUploadMatchesSource
+    TextureUploaderTest.OversizedChunkUploadsDirectly
     PROPERTIES LABELS OpenGL
 )
@@ -0,0 +1,105 @@
+#include "AllocationCounter.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+namespace
+{
+
+std::atomic<bool> g_counting{ false };
+std::atomic<std::size_t> g_allocations{ 0 };
+std::atomic<std::size_t> g_bytes{ 0 };
+
+void count(std::size_t size)
+{
+    if(g_counting.load(std::memory_order_relaxed))
+    {
+        g_allocations.fetch_add(1, std::memory_order_relaxed);
+        g_bytes.fetch_add(size, std::memory_order_relaxed);
+    }
+}
+
+void* allocate(std::size_t size)
+{
+    count(size);
+
+    if(void* p{ std::malloc(size == 0 ? 1 : size) }) // NOLINT(cppcoreguidelines-no-malloc): replaces operator new
+        return p;
+
+    throw std::bad_alloc{};
+}
+
+void* allocateAligned(std::size_t size, std::align_val_t alignment)
+{
+    count(size);
+
+    const auto align{ static_cast<std::size_t>(alignment) };
+    const auto rounded{ ((size + align - 1) / align) * align };
+    if(void* p{ std::aligned_alloc(align, rounded == 0 ? align : rounded) })
+        return p;
+
+    throw std::bad_alloc{};
+}
+
+} // namespace
+
+// NOLINTBEGIN(cppcoreguidelines-no-malloc, misc-new-delete-overloads): replacement of the global allocation functions
+void* operator new(std::size_t size)
+{
+    return allocate(size);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment)
+{
+    return allocateAligned(size, alignment);
+}
+
+void operator delete(void* p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t /*size*/) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void* p, std::align_val_t /*alignment*/) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t /*size*/, std::align_val_t /*alignment*/) noexcept
+{
+    std::free(p);
+}
+// NOLINTEND(cppcoreguidelines-no-malloc, misc-new-delete-overloads)
+
+namespace sfa::testing
+{
+
+AllocationCounter::AllocationCounter()
+{
+    g_allocations.store(0, std::memory_order_relaxed);
+    g_bytes.store(0, std::memory_order_relaxed);
+    g_counting.store(true, std::memory_order_seq_cst);
+}
+
+AllocationCounter::~AllocationCounter()
+{
+    g_counting.store(false, std::memory_order_seq_cst);
+}
+
+std::size_t AllocationCounter::allocations() const noexcept
+{
+    return g_allocations.load(std::memory_order_relaxed);
+}
+
+std::size_t AllocationCounter::bytes() const noexcept
+{
+    return g_bytes.load(std::memory_order_relaxed);
+}
+
+} // namespace sfa::testing
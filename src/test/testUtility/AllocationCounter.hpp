@@ -0,0 +1,35 @@
+#ifndef SFA_SRC_TEST_TEST_UTILITY_ALLOCATION_COUNTER_HPP
+#define SFA_SRC_TEST_TEST_UTILITY_ALLOCATION_COUNTER_HPP
+
+#include <cstddef>
+
+namespace sfa::testing
+{
+
+/// \brief Counts the heap allocations of all threads while it is alive.
+///
+/// The test binary replaces the global operator new, which only counts while an \ref AllocationCounter exists. Only
+/// one counter may be alive at a time.
+///
+/// \author Felix Hommel
+/// \date 3/15/2026
+class AllocationCounter
+{
+public:
+    AllocationCounter();
+    ~AllocationCounter();
+
+    AllocationCounter(const AllocationCounter&) = delete;
+    AllocationCounter& operator=(const AllocationCounter&) = delete;
+    AllocationCounter(AllocationCounter&&) = delete;
+    AllocationCounter& operator=(AllocationCounter&&) = delete;
+
+    /// \brief Return how many allocations happened since the counter was created.
+    [[nodiscard]] std::size_t allocations() const noexcept;
+    /// \brief Return how many bytes were allocated since the counter was created.
+    [[nodiscard]] std::size_t bytes() const noexcept;
+};
+
+} // namespace sfa::testing
+
+#endif // !SFA_SRC_TEST_TEST_UTILITY_ALLOCATION_COUNTER_HPP
@@ -7,6 +7,8 @@
 #include <atomic>
 #include <barrier>
 #include <chrono>
+#include <cstddef>
+#include <deque>
 #include <thread>
 #include <vector>
 
@@ -135,5 +137,62 @@ TEST_F(BlockingQueueTest, TryPopNonBlockingOnNonEmptyQueue)
         ASSERT_TRUE(v.has_value());
 }
 
-} // namespace sfa::testing
+/// \brief Test draining a limited batch.
+///
+/// When a maximum is given, only that many elements are moved out of the queue, in order, and the rest stays queued.
+TEST_F(BlockingQueueTest, DrainIntoRespectsMaxItems)
+{
+    constexpr int ITEMS{ 10 };
+    constexpr std::size_t MAX_ITEMS{ 4 };
+
+    for(int i{ 0 }; i < ITEMS; ++i)
+        m_queue.push(i);
+
+    std::vector<int> batch{ -1 };
+    EXPECT_EQ(m_queue.drainInto(batch, MAX_ITEMS), MAX_ITEMS);
+
+    EXPECT_EQ(batch, (std::vector<int>{ -1, 0, 1, 2, 3 }));
+    EXPECT_EQ(m_queue.size(), ITEMS - MAX_ITEMS);
+}
+
+/// \brief Test draining the whole queue.
+///
+/// Without a maximum every element is moved out of the queue, an empty queue adds nothing.
+TEST_F(BlockingQueueTest, DrainIntoTakesEverything)
+{
+    constexpr int ITEMS{ 10 };
+
+    for(int i{ 0 }; i < ITEMS; ++i)
+        m_queue.push(i);
 
+    std::vector<int> batch;
+    EXPECT_EQ(m_queue.drainInto(batch), ITEMS);
+    EXPECT_EQ(batch.size(), ITEMS);
+    EXPECT_TRUE(m_queue.empty());
+
+    EXPECT_EQ(m_queue.drainInto(batch), 0);
+    EXPECT_EQ(batch.size(), ITEMS);
+}
+
+/// \brief Test swapping out the whole queue.
+///
+/// The buffer that is passed receives all elements in order, leftovers in the buffer are discarded and the queue can be
+/// used normally afterwards.
+TEST_F(BlockingQueueTest, TakeAllSwapsBuffer)
+{
+    constexpr int ITEMS{ 5 };
+
+    for(int i{ 0 }; i < ITEMS; ++i)
+        m_queue.push(i);
+
+    std::deque<int> buffer{ -1, -2 };
+    EXPECT_EQ(m_queue.takeAll(buffer), ITEMS);
+    EXPECT_EQ(buffer, (std::deque<int>{ 0, 1, 2, 3, 4 }));
+    EXPECT_TRUE(m_queue.empty());
+
+    m_queue.push(ITEMS);
+    EXPECT_EQ(m_queue.takeAll(buffer), 1);
+    EXPECT_EQ(buffer, (std::deque<int>{ ITEMS }));
+}
+
+} // namespace sfa::testing
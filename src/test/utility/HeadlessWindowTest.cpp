@@ -0,0 +1,252 @@
+#include "utility/HeadlessWindow.hpp"
+#include "core/GameLoop.hpp"
+#include "core/NullRenderer.hpp"
+#include "ecs/ComponentRegistry.hpp"
+#include "ecs/ECSUtility.hpp"
+#include "ecs/StateHash.hpp"
+#include "ecs/components/SpriteComponent.hpp"
+#include "ecs/components/TextComponent.hpp"
+#include "ecs/components/UIButtonComponent.hpp"
+#include "ecs/components/UITransformComponent.hpp"
+#include "ecs/systems/ButtonSystem.hpp"
+#include "ecs/systems/UIRenderSystem.hpp"
+#include "utility/IWindow.hpp"
+#include "utility/userInput/InputController.hpp"
+#include "utility/userInput/InputEvent.hpp"
+#include "utility/userInput/InputRecording.hpp"
+
+#include <glm/glm.hpp>
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <vector>
+
+namespace
+{
+
+constexpr sfa::Viewport VIEWPORT{ .width = 800, .height = 600 };
+constexpr std::uint64_t SESSION_FRAMES{ 30 };
+constexpr sfa::EntityID BUTTON{ 1 };
+constexpr glm::vec2 BUTTON_POSITION{ 100.f, 100.f };
+constexpr glm::vec2 BUTTON_SIZE{ 50.f, 20.f };
+constexpr auto PRESS_COOLDOWN{ 0.05f };
+
+/// \brief Frame times the recorded session cycles through, standing in for the jitter of the wall clock.
+constexpr std::array<sfa::GameLoop::Duration, 4> RECORDED_FRAME_TIMES{
+    sfa::GameLoop::Duration{ 1.0 / 60.0 },
+    sfa::GameLoop::Duration{ 1.0 / 24.0 },
+    sfa::GameLoop::Duration{ 1.0 / 144.0 },
+    sfa::GameLoop::Duration{ 1.0 / 40.0 }
+};
+/// \brief Frame time of a replay that doesn't follow the recorded steps, differs from every recorded one.
+constexpr sfa::GameLoop::Duration REPLAY_FRAME_TIME{ 1.0 / 30.0 };
+
+} // namespace
+
+namespace sfa::testing
+{
+
+/// \brief Test running the UI pipeline without a window and replaying recorded input through it.
+///
+/// \author Felix Hommel
+/// \date 3/10/2026
+class HeadlessWindowTest : public ::testing::Test
+{
+public:
+    HeadlessWindowTest() = default;
+    ~HeadlessWindowTest() override = default;
+
+    HeadlessWindowTest(const HeadlessWindowTest&) = delete;
+    HeadlessWindowTest& operator=(const HeadlessWindowTest&) = delete;
+    HeadlessWindowTest(HeadlessWindowTest&&) = delete;
+    HeadlessWindowTest& operator=(HeadlessWindowTest&&) = delete;
+
+protected:
+    /// \brief Result of a single session.
+    struct Session
+    {
+        std::vector<std::uint64_t> hashes;
+        std::vector<std::uint64_t> steps;
+        std::size_t clicks{ 0 };
+        std::size_t spriteDraws{ 0 };
+    };
+
+    /// \brief Run a session of the button scene.
+    ///
+    /// \param window the window that drives the session
+    /// \param input the input controller attached to \p window
+    /// \param inject called at the start of every frame to inject live input
+    /// \param replay (optional) replay whose recorded step counts drive the loop, frames run as many steps as their
+    /// frame time allows otherwise
+    /// \param pressCooldown (optional) cooldown of the button, used to alter the behaviour of the scene
+    template<typename F>
+    static Session run(
+        HeadlessWindow& window,
+        InputController& input,
+        const F& inject,
+        const InputReplay* replay = nullptr,
+        float pressCooldown = ::PRESS_COOLDOWN
+    )
+    {
+        Session session;
+
+        ComponentRegistry registry;
+        registry.addComponent<UITransformComponent>(
+            ::BUTTON,
+            { .localPosition = ::BUTTON_POSITION, .worldPosition = ::BUTTON_POSITION, .size = ::BUTTON_SIZE }
+        );
+        registry.addComponent<SpriteComponent>(::BUTTON, { .texture = nullptr, .size = ::BUTTON_SIZE });
+        registry.addComponent<TextComponent>(::BUTTON, { .content = "OK" });
+
+        UIButtonComponent button;
+        button.pressCooldownMax = pressCooldown;
+        button.onClick = [&session] { ++session.clicks; };
+        registry.addComponent<UIButtonComponent>(::BUTTON, button);
+
+        auto spriteRenderer{ std::make_shared<NullSpriteRenderer>() };
+        UIRenderSystem renderer{ spriteRenderer, std::make_shared<NullTextRenderer>() };
+        GameLoop loop{};
+
+        while(!window.shouldClose())
+        {
+            inject(window.frame(), input);
+            input.processEventQueue();
+
+            const bool pressed{ input.isMousePressed(MouseButton::Left) == InputAction::Press };
+            const auto step{ [&](float dt) { ButtonSystem::update(registry, dt, input.mousePosition(), pressed); } };
+            if(const auto steps{ replay != nullptr ? replay->steps(window.frame()) : std::nullopt })
+            {
+                loop.runHeadless(*steps, step);
+                session.steps.push_back(*steps);
+            }
+            else
+            {
+                const auto frameTime{ ::RECORDED_FRAME_TIMES[window.frame() % ::RECORDED_FRAME_TIMES.size()] };
+                session.steps.push_back(loop.advance(replay != nullptr ? ::REPLAY_FRAME_TIME : frameTime, step).steps);
+            }
+            renderer.render(registry, glm::mat4(1.f));
+
+            session.hashes.push_back(hashSimulationState(registry));
+
+            window.swapBuffers();
+            window.pollEvents();
+        }
+
+        session.spriteDraws = spriteRenderer->drawCalls();
+        return session;
+    }
+
+    /// \brief Live input of the recorded session: hover the button and hold the mouse for a few frames.
+    static void userInput(std::uint64_t frame, InputController& input)
+    {
+        constexpr std::uint64_t MOVE_FRAME{ 2 };
+        constexpr std::uint64_t PRESS_FRAME{ 5 };
+        constexpr std::uint64_t RELEASE_FRAME{ 20 };
+
+        if(frame == MOVE_FRAME)
+            input.registerEvent(MouseMoveEvent{ .posX = 110.0, .posY = 105.0 });
+        if(frame == PRESS_FRAME)
+            input.registerEvent(MouseInputEvent{ .button = MouseButton::Left, .action = InputAction::Press });
+        if(frame == RELEASE_FRAME)
+            input.registerEvent(MouseInputEvent{ .button = MouseButton::Left, .action = InputAction::Release });
+    }
+
+    /// \brief Record a session driven by \ref HeadlessWindowTest::userInput.
+    static Session record(InputRecording& recording)
+    {
+        HeadlessWindow window{ ::VIEWPORT, ::SESSION_FRAMES };
+        auto input{ std::make_shared<InputController>() };
+        window.attachInputController(input);
+
+        input->setEventObserver([&](const InputEvent& event) { recording.record(window.frame(), event); });
+        auto session{ run(window, *input, userInput) };
+
+        for(const auto steps : session.steps)
+            recording.recordSteps(steps);
+        for(const auto hash : session.hashes)
+            recording.recordStateHash(hash);
+
+        return session;
+    }
+};
+
+/// \brief Test that the window closes after its frame limit.
+TEST_F(HeadlessWindowTest, ClosesAfterFrameLimit)
+{
+    constexpr std::uint64_t FRAMES{ 3 };
+    HeadlessWindow window{ ::VIEWPORT, FRAMES };
+
+    std::uint64_t frames{ 0 };
+    while(!window.shouldClose())
+    {
+        window.swapBuffers();
+        ++frames;
+    }
+
+    EXPECT_EQ(frames, FRAMES);
+}
+
+/// \brief Test that the whole pipeline runs through the null renderer.
+TEST_F(HeadlessWindowTest, PipelineRunsWithNullRenderer)
+{
+    InputRecording recording;
+    const auto session{ record(recording) };
+
+    EXPECT_EQ(session.hashes.size(), ::SESSION_FRAMES);
+    EXPECT_EQ(session.spriteDraws, ::SESSION_FRAMES);
+    EXPECT_GT(session.clicks, 0);
+}
+
+/// \brief Test that a replayed session reproduces the recorded state of every single frame.
+///
+/// The frames of the recording took varying amounts of time, the replay runs the recorded amount of steps per frame
+/// instead of measuring its own frame time.
+TEST_F(HeadlessWindowTest, ReplayIsDeterministic)
+{
+    InputRecording recording;
+    const auto recorded{ record(recording) };
+
+    HeadlessWindow window{ ::VIEWPORT, ::SESSION_FRAMES };
+    auto input{ std::make_shared<InputController>() };
+    auto replay{ std::make_shared<InputReplay>(recording) };
+    window.attachInputController(input);
+    window.attachReplay(replay);
+
+    const auto replayed{ run(window, *input, [](std::uint64_t, InputController&) {}, replay.get()) };
+
+    for(std::uint64_t frame{ 0 }; frame < replayed.hashes.size(); ++frame)
+        replay->verify(frame, replayed.hashes[frame]);
+
+    EXPECT_FALSE(replay->firstDivergence().has_value());
+    EXPECT_TRUE(replay->finished());
+    EXPECT_EQ(replayed.steps, recorded.steps);
+    EXPECT_EQ(replayed.clicks, recorded.clicks);
+}
+
+/// \brief Test that a change in behaviour is detected as divergence from the recording.
+TEST_F(HeadlessWindowTest, ReplayDetectsDivergence)
+{
+    constexpr auto CHANGED_COOLDOWN{ 1.f };
+
+    InputRecording recording;
+    static_cast<void>(record(recording));
+
+    HeadlessWindow window{ ::VIEWPORT, ::SESSION_FRAMES };
+    auto input{ std::make_shared<InputController>() };
+    auto replay{ std::make_shared<InputReplay>(recording) };
+    window.attachInputController(input);
+    window.attachReplay(replay);
+
+    const auto replayed{ run(window, *input, [](std::uint64_t, InputController&) {}, replay.get(), CHANGED_COOLDOWN) };
+
+    for(std::uint64_t frame{ 0 }; frame < replayed.hashes.size(); ++frame)
+        replay->verify(frame, replayed.hashes[frame]);
+
+    ASSERT_TRUE(replay->firstDivergence().has_value());
+}
+
+} // namespace sfa::testing
@@ -0,0 +1,144 @@
+#include "utility/Job.hpp"
+
+#include "utility/JobCounter.hpp"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace sfa::testing
+{
+
+/// \brief Test the features of the \ref Job and the \ref JobCounter.
+///
+/// \author Felix Hommel
+/// \date 3/15/2026
+class JobTest : public ::testing::Test
+{
+public:
+    JobTest() = default;
+    ~JobTest() override = default;
+
+    JobTest(const JobTest&) = delete;
+    JobTest& operator=(const JobTest&) = delete;
+    JobTest(JobTest&&) = delete;
+    JobTest& operator=(JobTest&&) = delete;
+};
+
+/// \brief Test invoking a job after it was moved.
+///
+/// The callable moves along with the job, the moved-from job is empty.
+TEST_F(JobTest, MoveTransfersCallable)
+{
+    int calls{ 0 };
+
+    Job job{ [&calls]() { ++calls; } };
+    Job moved{ std::move(job) };
+
+    EXPECT_FALSE(static_cast<bool>(job)); // NOLINT(bugprone-use-after-move, clang-analyzer-cplusplus.Move)
+    ASSERT_TRUE(static_cast<bool>(moved));
+
+    moved();
+    moved();
+
+    EXPECT_EQ(calls, 2);
+}
+
+/// \brief Test that a job owns its callable.
+///
+/// Captured state is destroyed exactly once, when the job is reset or destroyed, no matter how often it was moved.
+TEST_F(JobTest, DestroysCapturedState)
+{
+    auto tracked{ std::make_shared<int>(0) };
+
+    {
+        Job job{ [tracked]() { ++*tracked; } };
+        EXPECT_EQ(tracked.use_count(), 2);
+
+        Job other{};
+        other = std::move(job);
+        EXPECT_EQ(tracked.use_count(), 2);
+
+        other();
+        other.reset();
+        EXPECT_EQ(tracked.use_count(), 1);
+    }
+
+    EXPECT_EQ(*tracked, 1);
+}
+
+/// \brief Test which callables fit into a job.
+///
+/// Callables up to the inline storage size fit, bigger ones have to be rejected at compile time.
+TEST_F(JobTest, RejectsCallablesThatDontFit)
+{
+    std::array<char, JOB_STORAGE_SIZE> fits{};
+    std::array<char, JOB_STORAGE_SIZE + 1> tooBig{};
+
+    const auto small{ [fits]() { static_cast<void>(fits); } };
+    const auto big{ [tooBig]() { static_cast<void>(tooBig); } };
+
+    EXPECT_TRUE(FitsInJob<decltype(small)>);
+    EXPECT_FALSE(FitsInJob<decltype(big)>);
+}
+
+/// \brief Test the transitions of a \ref JobCounter.
+///
+/// A fresh counter is finished, it is unfinished while jobs are outstanding and finished again after the last one.
+TEST_F(JobTest, CounterTracksOutstandingJobs)
+{
+    JobCounter counter;
+    EXPECT_TRUE(counter.finished());
+
+    counter.add(2);
+    EXPECT_FALSE(counter.finished());
+    EXPECT_EQ(counter.outstanding(), 2);
+
+    counter.done();
+    EXPECT_FALSE(counter.finished());
+
+    counter.done();
+    EXPECT_TRUE(counter.finished());
+
+    counter.wait();
+}
+
+/// \brief Test adding to a \ref JobCounter while other threads finish jobs.
+///
+/// A job added while the last outstanding one is finished keeps the counter unfinished, so whenever the counter reports
+/// being finished there is no outstanding job left.
+TEST_F(JobTest, CounterConcurrentAddAndDone)
+{
+    constexpr int NUM_THREADS{ 4 };
+    constexpr int NUM_ITERATIONS{ 20'000 };
+
+    JobCounter counter;
+    std::atomic<bool> violated{ false };
+    std::vector<std::jthread> threads;
+    threads.reserve(NUM_THREADS);
+    for(int t{ 0 }; t < NUM_THREADS; ++t)
+    {
+        threads.emplace_back([&counter, &violated]() {
+            for(int i{ 0 }; i < NUM_ITERATIONS; ++i)
+            {
+                counter.add();
+                if(counter.finished())
+                    violated.store(true, std::memory_order_relaxed);
+                counter.done();
+            }
+        });
+    }
+    threads.clear();
+
+    EXPECT_FALSE(violated.load());
+    EXPECT_EQ(counter.outstanding(), 0);
+    EXPECT_TRUE(counter.finished());
+    counter.wait();
+}
+
+} // namespace sfa::testing
@@ -0,0 +1,185 @@
+#include "utility/MPMCQueue.hpp"
+
+#include "utility/details/Threading.hpp"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <barrier>
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace
+{
+
+constexpr std::size_t CAPACITY{ 64 };
+
+} // namespace
+
+namespace sfa::testing
+{
+
+/// \brief Test the features of the \ref MPMCQueue.
+///
+/// \author Felix Hommel
+/// \date 3/13/2026
+class MPMCQueueTest : public ::testing::Test
+{
+public:
+    MPMCQueueTest() = default;
+    ~MPMCQueueTest() override = default;
+
+    MPMCQueueTest(const MPMCQueueTest&) = delete;
+    MPMCQueueTest& operator=(const MPMCQueueTest&) = delete;
+    MPMCQueueTest(MPMCQueueTest&&) = delete;
+    MPMCQueueTest& operator=(MPMCQueueTest&&) = delete;
+
+protected:
+    MPMCQueue<int> m_queue{ ::CAPACITY };
+};
+
+/// \brief Test that elements come out in the order they were pushed.
+TEST_F(MPMCQueueTest, PreservesOrder)
+{
+    constexpr int ITEMS{ 10 };
+
+    for(int i{ 0 }; i < ITEMS; ++i)
+        ASSERT_TRUE(m_queue.push(i));
+
+    for(int i{ 0 }; i < ITEMS; ++i)
+        EXPECT_EQ(m_queue.tryPop(), i);
+
+    EXPECT_FALSE(m_queue.tryPop().has_value());
+}
+
+/// \brief Test that pushing into a full queue fails instead of overwriting elements.
+TEST_F(MPMCQueueTest, PushFailsWhenFull)
+{
+    for(std::size_t i{ 0 }; i < m_queue.capacity(); ++i)
+        ASSERT_TRUE(m_queue.push(static_cast<int>(i)));
+
+    EXPECT_FALSE(m_queue.push(-1));
+    EXPECT_EQ(m_queue.size(), m_queue.capacity());
+
+    EXPECT_EQ(m_queue.tryPop(), 0);
+    EXPECT_TRUE(m_queue.push(-1));
+}
+
+/// \brief Test that a closed queue rejects pushes but can still be drained.
+TEST_F(MPMCQueueTest, CloseRejectsPushesButDrains)
+{
+    constexpr auto DATA{ 42 };
+
+    ASSERT_TRUE(m_queue.push(DATA));
+    m_queue.close();
+
+    EXPECT_FALSE(m_queue.push(DATA));
+    EXPECT_EQ(m_queue.waitAndPop(), DATA);
+    EXPECT_FALSE(m_queue.waitAndPop().has_value());
+}
+
+/// \brief Test that move-only elements are supported and that queued elements are destroyed with the queue.
+TEST_F(MPMCQueueTest, DestroysQueuedElements)
+{
+    auto tracked{ std::make_shared<int>(0) };
+
+    {
+        MPMCQueue<std::shared_ptr<int>> queue{ ::CAPACITY };
+        ASSERT_TRUE(queue.push(tracked));
+        ASSERT_TRUE(queue.emplace(tracked));
+        EXPECT_EQ(tracked.use_count(), 3);
+    }
+
+    EXPECT_EQ(tracked.use_count(), 1);
+
+    MPMCQueue<std::unique_ptr<int>> moveOnly{ ::CAPACITY };
+    ASSERT_TRUE(moveOnly.emplace(std::make_unique<int>(1)));
+    EXPECT_EQ(**moveOnly.tryPop(), 1);
+}
+
+/// \brief Test data processing with multiple producers and multiple consumers.
+///
+/// Given producers and consumers the queue should not skip over or duplicate any element, even while it is full.
+TEST_F(MPMCQueueTest, MultipleProducersMultipleConsumers)
+{
+    constexpr int NUM_PRODUCERS{ 4 };
+    constexpr int NUM_CONSUMERS{ 4 };
+    constexpr int ITEMS_PER_PRODUCER{ 10'000 };
+    constexpr int TOTAL_ITEMS{ NUM_PRODUCERS * ITEMS_PER_PRODUCER };
+    constexpr long long EXPECTED_SUM{ (static_cast<long long>(TOTAL_ITEMS) * (TOTAL_ITEMS - 1)) / 2 };
+
+    std::atomic<int> consumed{ 0 };
+    std::atomic<long long> sum{ 0 };
+
+    std::barrier startBarrier{ NUM_PRODUCERS + NUM_CONSUMERS };
+
+    std::vector<threading::thread_t> producers;
+    for(int p{ 0 }; p < NUM_PRODUCERS; ++p)
+    {
+        producers.emplace_back([this, &startBarrier, p]() {
+            startBarrier.arrive_and_wait();
+
+            for(int i{ 0 }; i < ITEMS_PER_PRODUCER; ++i)
+            {
+                while(!m_queue.push((p * ITEMS_PER_PRODUCER) + i))
+                    std::this_thread::yield();
+            }
+        });
+    }
+
+    std::vector<threading::thread_t> consumers;
+    for(int c{ 0 }; c < NUM_CONSUMERS; ++c)
+    {
+        consumers.emplace_back([this, &startBarrier, &sum, &consumed]() {
+            startBarrier.arrive_and_wait();
+
+            while(const auto v{ m_queue.waitAndPop() })
+            {
+                sum.fetch_add(v.value(), std::memory_order_relaxed);
+                consumed.fetch_add(1, std::memory_order_relaxed);
+            }
+        });
+    }
+
+    producers.clear();
+
+    m_queue.close();
+    consumers.clear();
+
+    EXPECT_EQ(consumed, TOTAL_ITEMS);
+    EXPECT_EQ(sum, EXPECTED_SUM);
+}
+
+/// \brief Test that a sleeping consumer is woken up by a push and by closing the queue.
+TEST_F(MPMCQueueTest, WaitingConsumerWakesUp)
+{
+    constexpr auto SLEEP_DELAY{ 50 };
+    constexpr auto DATA{ 42 };
+
+    std::atomic<int> received{ 0 };
+    std::atomic<bool> consumerExited{ false };
+
+    threading::thread_t consumer{ [this, &received, &consumerExited]() {
+        while(const auto v{ m_queue.waitAndPop() })
+            received = v.value();
+
+        consumerExited = true;
+    } };
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(SLEEP_DELAY));
+    ASSERT_TRUE(m_queue.push(DATA));
+
+    while(received != DATA)
+        std::this_thread::yield();
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(SLEEP_DELAY));
+    m_queue.close();
+
+    consumer.join();
+    EXPECT_TRUE(consumerExited);
+}
+
+} // namespace sfa::testing
@@ -0,0 +1,157 @@
+#include "utility/SPSCQueue.hpp"
+
+#include "utility/details/Threading.hpp"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace
+{
+
+constexpr std::size_t CAPACITY{ 64 };
+
+} // namespace
+
+namespace sfa::testing
+{
+
+/// \brief Test the features of the \ref SPSCQueue.
+///
+/// \author Felix Hommel
+/// \date 3/13/2026
+class SPSCQueueTest : public ::testing::Test
+{
+public:
+    SPSCQueueTest() = default;
+    ~SPSCQueueTest() override = default;
+
+    SPSCQueueTest(const SPSCQueueTest&) = delete;
+    SPSCQueueTest& operator=(const SPSCQueueTest&) = delete;
+    SPSCQueueTest(SPSCQueueTest&&) = delete;
+    SPSCQueueTest& operator=(SPSCQueueTest&&) = delete;
+
+protected:
+    SPSCQueue<int> m_queue{ ::CAPACITY };
+};
+
+/// \brief Test that elements come out in the order they were pushed.
+TEST_F(SPSCQueueTest, PreservesOrder)
+{
+    constexpr int ITEMS{ 10 };
+
+    for(int i{ 0 }; i < ITEMS; ++i)
+        ASSERT_TRUE(m_queue.push(i));
+
+    for(int i{ 0 }; i < ITEMS; ++i)
+        EXPECT_EQ(m_queue.tryPop(), i);
+
+    EXPECT_FALSE(m_queue.tryPop().has_value());
+}
+
+/// \brief Test that pushing into a full queue fails instead of overwriting elements.
+TEST_F(SPSCQueueTest, PushFailsWhenFull)
+{
+    for(std::size_t i{ 0 }; i < m_queue.capacity(); ++i)
+        ASSERT_TRUE(m_queue.push(static_cast<int>(i)));
+
+    EXPECT_FALSE(m_queue.push(-1));
+    EXPECT_EQ(m_queue.size(), m_queue.capacity());
+
+    EXPECT_EQ(m_queue.tryPop(), 0);
+    EXPECT_TRUE(m_queue.push(-1));
+}
+
+/// \brief Test that a closed queue rejects pushes but can still be drained.
+TEST_F(SPSCQueueTest, CloseRejectsPushesButDrains)
+{
+    constexpr auto DATA{ 42 };
+
+    ASSERT_TRUE(m_queue.push(DATA));
+    m_queue.close();
+
+    EXPECT_FALSE(m_queue.push(DATA));
+    EXPECT_EQ(m_queue.waitAndPop(), DATA);
+    EXPECT_FALSE(m_queue.waitAndPop().has_value());
+}
+
+/// \brief Test that move-only elements are supported and that queued elements are destroyed with the queue.
+TEST_F(SPSCQueueTest, DestroysQueuedElements)
+{
+    auto tracked{ std::make_shared<int>(0) };
+
+    {
+        SPSCQueue<std::shared_ptr<int>> queue{ ::CAPACITY };
+        ASSERT_TRUE(queue.push(tracked));
+        ASSERT_TRUE(queue.emplace(tracked));
+        EXPECT_EQ(tracked.use_count(), 3);
+    }
+
+    EXPECT_EQ(tracked.use_count(), 1);
+
+    SPSCQueue<std::unique_ptr<int>> moveOnly{ ::CAPACITY };
+    ASSERT_TRUE(moveOnly.emplace(std::make_unique<int>(1)));
+    EXPECT_EQ(**moveOnly.tryPop(), 1);
+}
+
+/// \brief Test data processing with one producer and one consumer running concurrently.
+///
+/// The consumer should receive every element exactly once and in order, even while the queue is full.
+TEST_F(SPSCQueueTest, ProducerConsumer)
+{
+    constexpr int TOTAL_ITEMS{ 100'000 };
+
+    threading::thread_t producer{ [this]() {
+        for(int i{ 0 }; i < TOTAL_ITEMS; ++i)
+        {
+            while(!m_queue.push(i))
+                std::this_thread::yield();
+        }
+
+        m_queue.close();
+    } };
+
+    int expected{ 0 };
+    bool ordered{ true };
+    while(const auto v{ m_queue.waitAndPop() })
+        ordered = ordered && v.value() == expected++;
+
+    EXPECT_TRUE(ordered);
+    EXPECT_EQ(expected, TOTAL_ITEMS);
+}
+
+/// \brief Test that a sleeping consumer is woken up by a push and by closing the queue.
+TEST_F(SPSCQueueTest, WaitingConsumerWakesUp)
+{
+    constexpr auto SLEEP_DELAY{ 50 };
+    constexpr auto DATA{ 42 };
+
+    std::atomic<int> received{ 0 };
+    std::atomic<bool> consumerExited{ false };
+
+    threading::thread_t consumer{ [this, &received, &consumerExited]() {
+        while(const auto v{ m_queue.waitAndPop() })
+            received = v.value();
+
+        consumerExited = true;
+    } };
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(SLEEP_DELAY));
+    ASSERT_TRUE(m_queue.push(DATA));
+
+    while(received != DATA)
+        std::this_thread::yield();
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(SLEEP_DELAY));
+    m_queue.close();
+
+    consumer.join();
+    EXPECT_TRUE(consumerExited);
+}
+
+} // namespace sfa::testing
@@ -0,0 +1,138 @@
+#include "utility/TaskGroup.hpp"
+
+#include "utility/ThreadPool.hpp"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace
+{
+
+constexpr std::size_t THREAD_POOL_SIZE{ 4 };
+
+} // namespace
+
+namespace sfa::testing
+{
+
+/// \brief Test the features of the \ref TaskGroup.
+///
+/// \author Felix Hommel
+/// \date 3/16/2026
+class TaskGroupTest : public ::testing::Test
+{
+public:
+    TaskGroupTest() = default;
+    ~TaskGroupTest() override = default;
+
+    TaskGroupTest(const TaskGroupTest&) = delete;
+    TaskGroupTest& operator=(const TaskGroupTest&) = delete;
+    TaskGroupTest(TaskGroupTest&&) = delete;
+    TaskGroupTest& operator=(TaskGroupTest&&) = delete;
+
+protected:
+    ThreadPool m_pool{ ::THREAD_POOL_SIZE };
+};
+
+/// \brief Run a chain of dependent tasks.
+///
+/// Every task of the chain runs only after its predecessor finished.
+TEST_F(TaskGroupTest, DependenciesRunInOrder)
+{
+    constexpr int CHAIN_LENGTH{ 16 };
+
+    std::mutex mutex;
+    std::vector<int> order;
+
+    TaskGroup group{ m_pool };
+
+    auto previous{ group.run([&]() {
+        std::lock_guard lock(mutex);
+        order.push_back(0);
+    }) };
+    for(int i{ 1 }; i < CHAIN_LENGTH; ++i)
+    {
+        previous = group.runAfter({ previous }, [&, i]() {
+            std::lock_guard lock(mutex);
+            order.push_back(i);
+        });
+    }
+
+    group.wait();
+
+    ASSERT_EQ(CHAIN_LENGTH, order.size());
+    for(int i{ 0 }; i < CHAIN_LENGTH; ++i)
+        EXPECT_EQ(i, order[static_cast<std::size_t>(i)]);
+    EXPECT_TRUE(previous.finished());
+}
+
+/// \brief Continue multiple tasks with a single task.
+///
+/// The continuation only runs once every one of its predecessors ran.
+TEST_F(TaskGroupTest, ContinuationWaitsForAllPredecessors)
+{
+    constexpr int NUM_TASKS{ 32 };
+
+    std::atomic<int> counter{ 0 };
+    int observed{ -1 };
+
+    TaskGroup group{ m_pool };
+
+    std::vector<TaskHandle> predecessors;
+    for(int i{ 0 }; i < NUM_TASKS; ++i)
+        predecessors.push_back(group.run([&counter]() { counter.fetch_add(1, std::memory_order_relaxed); }));
+
+    group.runAfter(predecessors, [&]() { observed = counter.load(std::memory_order_relaxed); });
+    group.wait();
+
+    EXPECT_EQ(NUM_TASKS, observed);
+    EXPECT_TRUE(group.finished());
+}
+
+/// \brief Continue a worker task on the main thread.
+///
+/// Main thread tasks run on the thread that created the pool while it waits for the group.
+TEST_F(TaskGroupTest, MainThreadTasksRunOnWaitingThread)
+{
+    std::thread::id loadThread;
+    std::thread::id uploadThread;
+
+    TaskGroup group{ m_pool };
+
+    const auto load{ group.run([&]() { loadThread = std::this_thread::get_id(); }) };
+    group.runAfter({ load }, [&]() { uploadThread = std::this_thread::get_id(); }, TaskAffinity::MainThread);
+    group.wait();
+
+    EXPECT_NE(std::this_thread::get_id(), loadThread);
+    EXPECT_EQ(std::this_thread::get_id(), uploadThread);
+}
+
+/// \brief Wait for a group from inside a task.
+///
+/// A worker waiting for a group keeps running jobs, so it doesn't deadlock even if it is the only worker.
+TEST_F(TaskGroupTest, WaitOnWorkerRunsOtherJobs)
+{
+    constexpr int NUM_TASKS{ 8 };
+
+    ThreadPool pool{ 1 };
+    std::atomic<int> counter{ 0 };
+
+    auto future{ pool.enqueue([&]() {
+        TaskGroup group{ pool };
+        for(int i{ 0 }; i < NUM_TASKS; ++i)
+            group.run([&counter]() { counter.fetch_add(1, std::memory_order_relaxed); });
+
+        group.wait();
+
+        return counter.load(std::memory_order_relaxed);
+    }) };
+
+    EXPECT_EQ(NUM_TASKS, future.get());
+}
+
+} // namespace sfa::testing
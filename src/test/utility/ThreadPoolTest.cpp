@@ -1,12 +1,19 @@
 #include "utility/ThreadPool.hpp"
 
+#include "testUtility/AllocationCounter.hpp"
+#include "utility/JobCounter.hpp"
+#include "utility/details/Threading.hpp"
+
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <atomic>
 #include <chrono>
 #include <cstddef>
 #include <future>
+#include <iterator>
 #include <latch>
+#include <mutex>
 #include <stdexcept>
 #include <thread>
 #include <vector>
@@ -143,5 +150,344 @@ TEST_F(ThreadPoolTest, WorkerThrowsException)
     EXPECT_THROW({ f.get(); }, std::runtime_error);
 }
 
-} // namespace sfa::testing
+/// \brief Test tasks that enqueue more tasks from inside the pool.
+///
+/// Tasks spawned by a worker run on the pool as well and every one of them is executed exactly once.
+TEST_F(ThreadPoolTest, NestedTasks)
+{
+    constexpr std::size_t THREAD_POOL_SIZE{ 4 };
+    constexpr auto NUM_PARENTS{ 8 };
+    constexpr auto NUM_CHILDREN{ 100 };
+
+    ThreadPool pool(THREAD_POOL_SIZE);
+
+    std::atomic<int> children{ 0 };
+    std::atomic<bool> allOnWorkers{ true };
+    std::latch finished{ NUM_PARENTS * NUM_CHILDREN };
+
+    EXPECT_FALSE(pool.isWorkerThread());
+
+    for(int p{ 0 }; p < NUM_PARENTS; ++p)
+    {
+        static_cast<void>(pool.enqueue([&]() {
+            for(int c{ 0 }; c < NUM_CHILDREN; ++c)
+            {
+                static_cast<void>(pool.enqueue([&]() {
+                    if(!pool.isWorkerThread())
+                        allOnWorkers.store(false, std::memory_order_relaxed);
+
+                    children.fetch_add(1, std::memory_order_relaxed);
+                    finished.count_down();
+                }));
+            }
+        }));
+    }
+
+    finished.wait();
+
+    EXPECT_EQ(children.load(), NUM_PARENTS * NUM_CHILDREN);
+    EXPECT_TRUE(allOnWorkers.load());
+}
+
+/// \brief Test submitting from several threads at once.
+///
+/// Every task submitted from outside the pool has to be executed, no matter how many threads submit concurrently.
+TEST_F(ThreadPoolTest, ConcurrentSubmitters)
+{
+    constexpr std::size_t THREAD_POOL_SIZE{ 3 };
+    constexpr auto NUM_SUBMITTERS{ 4 };
+    constexpr auto TASKS_PER_SUBMITTER{ 250 };
+
+    ThreadPool pool(THREAD_POOL_SIZE);
+
+    std::atomic<int> counter{ 0 };
+    {
+        std::vector<threading::thread_t> submitters;
+        for(int s{ 0 }; s < NUM_SUBMITTERS; ++s)
+        {
+            submitters.emplace_back([&pool, &counter]() {
+                for(int i{ 0 }; i < TASKS_PER_SUBMITTER; ++i)
+                    static_cast<void>(pool.enqueue([&counter]() { counter.fetch_add(1, std::memory_order_relaxed); }));
+            });
+        }
+    }
+
+    pool.shutdown(true);
+
+    EXPECT_EQ(counter.load(), NUM_SUBMITTERS * TASKS_PER_SUBMITTER);
+    EXPECT_EQ(pool.pendingTasks(), 0);
+}
+
+/// \brief Test the thread pool shutdown with task drain enabled, while tasks still spawn new tasks.
+///
+/// Tasks that are enqueued by running tasks during the drain are part of the queue and have to finish as well.
+TEST_F(ThreadPoolTest, ShutdownDrainRunsSpawnedTasks)
+{
+    constexpr std::size_t THREAD_POOL_SIZE{ 2 };
+    constexpr auto NUM_TASKS{ 10 };
+    constexpr auto SLEEP_TIME{ 20 };
+
+    ThreadPool pool(THREAD_POOL_SIZE);
+
+    std::atomic<int> completed{ 0 };
+    for(int i{ 0 }; i < NUM_TASKS; ++i)
+    {
+        static_cast<void>(pool.enqueue([&pool, &completed, SLEEP_TIME]() {
+            std::this_thread::sleep_for(std::chrono::milliseconds(SLEEP_TIME));
+
+            static_cast<void>(pool.enqueue([&completed]() { completed.fetch_add(1, std::memory_order_relaxed); }));
+        }));
+    }
+
+    pool.shutdown(true);
+
+    EXPECT_EQ(NUM_TASKS, completed.load());
+}
+
+/// \brief Test fire-and-forget jobs tracked with a \ref JobCounter.
+///
+/// Waiting on the counter returns once every submitted job ran.
+TEST_F(ThreadPoolTest, SubmitWithCounter)
+{
+    constexpr std::size_t THREAD_POOL_SIZE{ 4 };
+    constexpr auto NUM_TASKS{ 500 };
+
+    ThreadPool pool(THREAD_POOL_SIZE);
 
+    JobCounter counter;
+    std::atomic<int> completed{ 0 };
+    for(int i{ 0 }; i < NUM_TASKS; ++i)
+        pool.submit(counter, [&completed]() { completed.fetch_add(1, std::memory_order_relaxed); });
+
+    counter.wait();
+
+    EXPECT_EQ(completed.load(), NUM_TASKS);
+    EXPECT_EQ(counter.outstanding(), 0);
+}
+
+/// \brief Test that submitting jobs doesn't allocate once the pool is warmed up.
+///
+/// After a few rounds the job slots are recycled between the threads, so neither submitting, running nor waiting for a
+/// batch of jobs touches the heap anymore.
+TEST_F(ThreadPoolTest, SubmitDoesNotAllocate)
+{
+    constexpr std::size_t THREAD_POOL_SIZE{ 2 };
+    constexpr auto NUM_TASKS{ 200 };
+    constexpr auto WARM_UP_ROUNDS{ 20 };
+    constexpr auto MEASURED_ROUNDS{ 10 };
+
+    ThreadPool pool(THREAD_POOL_SIZE);
+
+    JobCounter counter;
+    std::atomic<int> completed{ 0 };
+    const auto runBatch{ [&]() {
+        for(int i{ 0 }; i < NUM_TASKS; ++i)
+            pool.submit(counter, [&completed]() { completed.fetch_add(1, std::memory_order_relaxed); });
+
+        counter.wait();
+    } };
+
+    for(int round{ 0 }; round < WARM_UP_ROUNDS; ++round)
+        runBatch();
+
+    std::size_t allocations{ 0 };
+    {
+        const AllocationCounter allocationCounter;
+
+        for(int round{ 0 }; round < MEASURED_ROUNDS; ++round)
+            runBatch();
+
+        allocations = allocationCounter.allocations();
+    }
+
+    EXPECT_EQ(allocations, 0);
+    EXPECT_EQ(completed.load(), NUM_TASKS * (WARM_UP_ROUNDS + MEASURED_ROUNDS));
+}
+
+/// \brief Test that cancelled jobs still count as done.
+///
+/// When the pool is shut down without draining, the counter of the dropped jobs has to finish so nobody waits forever.
+TEST_F(ThreadPoolTest, ShutdownCancelFinishesCounter)
+{
+    constexpr std::size_t THREAD_POOL_SIZE{ 1 };
+    constexpr auto NUM_TASKS{ 20 };
+    constexpr auto SLEEP_TIME{ 50 };
+
+    ThreadPool pool(THREAD_POOL_SIZE);
+
+    JobCounter counter;
+    std::latch started{ 1 };
+    pool.submit(counter, [&started, SLEEP_TIME]() {
+        started.count_down();
+        std::this_thread::sleep_for(std::chrono::milliseconds(SLEEP_TIME));
+    });
+    started.wait();
+
+    std::atomic<int> completed{ 0 };
+    for(int i{ 0 }; i < NUM_TASKS; ++i)
+        pool.submit(counter, [&completed]() { completed.fetch_add(1, std::memory_order_relaxed); });
+
+    pool.shutdown(false);
+
+    EXPECT_TRUE(counter.finished());
+    EXPECT_EQ(completed.load(), 0);
+}
+
+/// \brief Test that main thread jobs only run when the main thread drains them.
+///
+/// Jobs submitted to the main thread wait in their queue until the thread that created the pool runs them.
+TEST_F(ThreadPoolTest, MainThreadJobsRunOnMainThread)
+{
+    constexpr std::size_t THREAD_POOL_SIZE{ 2 };
+    constexpr auto NUM_TASKS{ 10 };
+
+    ThreadPool pool(THREAD_POOL_SIZE);
+    ASSERT_TRUE(pool.isMainThread());
+
+    JobCounter submitted;
+    JobCounter counter;
+    std::atomic<int> onMainThread{ 0 };
+    for(int i{ 0 }; i < NUM_TASKS; ++i)
+    {
+        pool.submit(submitted, [&pool, &counter, &onMainThread]() {
+            pool.submitToMainThread(counter, [&pool, &onMainThread]() {
+                if(pool.isMainThread())
+                    onMainThread.fetch_add(1, std::memory_order_relaxed);
+            });
+        });
+    }
+
+    submitted.wait();
+
+    EXPECT_EQ(pool.pendingMainThreadJobs(), NUM_TASKS);
+    EXPECT_EQ(onMainThread.load(), 0);
+
+    EXPECT_EQ(pool.runMainThreadJobs(), NUM_TASKS);
+    EXPECT_TRUE(counter.finished());
+    EXPECT_EQ(onMainThread.load(), NUM_TASKS);
+    EXPECT_EQ(pool.pendingMainThreadJobs(), 0);
+}
+
+/// \brief Test that higher lanes are served first without starving the lower ones.
+///
+/// While the single worker is busy, background and critical jobs queue up. Critical jobs run first, but every
+/// \ref ThreadPool::STARVATION_INTERVAL -th pick takes a background job.
+TEST_F(ThreadPoolTest, PriorityLanesWithStarvationProtection)
+{
+    constexpr std::size_t THREAD_POOL_SIZE{ 1 };
+    constexpr auto NUM_TASKS{ 10 };
+
+    ThreadPool pool(THREAD_POOL_SIZE);
+
+    JobCounter counter;
+    std::latch release{ 1 };
+    pool.submit(counter, [&release]() { release.wait(); });
+
+    std::mutex mutex;
+    std::vector<JobPriority> order;
+    for(const auto priority : { JobPriority::Background, JobPriority::Critical })
+    {
+        for(int i{ 0 }; i < NUM_TASKS; ++i)
+        {
+            pool.submit(counter, JobOptions{ .priority = priority, .stopToken = {} }, [&mutex, &order, priority]() {
+                std::lock_guard lock(mutex);
+                order.push_back(priority);
+            });
+        }
+    }
+
+    release.count_down();
+    pool.wait(counter);
+
+    ASSERT_EQ(order.size(), static_cast<std::size_t>(2 * NUM_TASKS));
+    EXPECT_EQ(order.front(), JobPriority::Critical);
+
+    const auto firstBackground{ std::ranges::find(order, JobPriority::Background) };
+    const auto lastCritical{ std::ranges::find(order.rbegin(), order.rend(), JobPriority::Critical) };
+    EXPECT_LT(std::distance(order.begin(), firstBackground), std::ptrdiff_t{ ThreadPool::STARVATION_INTERVAL });
+    EXPECT_LT(firstBackground, lastCritical.base());
+}
+
+/// \brief Test that jobs are dropped once their stop token was triggered.
+///
+/// Jobs that are still queued when the stop is requested never run, but still finish their counter.
+TEST_F(ThreadPoolTest, StopTokenDropsQueuedJobs)
+{
+    constexpr std::size_t THREAD_POOL_SIZE{ 1 };
+    constexpr auto NUM_TASKS{ 20 };
+
+    ThreadPool pool(THREAD_POOL_SIZE);
+
+    JobCounter counter;
+    std::latch release{ 1 };
+    pool.submit(counter, [&release]() { release.wait(); });
+
+    threading::stop_source_t source;
+    std::atomic<int> completed{ 0 };
+    for(int i{ 0 }; i < NUM_TASKS; ++i)
+    {
+        pool.submit(counter, JobOptions{ .priority = JobPriority::Background, .stopToken = source.get_token() }, [&]() {
+            completed.fetch_add(1, std::memory_order_relaxed);
+        });
+    }
+
+    source.request_stop();
+    release.count_down();
+    pool.wait(counter);
+
+    EXPECT_TRUE(counter.finished());
+    EXPECT_EQ(completed.load(), 0);
+}
+
+/// \brief Test that waiting with a timeout gives up while jobs are still running.
+///
+/// The main thread returns once the timeout passed, and waits successfully once the job finished.
+TEST_F(ThreadPoolTest, WaitForTimesOut)
+{
+    constexpr std::size_t THREAD_POOL_SIZE{ 1 };
+    constexpr auto TIMEOUT{ std::chrono::milliseconds(20) };
+    constexpr auto LONG_TIMEOUT{ std::chrono::seconds(10) };
+
+    ThreadPool pool(THREAD_POOL_SIZE);
+
+    JobCounter counter;
+    std::latch release{ 1 };
+    pool.submit(counter, [&release]() { release.wait(); });
+
+    EXPECT_FALSE(pool.waitFor(counter, TIMEOUT));
+
+    release.count_down();
+
+    EXPECT_TRUE(pool.waitFor(counter, LONG_TIMEOUT));
+}
+
+/// \brief Test that the waiting main thread wakes up for main thread jobs.
+///
+/// A worker hands jobs to the main thread while it sleeps, all of them run before the wait returns.
+TEST_F(ThreadPoolTest, WaitForRunsMainThreadJobs)
+{
+    constexpr std::size_t THREAD_POOL_SIZE{ 2 };
+    constexpr auto NUM_TASKS{ 10 };
+    constexpr auto SLEEP_TIME{ std::chrono::milliseconds(2) };
+    constexpr auto LONG_TIMEOUT{ std::chrono::seconds(10) };
+
+    ThreadPool pool(THREAD_POOL_SIZE);
+
+    JobCounter counter;
+    std::atomic<int> onMainThread{ 0 };
+    pool.submit(counter, [&pool, &counter, &onMainThread, NUM_TASKS, SLEEP_TIME]() {
+        for(int i{ 0 }; i < NUM_TASKS; ++i)
+        {
+            pool.submitToMainThread(counter, [&pool, &onMainThread]() {
+                if(pool.isMainThread())
+                    onMainThread.fetch_add(1, std::memory_order_relaxed);
+            });
+            std::this_thread::sleep_for(SLEEP_TIME);
+        }
+    });
+
+    EXPECT_TRUE(pool.waitFor(counter, LONG_TIMEOUT));
+    EXPECT_EQ(onMainThread.load(), NUM_TASKS);
+}
+
+} // namespace sfa::testing
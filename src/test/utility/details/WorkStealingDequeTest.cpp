@@ -0,0 +1,134 @@
+#include "utility/details/WorkStealingDeque.hpp"
+
+#include "utility/details/Threading.hpp"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <barrier>
+#include <cstddef>
+#include <vector>
+
+namespace
+{
+
+constexpr std::size_t CAPACITY{ 4 };
+
+} // namespace
+
+namespace sfa::testing
+{
+
+/// \brief Test the features of the \ref details::WorkStealingDeque.
+///
+/// \author Felix Hommel
+/// \date 3/14/2026
+class WorkStealingDequeTest : public ::testing::Test
+{
+public:
+    WorkStealingDequeTest() = default;
+    ~WorkStealingDequeTest() override = default;
+
+    WorkStealingDequeTest(const WorkStealingDequeTest&) = delete;
+    WorkStealingDequeTest& operator=(const WorkStealingDequeTest&) = delete;
+    WorkStealingDequeTest(WorkStealingDequeTest&&) = delete;
+    WorkStealingDequeTest& operator=(WorkStealingDequeTest&&) = delete;
+
+protected:
+    details::WorkStealingDeque<int> m_deque{ ::CAPACITY };
+};
+
+/// \brief Test the order in which the owner and the thieves take elements.
+///
+/// The owner pops the newest element, thieves steal the oldest one.
+TEST_F(WorkStealingDequeTest, OwnerPopsNewestThiefStealsOldest)
+{
+    m_deque.push(1);
+    m_deque.push(2);
+    m_deque.push(3);
+
+    EXPECT_EQ(m_deque.pop(), 3);
+    EXPECT_EQ(m_deque.steal(), 1);
+    EXPECT_EQ(m_deque.pop(), 2);
+
+    EXPECT_FALSE(m_deque.pop().has_value());
+    EXPECT_FALSE(m_deque.steal().has_value());
+    EXPECT_TRUE(m_deque.empty());
+}
+
+/// \brief Test pushing more elements than the initial capacity.
+///
+/// The deque grows and keeps every element in order.
+TEST_F(WorkStealingDequeTest, GrowsBeyondInitialCapacity)
+{
+    constexpr int ITEMS{ 100 };
+
+    for(int i{ 0 }; i < ITEMS; ++i)
+        m_deque.push(i);
+
+    EXPECT_EQ(m_deque.size(), ITEMS);
+
+    for(int i{ 0 }; i < ITEMS; ++i)
+        EXPECT_EQ(m_deque.steal(), i);
+}
+
+/// \brief Test the owner racing several thieves.
+///
+/// While the owner keeps pushing and popping, thieves steal concurrently. Every element has to be taken exactly once.
+TEST_F(WorkStealingDequeTest, ConcurrentStealsTakeEveryElementOnce)
+{
+    constexpr int NUM_THIEVES{ 3 };
+    constexpr int ITEMS{ 20'000 };
+    constexpr long long EXPECTED_SUM{ (static_cast<long long>(ITEMS) * (ITEMS - 1)) / 2 };
+
+    std::atomic<long long> sum{ 0 };
+    std::atomic<int> taken{ 0 };
+    std::atomic<bool> done{ false };
+    std::barrier start{ NUM_THIEVES + 1 };
+
+    std::vector<threading::thread_t> thieves;
+    for(int t{ 0 }; t < NUM_THIEVES; ++t)
+    {
+        thieves.emplace_back([this, &start, &sum, &taken, &done]() {
+            start.arrive_and_wait();
+
+            while(!done.load(std::memory_order_acquire) || !m_deque.empty())
+            {
+                if(const auto v{ m_deque.steal() })
+                {
+                    sum.fetch_add(*v, std::memory_order_relaxed);
+                    taken.fetch_add(1, std::memory_order_relaxed);
+                }
+            }
+        });
+    }
+
+    start.arrive_and_wait();
+    for(int i{ 0 }; i < ITEMS; ++i)
+    {
+        m_deque.push(i);
+
+        // NOTE: Pop every third element locally so the owner also races for the last element
+        if(i % 3 == 0)
+        {
+            if(const auto v{ m_deque.pop() })
+            {
+                sum.fetch_add(*v, std::memory_order_relaxed);
+                taken.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+    }
+    done.store(true, std::memory_order_release);
+    thieves.clear();
+
+    while(const auto v{ m_deque.pop() })
+    {
+        sum.fetch_add(*v, std::memory_order_relaxed);
+        taken.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    EXPECT_EQ(taken.load(), ITEMS);
+    EXPECT_EQ(sum.load(), EXPECTED_SUM);
+}
+
+} // namespace sfa::testing
@@ -0,0 +1,40 @@
+#include "utility/exceptions/InputRecordingException.hpp"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+namespace
+{
+
+constexpr auto TEST_MESSAGE{ "TestMessage" };
+constexpr auto throwingStatement = [] {
+    throw sfa::InputRecordingException{ TEST_MESSAGE };
+};
+
+} // namespace
+
+namespace sfa::testing
+{
+
+/// \brief Test the most basic way to create an exception.
+///
+/// In this case the source location should be the exact line where, the exception was thrown, in the same function.
+TEST(InputRecordingExceptionTest, DefaultConstruction)
+{
+    InputRecordingException e{ ::TEST_MESSAGE };
+
+    EXPECT_STREQ(e.location().function_name(), std::source_location::current().function_name());
+}
+
+/// \brief Test that the exception contains the user message when it is thrown.
+///
+/// When the exception is thrown, the message should contain the message the user specified
+TEST(InputRecordingExceptionTest, ExceptionMessgae)
+{
+    EXPECT_THAT(
+        ::throwingStatement, ::testing::ThrowsMessage<InputRecordingException>(::testing::HasSubstr(::TEST_MESSAGE))
+    );
+}
+
+} // namespace sfa::testing
+
@@ -0,0 +1,157 @@
+#include "utility/userInput/InputRecording.hpp"
+#include "utility/exceptions/InputRecordingException.hpp"
+#include "utility/userInput/InputController.hpp"
+#include "utility/userInput/InputEvent.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <sstream>
+#include <variant>
+
+namespace
+{
+
+constexpr std::uint64_t STATE_HASH{ 0xDEADBEEFCAFEull };
+// NOTE: Not exactly representable in decimal with few digits, so the round trip has to be exact
+constexpr auto MOUSE_X{ 0.1 + 0.2 };
+constexpr auto MOUSE_Y{ 1.0 / 3.0 };
+
+} // namespace
+
+namespace sfa::testing
+{
+
+/// \brief Test the features of the \ref InputRecording and \ref InputReplay.
+///
+/// \author Felix Hommel
+/// \date 3/10/2026
+class InputRecordingTest : public ::testing::Test
+{
+public:
+    InputRecordingTest() = default;
+    ~InputRecordingTest() override = default;
+
+    InputRecordingTest(const InputRecordingTest&) = delete;
+    InputRecordingTest& operator=(const InputRecordingTest&) = delete;
+    InputRecordingTest(InputRecordingTest&&) noexcept = delete;
+    InputRecordingTest& operator=(InputRecordingTest&&) noexcept = delete;
+
+protected:
+    InputRecording m_recording;
+
+    void SetUp() override
+    {
+        m_recording.record(1, KeyboardInputEvent{ .key = Key::W, .action = InputAction::Press });
+        m_recording.record(1, MouseMoveEvent{ .posX = ::MOUSE_X, .posY = ::MOUSE_Y });
+        m_recording.record(3, MouseInputEvent{ .button = MouseButton::Left, .action = InputAction::Press });
+        m_recording.recordSteps(1);
+        m_recording.recordSteps(2);
+        m_recording.recordSteps(0);
+        m_recording.recordStateHash(0);
+        m_recording.recordStateHash(::STATE_HASH);
+    }
+};
+
+/// \brief Test that a written recording is read back exactly.
+TEST_F(InputRecordingTest, RoundTripIsExact)
+{
+    std::stringstream stream;
+    m_recording.write(stream);
+
+    const auto loaded{ InputRecording::read(stream) };
+
+    ASSERT_EQ(loaded.events().size(), 3);
+    ASSERT_EQ(loaded.stateHashes().size(), 2);
+    EXPECT_EQ(loaded.stateHashes()[1], ::STATE_HASH);
+    ASSERT_EQ(loaded.frameSteps().size(), 3);
+    EXPECT_EQ(loaded.frameSteps()[1], 2);
+
+    const auto& move{ std::get<MouseMoveEvent>(loaded.events()[1].event) };
+    EXPECT_EQ(move.posX, ::MOUSE_X);
+    EXPECT_EQ(move.posY, ::MOUSE_Y);
+
+    const auto& click{ std::get<MouseInputEvent>(loaded.events()[2].event) };
+    EXPECT_EQ(loaded.events()[2].frame, 3);
+    EXPECT_EQ(click.button, MouseButton::Left);
+    EXPECT_EQ(click.action, InputAction::Press);
+}
+
+/// \brief Test that invalid recordings are rejected instead of replaying garbage.
+TEST_F(InputRecordingTest, MalformedRecordingThrows)
+{
+    std::stringstream missingHeader{ "K 1 0 1\n" };
+    std::stringstream badEnum{ "SFA-INPUT 2\nK 1 42 1\n" };
+    std::stringstream outOfOrder{ "SFA-INPUT 2\nK 2 0 1\nK 1 0 0\n" };
+    std::stringstream stepsOutOfOrder{ "SFA-INPUT 2\nS 1 1\n" };
+    // NOTE: Recordings without step counts can't be replayed deterministically
+    std::stringstream oldVersion{ "SFA-INPUT 1\nK 1 0 1\n" };
+
+    EXPECT_THROW(static_cast<void>(InputRecording::read(missingHeader)), InputRecordingException);
+    EXPECT_THROW(static_cast<void>(InputRecording::read(badEnum)), InputRecordingException);
+    EXPECT_THROW(static_cast<void>(InputRecording::read(outOfOrder)), InputRecordingException);
+    EXPECT_THROW(static_cast<void>(InputRecording::read(stepsOutOfOrder)), InputRecordingException);
+    EXPECT_THROW(static_cast<void>(InputRecording::read(oldVersion)), InputRecordingException);
+}
+
+/// \brief Test that the replay only hands out the events of frames that have been reached.
+TEST_F(InputRecordingTest, ReplayFeedsEventsPerFrame)
+{
+    InputReplay replay{ m_recording };
+    InputController controller;
+
+    replay.feed(0, controller);
+    EXPECT_EQ(controller.queuedEvents(), 0);
+
+    replay.feed(1, controller);
+    EXPECT_EQ(controller.queuedEvents(), 2);
+
+    replay.feed(2, controller);
+    EXPECT_EQ(controller.queuedEvents(), 2);
+    EXPECT_FALSE(replay.finished());
+
+    replay.feed(3, controller);
+    EXPECT_EQ(controller.queuedEvents(), 3);
+    EXPECT_TRUE(replay.finished());
+}
+
+/// \brief Test that the replay hands out the recorded step count of every frame.
+TEST_F(InputRecordingTest, ReplayReportsRecordedSteps)
+{
+    const InputReplay replay{ m_recording };
+
+    EXPECT_EQ(replay.steps(0), 1);
+    EXPECT_EQ(replay.steps(1), 2);
+    EXPECT_EQ(replay.steps(2), 0);
+    EXPECT_FALSE(replay.steps(3).has_value());
+}
+
+/// \brief Test that the first diverging frame is reported.
+TEST_F(InputRecordingTest, ReplayReportsFirstDivergence)
+{
+    InputReplay replay{ m_recording };
+
+    EXPECT_TRUE(replay.verify(0, 0));
+    EXPECT_FALSE(replay.verify(1, 0));
+    EXPECT_TRUE(replay.verify(2, 0));
+
+    ASSERT_TRUE(replay.firstDivergence().has_value());
+    EXPECT_EQ(*replay.firstDivergence(), 1);
+}
+
+/// \brief Test that an observer on the \ref InputController captures every registered event.
+TEST_F(InputRecordingTest, ObserverRecordsRegisteredEvents)
+{
+    InputController controller;
+    InputRecording recording;
+    std::uint64_t frame{ 7 };
+
+    controller.setEventObserver([&](const InputEvent& event) { recording.record(frame, event); });
+    controller.registerEvent(KeyboardInputEvent{ .key = Key::Esc, .action = InputAction::Press });
+
+    ASSERT_EQ(recording.events().size(), 1);
+    EXPECT_EQ(recording.events()[0].frame, frame);
+    EXPECT_EQ(controller.queuedEvents(), 1);
+}
+
+} // namespace sfa::testing
@@ -0,0 +1,102 @@
+#include "core/resourceManagement/AssetPackWriter.hpp"
+#include "core/resourceManagement/IntermediateResourceData.hpp"
+#include "core/resourceManagement/ResourceLoader.hpp"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iterator>
+#include <set>
+#include <span>
+#include <string>
+#include <string_view>
+#include <variant>
+#include <vector>
+
+namespace
+{
+
+/// \brief Extensions of the files that are loaded as textures.
+const std::set<std::string, std::less<>> TEXTURE_EXTENSIONS{ ".png", ".jpg", ".jpeg", ".ktx2" };
+/// \brief Extensions of the files that are packed as they are.
+const std::set<std::string, std::less<>> DATA_EXTENSIONS{ ".vert", ".frag", ".geom", ".json" };
+
+std::vector<std::byte> readFile(const std::filesystem::path& path)
+{
+    std::ifstream file{ path, std::ios::binary };
+
+    std::vector<char> content{ std::istreambuf_iterator<char>{ file }, std::istreambuf_iterator<char>{} };
+    const auto bytes{ std::as_bytes(std::span{ content }) };
+
+    return { bytes.begin(), bytes.end() };
+}
+
+} // namespace
+
+/// \brief Bake every texture, shader and config below a directory into a single asset pack.
+///
+/// Usage: StarfighterAllianceAssetPacker <resource directory> <output pack> [--mips]
+int main(int argc, char** argv)
+{
+    const std::vector<std::string_view> args(argv, std::next(argv, argc));
+    if(args.size() < 3 || (args.size() == 4 && args[3] != "--mips") || args.size() > 4)
+    {
+        spdlog::error("Usage: {} <resource directory> <output pack> [--mips]", args.empty() ? "packer" : args[0]);
+        return EXIT_FAILURE;
+    }
+
+    const std::filesystem::path root{ args[1] };
+    const std::filesystem::path output{ args[2] };
+    const auto mips{ args.size() == 4 };
+
+    std::vector<std::filesystem::path> files;
+    for(const auto& entry : std::filesystem::recursive_directory_iterator{ root })
+    {
+        if(entry.is_regular_file())
+            files.push_back(entry.path());
+    }
+
+    // NOTE: Sorted, so packing the same directory twice yields the same pack
+    std::ranges::sort(files);
+
+    sfa::ResourceLoader loader;
+    sfa::AssetPackWriter writer;
+    for(const auto& file : files)
+    {
+        const auto extension{ file.extension().string() };
+        const auto name{ file.lexically_relative(root).generic_string() };
+
+        if(TEXTURE_EXTENSIONS.contains(extension))
+        {
+            const auto result{ loader.loadTexture(file) };
+            if(!result)
+            {
+                spdlog::error("Failed to decode '{}': {}", file.string(), result.error().message);
+                return EXIT_FAILURE;
+            }
+
+            writer.addTexture(name, std::get<sfa::TextureRawData>(*result), mips);
+        }
+        else if(DATA_EXTENSIONS.contains(extension))
+            writer.addData(name, readFile(file));
+        else
+            continue;
+
+        spdlog::info("Packed '{}'", name);
+    }
+
+    if(const auto written{ writer.write(output) }; !written)
+    {
+        spdlog::error("Failed to write '{}': {}", output.string(), written.error().message);
+        return EXIT_FAILURE;
+    }
+
+    spdlog::info("Wrote {} entries to '{}'", writer.size(), output.string());
+
+    return EXIT_SUCCESS;
+}